@@ -10,8 +10,9 @@
 namespace cms {
 
     /// @brief AsyncLogger를 상속받아 UDP 전송 기능을 추가한 커스텀 로거
-    template <uint16_t MSG_SIZE = 256, uint8_t QUEUE_DEPTH = 16>
-    class UdpLogger : public AsyncLogger<MSG_SIZE, QUEUE_DEPTH> {
+    template <uint16_t MSG_SIZE = 256, uint8_t QUEUE_DEPTH = 16,
+              template <typename, size_t> class QueuePolicy = cms::ThreadSafeQueue>
+    class UdpLogger : public AsyncLogger<MSG_SIZE, QUEUE_DEPTH, QueuePolicy> {
     public:
         /// @param ip UDP 서버 IP 주소
         /// @param port UDP 서버 포트 번호
@@ -31,6 +32,16 @@ namespace cms {
             _udp.endPacket();
         }
 
+        /// @brief updateBatch()로 꺼낸 여러 로그를 줄바꿈으로 이어 하나의 UDP 패킷으로 전송합니다.
+        void outputLogBatch(const cms::StringBase* const* msgs, size_t count) override {
+            _udp.beginPacket(_ip, _port);
+            for (size_t i = 0; i < count; ++i) {
+                if (i > 0) _udp.write('\n');
+                _udp.write(reinterpret_cast<const uint8_t*>(msgs[i]->c_str()), msgs[i]->length());
+            }
+            _udp.endPacket();
+        }
+
     private:
         IPAddress _ip;               /// UDP 서버 IP 주소
         uint16_t _port;              /// UDP 서버 포트 번호
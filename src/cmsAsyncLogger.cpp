@@ -5,15 +5,16 @@
 #include <ctime>
 #include <cstdio>
 #include <cstring>
+#include <chrono>
 #ifdef ARDUINO
 #include <Arduino.h>
 #endif
 #include "cmsAsyncLogger.h"
+#include "cmsLogSink.h"  // CrashLogSink (replayCrashLog)
 
 // ANSI 이스케이프 시퀀스 정의
 #define ANSI_ESC        "\033["
 #define ANSI_RESET      "\033[0m"
-#define ANSI_BOLD_RED   "\033[1;91m"
 
 #define ANSI_COLOR_CYN  ANSI_ESC "36m"
 #define ANSI_COLOR_GRN  ANSI_ESC "32m"
@@ -21,22 +22,113 @@
 #define ANSI_COLOR_RED  ANSI_ESC "31m"
 
 namespace {
-    // 강조 키워드 정의
-    struct Keyword { const char* name; size_t len; };
-    static constexpr Keyword KEYWORDS[] = { {"ERROR", 5}, {"CRITICAL", 8}, {"FATAL", 5}, {"FAIL", 4} };
-    static constexpr size_t KEYWORD_COUNT = sizeof(KEYWORDS) / sizeof(KEYWORDS[0]);
-    static const char* TAG_COLORS[] = { "92", "93", "94", "95", "96", "32", "33", "35", "36" };
+    // 기본 강조 키워드 정의
+    static constexpr cms::LogKeyword KEYWORDS[] = {
+        {"ERROR", "1;91"}, {"CRITICAL", "1;91"}, {"FATAL", "1;91"}, {"FAIL", "1;91"}
+    };
+    static constexpr cms::LogKeywordTable KEYWORD_TABLE{KEYWORDS};
+    static const char* const TAG_COLORS[] = { "92", "93", "94", "95", "96", "32", "33", "35", "36" };
+    static constexpr size_t TAG_COLOR_COUNT = sizeof(TAG_COLORS) / sizeof(TAG_COLORS[0]);
+
+    // 억제 요약 포맷 (반복: 원래 포맷 문자열을 그대로 보여 호출 위치를 알 수 있게 함)
+    static constexpr const char* REPEAT_NOTE_FORMAT = "%s (반복 %lu회 생략)";
+    static constexpr const char* LIMIT_NOTE_FORMAT = "[Log] 속도 제한으로 %lu개 로그 생략";
+
+    /// 포맷 문자열 주소 → 반복 억제 테이블 색인
+    /// 이웃한 리터럴은 주소 차이가 작으므로 곱셈 해시(Fibonacci)의 상위 비트로 흩어 놓습니다.
+    inline size_t repeatSlot(const char* format, size_t slots) noexcept {
+        const uint32_t h = (uint32_t)reinterpret_cast<uintptr_t>(format) * 2654435761u;
+        return (size_t)(h >> 16) & (slots - 1);
+    }
+
+    /// 태그 해시 누적 (대소문자 무시 DJB2)
+    inline uint32_t tagHashStep(uint32_t hash, char c) noexcept {
+        return cms::string::djb2Step(hash, c, true);
+    }
+
+    inline char toUpperAscii(char c) noexcept {
+        return (c >= 'a' && c <= 'z') ? (char)(c - 'a' + 'A') : c;
+    }
+
+    /// 스타일링 결과를 StringBase 뒤에 덧붙이는 sink
+    struct AppendSink {
+        cms::StringBase& out;
+        void plain(const char* p, size_t n) { out.append(p, n); }
+        void styled(const char* style, const char* p, size_t n) {
+            out << ANSI_ESC << style << "m";
+            out.append(p, n);
+            out << ANSI_RESET;
+        }
+    };
+
+    /// 같은 버퍼 안에서 스타일링 결과를 앞쪽으로 써 나가는 sink
+    ///
+    /// 본문은 버퍼 끝으로 옮겨진 상태이며, 쓰기 위치(w)는 항상 아직 읽지 않은 위치보다 앞에 있습니다.
+    /// 스타일 코드가 읽지 않은 본문을 덮어쓰게 되는 구간은 스타일 없이 복사합니다.
+    struct InPlaceSink {
+        char* buf;
+        size_t w;
+        void plain(const char* p, size_t n) {
+            memmove(buf + w, p, n);
+            w += n;
+        }
+        void styled(const char* style, const char* p, size_t n) {
+            const size_t styleLen = strlen(style);
+            const size_t openLen = sizeof(ANSI_ESC) - 1 + styleLen + 1;
+            const size_t need = openLen + n + sizeof(ANSI_RESET) - 1;
+            const size_t limit = (size_t)((p + n) - buf); // 이 구간까지 읽은 뒤의 다음 미독 위치
+            if (w + need > limit) {
+                plain(p, n);
+                return;
+            }
+            memmove(buf + w + openLen, p, n);
+            memcpy(buf + w, ANSI_ESC, sizeof(ANSI_ESC) - 1);
+            memcpy(buf + w + sizeof(ANSI_ESC) - 1, style, styleLen);
+            buf[w + openLen - 1] = 'm';
+            memcpy(buf + w + openLen + n, ANSI_RESET, sizeof(ANSI_RESET) - 1);
+            w += need;
+        }
+    };
+
+    // 타임스탬프 캐시의 유효 비트 (하위 32비트 중 자정 이후 경과 초가 쓰지 않는 최상위 비트)
+    static constexpr uint64_t CLOCK_VALID = 1ull << 31;
+
+    /// 두 자리 숫자 기록 (00~99)
+    inline char* putTwoDigits(char* p, uint32_t v) noexcept {
+        p[0] = (char)('0' + v / 10);
+        p[1] = (char)('0' + v % 10);
+        return p + 2;
+    }
 }
 
 namespace cms {
 
+    /// [LoggerBase] 기본 키워드/팔레트로 초기화
+    LoggerBase::LoggerBase() noexcept {
+        setKeywords(KEYWORD_TABLE);
+        setTagColors(nullptr, 0);
+    }
+
     /// [begin] 로거 초기화 구현
     void LoggerBase::begin(LogLevel level, bool useColor) noexcept {
         _runtimeLevel = level;
         _useColor = useColor;
     }
-    /// [systemTimeSynced] 시간 동기화 플래그 설정 구현
-    void LoggerBase::systemTimeSynced(bool synced) noexcept { _timeSynced = synced; }
+    /// [systemTimeSynced] 시간 동기화 플래그 설정 구현 (시각 캐시 무효화)
+    void LoggerBase::systemTimeSynced(bool synced) noexcept {
+        _timeSynced = synced;
+        _clockCache.store(0, std::memory_order_relaxed);
+    }
+    /// [setTimestampResolution] 타임스탬프 해상도 설정 구현
+    void LoggerBase::setTimestampResolution(TimestampResolution resolution) noexcept {
+        _resolution = resolution;
+        _clockCache.store(0, std::memory_order_relaxed);
+    }
+    /// [setTimezoneOffset] 시간대 오프셋 설정 구현
+    void LoggerBase::setTimezoneOffset(int32_t offsetSeconds) noexcept {
+        _tzOffset = offsetSeconds;
+        _clockCache.store(0, std::memory_order_relaxed);
+    }
     /// [setRuntimeLevel] 런타임 필터 레벨 설정 구현
     void LoggerBase::setRuntimeLevel(LogLevel level) noexcept { _runtimeLevel = level; }
     /// [setUseColor] 색상 모드 설정 구현
@@ -44,52 +136,341 @@ namespace cms {
     /// [setLogLevel] 별칭 메서드 구현
     void LoggerBase::setLogLevel(LogLevel level) noexcept { _runtimeLevel = level; }
 
+    /// [setKeywords] 키워드 테이블 및 첫 바이트 비트맵 구성
+    void LoggerBase::setKeywords(const LogKeyword* table, size_t count) noexcept {
+        if (!table) {
+            setKeywords(KEYWORD_TABLE);
+            return;
+        }
+        setKeywords(LogKeywordTable(table, count));
+    }
+
+    /// [setKeywords] 미리 계산된 테이블 적용 구현
+    void LoggerBase::setKeywords(const LogKeywordTable& table) noexcept {
+        _keywords = table.words;
+        _keywordCount = table.count;
+        memcpy(_keywordFirst, table.first, sizeof(_keywordFirst));
+    }
+
+    /// [setTagColors] 팔레트 교체 구현
+    void LoggerBase::setTagColors(const char* const* palette, size_t count) noexcept {
+        if (!palette || count == 0) {
+            palette = TAG_COLORS;
+            count = TAG_COLOR_COUNT;
+        }
+        _tagPalette = palette;
+        _tagPaletteSize = count;
+    }
+
+    /// [setTagColor] 태그 색상 캐시 등록 구현
+    bool LoggerBase::setTagColor(const char* tag, const char* color) noexcept {
+        if (!tag) return false;
+        uint32_t hash = cms::string::DJB2_SEED;
+        for (const char* h = tag; *h; ++h) hash = tagHashStep(hash, *h);
+        return setTagColorHash(hash, color);
+    }
+
+    /// [setTagColorHash] 해시 기반 태그 색상 캐시 등록 구현
+    bool LoggerBase::setTagColorHash(uint32_t hash, const char* color) noexcept {
+        if (!color) return false;
+        for (uint8_t i = 0; i < _tagCacheCount; ++i) {
+            if (_tagCache[i].hash == hash) {
+                _tagCache[i].color = color;
+                return true;
+            }
+        }
+        if (_tagCacheCount >= TAG_CACHE_SIZE) return false;
+        _tagCache[_tagCacheCount++] = { hash, color };
+        return true;
+    }
+
     /// [d/i/w/e/log] 가변 인자 래퍼 함수들
     /// 각 레벨에 맞는 vlog 가상 함수를 호출하여 실제 가공을 시작합니다.
+    /// CMS_LOG_MIN_LEVEL 미만의 레벨은 컴파일 타임에 본문이 제거되어 빈 함수가 됩니다.
     void LoggerBase::d(const char* format, ...) {
+        if constexpr (LogLevel::Debug < LOG_MIN_LEVEL) { (void)format; return; }
         va_list args; va_start(args, format); vlog(LogLevel::Debug, format, args); va_end(args);
     }
     void LoggerBase::i(const char* format, ...) {
+        if constexpr (LogLevel::Info < LOG_MIN_LEVEL) { (void)format; return; }
         va_list args; va_start(args, format); vlog(LogLevel::Info, format, args); va_end(args);
     }
     void LoggerBase::w(const char* format, ...) {
+        if constexpr (LogLevel::Warn < LOG_MIN_LEVEL) { (void)format; return; }
         va_list args; va_start(args, format); vlog(LogLevel::Warn, format, args); va_end(args);
     }
     void LoggerBase::e(const char* format, ...) {
+        if constexpr (LogLevel::Error < LOG_MIN_LEVEL) { (void)format; return; }
         va_list args; va_start(args, format); vlog(LogLevel::Error, format, args); va_end(args);
     }
     void LoggerBase::log(LogLevel level, const char* format, ...) {
-        if (level < _runtimeLevel || !format) return;
+        if (level < LOG_MIN_LEVEL || level < _runtimeLevel || !format) return;
         va_list args; va_start(args, format); vlog(level, format, args); va_end(args);
     }
 
-    /// [logV] 로그 메시지 조립 상세 구현
+    /// [stats] 운영 통계 스냅샷 구현
+    LogStats LoggerBase::stats() const noexcept {
+        LogStats st;
+        st.produced = _statProduced.load(std::memory_order_relaxed);
+        st.suppressed = _statSuppressed.load(std::memory_order_relaxed);
+        st.rateLimited = _statRateLimited.load(std::memory_order_relaxed);
+        st.dropped = _statDropped.load(std::memory_order_relaxed);
+        st.filtered = _statFiltered.load(std::memory_order_relaxed);
+        st.truncated = _statTruncated.load(std::memory_order_relaxed);
+        st.output = _statOutput.load(std::memory_order_relaxed);
+        for (size_t b = 0; b < LogStats::LATENCY_BUCKETS; ++b) st.latency[b] = _statLatency[b].load(std::memory_order_relaxed);
+        st.maxLatencyUs = _statMaxLatency.load(std::memory_order_relaxed);
+        return st;
+    }
+
+    /// [resetStats] 운영 통계 초기화 구현
+    void LoggerBase::resetStats() noexcept {
+        _statProduced.store(0, std::memory_order_relaxed);
+        _statSuppressed.store(0, std::memory_order_relaxed);
+        _statRateLimited.store(0, std::memory_order_relaxed);
+        _statDropped.store(0, std::memory_order_relaxed);
+        _statFiltered.store(0, std::memory_order_relaxed);
+        _statTruncated.store(0, std::memory_order_relaxed);
+        _statOutput.store(0, std::memory_order_relaxed);
+        for (auto& bucket : _statLatency) bucket.store(0, std::memory_order_relaxed);
+        _statMaxLatency.store(0, std::memory_order_relaxed);
+    }
+
+    /// [setRepeatWindow] 반복 억제 구간 설정 구현
+    void LoggerBase::setRepeatWindow(uint32_t windowMs) noexcept {
+        _suppressLock.lock();
+        _repeatWindowUs = (windowMs > UINT32_MAX / 1000u) ? UINT32_MAX : windowMs * 1000u;
+        updateSuppressOn();
+        _suppressLock.unlock();
+    }
+
+    /// [setRateLimit] 레벨별 토큰 버킷 설정 구현 (설정 시 버킷을 가득 채움)
+    void LoggerBase::setRateLimit(LogLevel level, uint16_t perSecond, uint16_t burst) noexcept {
+        if ((size_t)level >= RATE_LEVELS) return;
+        if (burst == 0) burst = perSecond;
+        _suppressLock.lock();
+        RateBucket& b = _rates[(size_t)level];
+        b.perSecond = perSecond;
+        b.burst = burst;
+        b.milliTokens = (uint32_t)burst * 1000u;
+        b.lastUs = cms::monotonicMicros64();
+        updateSuppressOn();
+        _suppressLock.unlock();
+    }
+
+    /// [updateSuppressOn] 억제 단계 사용 여부 갱신 구현
+    void LoggerBase::updateSuppressOn() noexcept {
+        bool on = _repeatWindowUs > 0;
+        for (const RateBucket& b : _rates) on = on || b.perSecond > 0;
+        _suppressOn.store(on, std::memory_order_relaxed);
+    }
+
+    /// [admitLog] 반복 억제 및 속도 제한 판정 구현
     ///
-    /// 1) 타임스탬프 생성 (KST 또는 Uptime)
-    /// 2) 레벨 배지 및 색상 코드 추가
-    /// 3) 메시지 본문 포맷팅
-    /// 4) [태그] 및 키워드 스타일링 적용
-    void LoggerBase::logV(cms::StringBase& out, cms::StringBase& tmp, LogLevel level, const char* format, va_list args) {
-        if (level < _runtimeLevel || !format) return;
-        out.clear();
+    /// 1. 반복 억제: 포맷 주소 해시 색인 하나만 확인합니다. 같은 위치가 구간 안이면 개수만 세고,
+    ///    구간이 지났거나 다른 위치가 색인을 차지하면 이전 개수를 요약으로 넘기고 새 구간을 시작합니다.
+    /// 2. 속도 제한: 경과 시간만큼 토큰을 보충한 뒤 한 개를 소비합니다. 반복 억제된 로그는 토큰을 쓰지 않습니다.
+    bool LoggerBase::admitLog(LogLevel level, const char* format, SuppressNote& note) {
+        const uint64_t now = cms::monotonicMicros64();
+        _suppressLock.lock();
 
-        if (_timeSynced) {
-            std::time_t now = std::time(nullptr);
-            now += 9 * 3600;
-            struct std::tm* ti = std::gmtime(&now);
-            if (ti) out.appendPrintf("[%02d:%02d:%02d] ", ti->tm_hour, ti->tm_min, ti->tm_sec);
+        if (_repeatWindowUs > 0 && format) {
+            RepeatEntry& e = _repeats[repeatSlot(format, REPEAT_SLOTS)];
+            if (e.format == format && now - e.startUs < _repeatWindowUs) {
+                e.repeats++;
+                _suppressLock.unlock();
+                countStat(_statSuppressed);
+                return false;
+            }
+            if (e.format && e.repeats > 0) {
+                note.format = e.format;
+                note.repeats = e.repeats;
+                note.level = e.level;
+            }
+            e = RepeatEntry{format, now, 0, level};
+        }
+
+        if ((size_t)level < RATE_LEVELS && _rates[(size_t)level].perSecond > 0) {
+            RateBucket& b = _rates[(size_t)level];
+            const uint32_t cap = (uint32_t)b.burst * 1000u;
+            // 경과 us x 초당 토큰 / 1000 = 밀리토큰. 0이 되는 짧은 간격은 시각을 유지하여 다음 보충에 합산
+            // 긴 공백은 버킷을 가득 채우는 시간(burst초 이하)으로 잘라 곱셈이 넘치지 않게 함
+            uint64_t elapsed = now - b.lastUs;
+            const uint64_t fillUs = ((uint64_t)b.burst + 1u) * 1000000u;
+            if (elapsed > fillUs) elapsed = fillUs;
+            const uint64_t refill = elapsed * b.perSecond / 1000u;
+            if (refill > 0) {
+                b.milliTokens = (refill >= cap - b.milliTokens) ? cap : b.milliTokens + (uint32_t)refill;
+                b.lastUs = now;
+            }
+            if (b.milliTokens < 1000u) {
+                b.dropped++;
+                _suppressLock.unlock();
+                countStat(_statRateLimited);
+                return false;
+            }
+            b.milliTokens -= 1000u;
+            if (b.dropped > 0) {
+                note.limited = b.dropped;
+                note.limitedLevel = level;
+                b.dropped = 0;
+            }
+        }
+
+        _suppressLock.unlock();
+        return true;
+    }
+
+    /// [takeSuppressed] 남은 억제 개수 추출 구현
+    bool LoggerBase::takeSuppressed(size_t index, SuppressNote& note) {
+        if (index >= REPEAT_SLOTS + RATE_LEVELS) return false;
+        _suppressLock.lock();
+        if (index < REPEAT_SLOTS) {
+            RepeatEntry& e = _repeats[index];
+            if (e.format && e.repeats > 0) {
+                note.format = e.format;
+                note.repeats = e.repeats;
+                note.level = e.level;
+                e.repeats = 0;
+            }
         } else {
+            RateBucket& b = _rates[index - REPEAT_SLOTS];
+            if (b.dropped > 0) {
+                note.limited = b.dropped;
+                note.limitedLevel = (LogLevel)(index - REPEAT_SLOTS);
+                b.dropped = 0;
+            }
+        }
+        _suppressLock.unlock();
+        return true;
+    }
+
+    /// [captureNote] 억제 요약 기록 구현
+    bool LoggerBase::captureNote(LogMeta& meta, cms::StringBase& text, const SuppressNote& note, bool limitPart) {
+        if (limitPart) return captureF(meta, text, note.limitedLevel, LIMIT_NOTE_FORMAT, (unsigned long)note.limited);
+        return captureF(meta, text, note.level, REPEAT_NOTE_FORMAT, note.format, (unsigned long)note.repeats);
+    }
+
+    /// [captureF] 가변 인자 기록 구현
+    bool LoggerBase::captureF(LogMeta& meta, cms::StringBase& text, LogLevel level, const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+        const bool stored = captureV(meta, text, level, format, args);
+        va_end(args);
+        return stored;
+    }
+
+    /// [recordOutput] 지연 히스토그램 갱신 구현
+    ///
+    /// stamp 단위(밀리초/마이크로초)와 무관하게 마이크로초로 환산하여 고정 구간에 넣습니다.
+    /// 밀리초 해상도에서는 1ms 미만 구간의 구분이 의미가 없으므로 정밀한 분포가 필요하면 Micros 해상도를 사용하세요.
+    void LoggerBase::recordOutput(uint32_t stamp, uint32_t now) noexcept {
+        const uint32_t ticks = now - stamp;
+        uint32_t us = ticks;
+        if (_resolution != TimestampResolution::Micros) us = (ticks > UINT32_MAX / 1000u) ? UINT32_MAX : ticks * 1000u;
+
+        size_t bucket = 0;
+        while (bucket < LogStats::LATENCY_BUCKETS - 1 && us >= LogStats::LATENCY_BOUNDS_US[bucket]) ++bucket;
+        countStat(_statLatency[bucket]);
+        countStat(_statOutput);
+
+        uint32_t prev = _statMaxLatency.load(std::memory_order_relaxed);
+        while (us > prev && !_statMaxLatency.compare_exchange_weak(prev, us, std::memory_order_relaxed)) {}
+    }
+
+    /// [currentStamp] Uptime tick 조회 구현
+    uint32_t LoggerBase::currentStamp() const noexcept {
+        const bool micro = (_resolution == TimestampResolution::Micros);
 #ifdef ARDUINO
-            out.appendPrintf("[%lu] ", (unsigned long)millis());
+        return micro ? (uint32_t)micros() : (uint32_t)millis();
 #else
-            out.appendPrintf("[%lu] ", (unsigned long)std::clock());
+        // 프로세스 시작(첫 호출) 기준 경과 시간
+        static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return micro ? (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()
+                     : (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
 #endif
+    }
+
+    /// [appendTimestamp] 캐시 기반 타임스탬프 조립 구현
+    ///
+    /// 시간 동기화 상태에서는 stamp가 캐시된 초 구간 안에 있으면 time()/gmtime() 호출 없이
+    /// 캐시된 자정 이후 경과 초와 tick 차이만으로 [HH:MM:SS.fff]를 만듭니다.
+    /// 초가 바뀌었을 때만 벽시계를 읽어 캐시를 갱신합니다.
+    void LoggerBase::appendTimestamp(cms::StringBase& out, uint32_t stamp) {
+        if (!_timeSynced) {
+            out << "[";
+            out.appendUInt(stamp);
+            out << "] ";
+            return;
         }
 
+        const bool micro = (_resolution == TimestampResolution::Micros);
+        const uint32_t ticksPerSec = micro ? 1000000u : 1000u;
+
+        uint64_t cache = _clockCache.load(std::memory_order_relaxed);
+        uint32_t secStamp = (uint32_t)(cache >> 32);
+        if (!(cache & CLOCK_VALID) || (uint32_t)(stamp - secStamp) >= ticksPerSec) {
+            // 벽시계(UTC)를 tick 단위로 읽어 stamp 시점으로 되돌린 뒤 초 경계를 계산
+            const auto since = std::chrono::system_clock::now().time_since_epoch();
+            const uint64_t wallNow = micro
+                ? (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(since).count()
+                : (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(since).count();
+            const uint64_t wall = wallNow - (uint32_t)(currentStamp() - stamp);
+            const uint32_t sub = (uint32_t)(wall % ticksPerSec);
+            int64_t local = (int64_t)(wall / ticksPerSec) + _tzOffset;
+            local %= 86400;
+            if (local < 0) local += 86400;
+
+            secStamp = stamp - sub;
+            cache = ((uint64_t)secStamp << 32) | CLOCK_VALID | (uint64_t)local;
+            _clockCache.store(cache, std::memory_order_relaxed);
+        }
+
+        const uint32_t daySec = (uint32_t)(cache & (CLOCK_VALID - 1));
+        char ts[20];
+        char* p = ts;
+        *p++ = '[';
+        p = putTwoDigits(p, daySec / 3600);
+        *p++ = ':';
+        p = putTwoDigits(p, (daySec / 60) % 60);
+        *p++ = ':';
+        p = putTwoDigits(p, daySec % 60);
+        if (_resolution != TimestampResolution::Seconds) {
+            uint32_t frac = stamp - secStamp;
+            const int digits = micro ? 6 : 3;
+            *p++ = '.';
+            for (int i = digits - 1; i >= 0; --i) {
+                p[i] = (char)('0' + frac % 10);
+                frac /= 10;
+            }
+            p += digits;
+        }
+        *p++ = ']';
+        *p++ = ' ';
+        out.append(ts, (size_t)(p - ts));
+    }
+
+    /// [appendPrefix] 타임스탬프 및 레벨 배지 추가 구현
+    void LoggerBase::appendPrefix(cms::StringBase& out, LogLevel level, uint32_t stamp) {
+        appendTimestamp(out, stamp);
+
         if (_useColor) out << getColorCode(level);
         out << "[" << getLevelString(level) << "]";
         if (_useColor) out << ANSI_RESET;
         out << " ";
+    }
+
+    /// [logV] 로그 메시지 조립 상세 구현
+    ///
+    /// 1) 타임스탬프 생성 (KST 또는 Uptime)
+    /// 2) 레벨 배지 및 색상 코드 추가
+    /// 3) 메시지 본문 포맷팅
+    /// 4) [태그] 및 키워드 스타일링 적용
+    bool LoggerBase::logV(cms::StringBase& out, cms::StringBase& tmp, LogLevel level, const char* format, va_list args) {
+        if (level < LOG_MIN_LEVEL || level < _runtimeLevel || !format) return false;
+        out.clear();
+        appendPrefix(out, level, currentStamp());
 
         tmp.clear();
         tmp.appendPrintf(format, args);
@@ -97,64 +478,171 @@ namespace cms {
         if (_useColor) applyStyling(out, tmp.c_str(), level);
         else out << tmp;
 
-        dispatchLog(out.c_str());
+        return true;
     }
 
-    /// [applyStyling] 태그 스타일링 구현
+    /// [logInPlace] 단일 버퍼 로그 조립 구현
+    bool LoggerBase::logInPlace(cms::StringBase& out, LogLevel level, const char* format, va_list args) {
+        if (level < LOG_MIN_LEVEL || level < _runtimeLevel || !format) return false;
+        out.clear();
+        appendPrefix(out, level, currentStamp());
+
+        const size_t bodyStart = out.length();
+        out.appendPrintf(format, args);
+        if (_useColor) styleInPlace(out, bodyStart);
+
+        return true;
+    }
+
+    /// [captureV] 큐 원소 기록 구현
     ///
-    /// 대괄호로 감싸진 [TAG]를 찾아 DJB2 해시를 기반으로 고유 색상을 입힙니다.
-    /// 태그가 아닌 일반 텍스트는 키워드 강조 로직으로 전달합니다.
-    void LoggerBase::applyStyling(cms::StringBase& out, const char* rawMsg, LogLevel level) {
-        const char* p = rawMsg;
-        const char* startBracket;
-        while ((startBracket = strchr(p, '[')) != nullptr) {
-            appendWithKeywords(out, p, startBracket - p);
-            const char* endBracket = strchr(startBracket, ']');
-            if (endBracket && (endBracket > startBracket + 1)) {
-                unsigned int hash = 5381;
-                for (const char* h = startBracket + 1; h < endBracket; h++) {
-                    char c = (*h >= 'a' && *h <= 'z') ? (*h - 'a' + 'A') : *h;
-                    hash = ((hash << 5) + hash) + (unsigned char)c;
-                }
-                const char* color = TAG_COLORS[hash % (sizeof(TAG_COLORS) / sizeof(TAG_COLORS[0]))];
-                out << ANSI_ESC << color << "m";
-                out.append(startBracket, (endBracket - startBracket) + 1);
-                out << ANSI_RESET;
-                p = endBracket + 1;
-            } else {
-                out << "[";
-                p = startBracket + 1;
-            }
+    /// 지연 모드에서는 포맷 문자열 포인터와 패킹된 인자만 기록하고,
+    /// 즉시 모드에서는 logV로 최종 문자열을 조립한 뒤 handleLog 훅을 적용합니다.
+    bool LoggerBase::captureV(LogMeta& meta, cms::StringBase& text, LogLevel level, const char* format, va_list args) {
+        meta.stamp = currentStamp();
+        meta.level = level;
+        meta.argLen = 0;
+        meta.format = nullptr;
+        text.clear();
+        if (!format) return false;
+
+        if (_deferred) {
+            // 텍스트 버퍼를 바이트 저장소로 사용 (NUL 종료 문자열이 아님)
+            meta.format = format;
+            meta.argLen = (uint16_t)cms::string::packPrintfArgs(
+                reinterpret_cast<uint8_t*>(&text[0]), text.capacity(), format, args);
+            return true;
+        }
+
+        // 실패했거나 handleLog가 가로챈 로그는 빈 문자열로 돌려주어 호출자가 슬롯을 반환하게 함
+        if (!logInPlace(text, level, format, args)) {
+            text.clear();
+            return false;
+        }
+        countTruncation(text);
+        if (handleLog(text)) {
+            countStat(_statFiltered);
+            text.clear();
+            return false;
         }
-        appendWithKeywords(out, p, strlen(p));
+        return true;
     }
 
-    /// [appendWithKeywords] 중요 키워드 강조 구현
+    /// [renderDeferred] 지연 포맷팅 원소 변환 구현
     ///
-    /// ERROR, FATAL 등 미리 정의된 키워드를 대소문자 구분 없이 찾아
-    /// Bold Red 스타일을 적용하여 시인성을 높입니다.
-    void LoggerBase::appendWithKeywords(cms::StringBase& out, const char* src, size_t len) {
-        if (len == 0) return;
-        const char* p = src;
-        const char* end = src + len;
+    /// 패킹된 인자를 tmp에 먼저 풀어내므로 out과 text가 같은 버퍼여도 안전합니다.
+    bool LoggerBase::renderDeferred(LogMeta& meta, const cms::StringBase& text, cms::StringBase& out, cms::StringBase& tmp) {
+        tmp.clear();
+        tmp.appendPacked(meta.format, reinterpret_cast<const uint8_t*>(text.c_str()), meta.argLen);
+        meta.format = nullptr;
+
+        out.clear();
+        appendPrefix(out, meta.level, meta.stamp);
+        if (_useColor) applyStyling(out, tmp.c_str(), meta.level);
+        else out << tmp;
+
+        countTruncation(out);
+        if (handleLog(out)) {
+            countStat(_statFiltered);
+            return false;
+        }
+        return true;
+    }
+
+    /// [scanStyles] 단일 패스 스타일 스캐너 구현
+    ///
+    /// [TAG]는 ']'를 찾는 동안 DJB2 해시를 함께 계산하여 색상을 고르고,
+    /// 키워드는 첫 바이트 비트맵에 걸린 위치에서만 비교합니다.
+    /// 스타일이 없는 구간은 모아 두었다가 한 번에 sink로 넘깁니다.
+    template <typename Sink>
+    void LoggerBase::scanStyles(const char* p, const char* end, bool tags, Sink& sink) const {
+        const char* run = p;      // 아직 넘기지 않은 일반 텍스트 구간의 시작
+        bool tagPossible = tags;  // 뒤에 ']'가 없음을 확인하면 태그 검사를 중단
         while (p < end) {
-            int matchIdx = -1;
-            for (size_t i = 0; i < KEYWORD_COUNT; ++i) {
-                if (p + KEYWORDS[i].len <= end && cms::string::startsWith(p, KEYWORDS[i].name, KEYWORDS[i].len, true)) {
-                    matchIdx = (int)i;
-                    break;
+            const unsigned char c = (unsigned char)*p;
+            if (c == '[' && tagPossible) {
+                uint32_t hash = cms::string::DJB2_SEED;
+                const char* q = p + 1;
+                while (q < end && *q != ']') hash = tagHashStep(hash, *q++);
+                if (q < end && q > p + 1) {
+                    if (p > run) sink.plain(run, (size_t)(p - run));
+                    sink.styled(tagColor(hash), p, (size_t)(q - p) + 1);
+                    p = q + 1;
+                    run = p;
+                    continue;
                 }
+                if (q >= end) tagPossible = false;
+                ++p; // 닫히지 않은 '[' 또는 빈 태그 '[]'는 일반 문자로 취급
+                continue;
             }
-            if (matchIdx != -1) {
-                out << ANSI_BOLD_RED;
-                out.append(p, KEYWORDS[matchIdx].len);
-                out << ANSI_RESET;
-                p += KEYWORDS[matchIdx].len;
-            } else {
-                char c = *p++;
-                out.append(&c, 1);
+            if (_keywordFirst[c >> 5] & (1u << (c & 31))) {
+                if (const LogKeyword* kw = matchKeyword(p, end)) {
+                    if (p > run) sink.plain(run, (size_t)(p - run));
+                    sink.styled(kw->style, p, kw->len);
+                    p += kw->len;
+                    run = p;
+                    continue;
+                }
             }
+            ++p;
+        }
+        if (p > run) sink.plain(run, (size_t)(p - run));
+    }
+
+    /// [applyStyling] 태그 스타일링 구현
+    ///
+    /// 대괄호로 감싸진 [TAG]에 DJB2 해시 기반 고유 색상을, 키워드에 강조 스타일을 입혀 out 뒤에 추가합니다.
+    void LoggerBase::applyStyling(cms::StringBase& out, const char* rawMsg, LogLevel level) {
+        (void)level;
+        AppendSink sink{ out };
+        scanStyles(rawMsg, rawMsg + strlen(rawMsg), true, sink);
+    }
+
+    /// [appendWithKeywords] 중요 키워드 강조 구현
+    ///
+    /// 등록된 키워드를 대소문자 구분 없이 찾아 지정된 스타일을 적용합니다.
+    void LoggerBase::appendWithKeywords(cms::StringBase& out, const char* src, size_t len) {
+        AppendSink sink{ out };
+        scanStyles(src, src + len, false, sink);
+    }
+
+    /// [styleInPlace] 제자리 스타일링 구현
+    ///
+    /// 본문을 버퍼 끝으로 옮긴 뒤 앞쪽(bodyStart)부터 스타일링 결과를 다시 써 나갑니다.
+    /// 별도의 본문 버퍼가 필요 없으므로 로그 한 줄당 메시지 크기의 버퍼는 out 하나뿐입니다.
+    void LoggerBase::styleInPlace(cms::StringBase& out, size_t bodyStart) {
+        if (out.capacity() == 0 || bodyStart >= out.length()) return;
+        char* buf = &out[0];
+        const size_t bodyLen = out.length() - bodyStart;
+        const size_t end = out.capacity() - 1;
+        const size_t src = end - bodyLen;
+        memmove(buf + src, buf + bodyStart, bodyLen);
+
+        InPlaceSink sink{ buf, bodyStart };
+        scanStyles(buf + src, buf + end, true, sink);
+        out.setLength(sink.w);
+    }
+
+    /// [tagColor] 캐시 우선 색상 조회 구현
+    const char* LoggerBase::tagColor(uint32_t hash) const noexcept {
+        for (uint8_t i = 0; i < _tagCacheCount; ++i) {
+            if (_tagCache[i].hash == hash) return _tagCache[i].color;
+        }
+        return _tagPalette[hash % _tagPaletteSize];
+    }
+
+    /// [matchKeyword] 키워드 비교 구현
+    ///
+    /// end가 nullptr이면 NUL 종료 문자열로 간주하며, 비교 중 NUL을 만나면 불일치로 처리합니다.
+    const LogKeyword* LoggerBase::matchKeyword(const char* p, const char* end) const noexcept {
+        for (size_t i = 0; i < _keywordCount; ++i) {
+            const LogKeyword& kw = _keywords[i];
+            if (kw.len == 0 || (end && (size_t)(end - p) < kw.len)) continue;
+            size_t j = 0;
+            while (j < kw.len && p[j] && toUpperAscii(p[j]) == toUpperAscii(kw.word[j])) ++j;
+            if (j == kw.len) return &kw;
         }
+        return nullptr;
     }
 
     /// [getLevelString] 레벨 약어 매핑 구현
@@ -188,4 +676,95 @@ namespace cms {
 #endif
     }
 
+    /// [outputLogBatch] 기본 일괄 출력 구현 (메시지별 outputLog 위임)
+    void LoggerBase::outputLogBatch(const cms::StringBase* const* msgs, size_t count) {
+        for (size_t i = 0; i < count; ++i) outputLog(*msgs[i]);
+    }
+
+    /// [addSink] sink 등록 구현
+    bool LoggerBase::addSink(LogSink& sink, LogLevel minLevel, bool color) noexcept {
+        if (_sinkCount >= MAX_SINKS) return false;
+        for (size_t i = 0; i < _sinkCount; ++i) {
+            if (_sinks[i].sink == &sink) return false;
+        }
+        _sinks[_sinkCount++] = SinkEntry{&sink, minLevel, color};
+        return true;
+    }
+
+    /// [removeSink] sink 해제 구현 (등록 순서 유지)
+    bool LoggerBase::removeSink(LogSink& sink) noexcept {
+        for (size_t i = 0; i < _sinkCount; ++i) {
+            if (_sinks[i].sink != &sink) continue;
+            for (size_t j = i + 1; j < _sinkCount; ++j) _sinks[j - 1] = _sinks[j];
+            _sinks[--_sinkCount] = SinkEntry{};
+            return true;
+        }
+        return false;
+    }
+
+    /// [flushSinks] 전체 sink flush 구현
+    void LoggerBase::flushSinks() {
+        for (size_t i = 0; i < _sinkCount; ++i) _sinks[i].sink->flush();
+    }
+
+    /// [replayCrashLog] 크래시 로그 재출력 등록 구현
+    void LoggerBase::replayCrashLog(CrashLogSink& source, uint8_t linesPerUpdate) noexcept {
+        _replayRate = linesPerUpdate;
+        _replaySource = (linesPerUpdate > 0 && source.recoveredCount() > 0) ? &source : nullptr;
+    }
+
+    /// [replayCrashLines] 복구 줄 재출력 구현
+    ///
+    /// 복구 줄은 이미 조립된(색상 없는) 이전 부팅의 로그이므로 스타일링 없이 접두사만 붙여 그대로 전달합니다.
+    void LoggerBase::replayCrashLines(cms::StringBase& line, cms::StringBase& plain) {
+        for (uint8_t n = 0; n < _replayRate; ++n) {
+            LogLevel level;
+            line = "[Prev] ";
+            if (!_replaySource->popRecovered(line, level)) break;
+            if (hasSinks()) dispatchToSinks(line, level, plain, _replaySource);
+            else outputLog(line);
+        }
+        if (_replaySource->recoveredCount() == 0) _replaySource = nullptr;
+    }
+
+    /// [tickSinks] 유휴 시점 sink tick 구현
+    void LoggerBase::tickSinks() {
+        for (size_t i = 0; i < _sinkCount; ++i) _sinks[i].sink->tick();
+    }
+
+    /// [dispatchToSinks] sink 분배 구현
+    ///
+    /// 색상 sink는 조립된 로그를 그대로 받고, 나머지 sink는 ANSI 이스케이프(ESC '[' ... 종결 문자)를 제거한 사본을 공유합니다.
+    /// 사본은 색상이 없는 sink가 실제로 이 레벨을 받을 때만 한 번 만들어집니다.
+    void LoggerBase::dispatchToSinks(const cms::StringBase& msg, LogLevel level, cms::StringBase& plain, const LogSink* skip) {
+        bool plainReady = !_useColor; // 색상 모드가 꺼져 있으면 원본이 곧 plain
+        for (size_t i = 0; i < _sinkCount; ++i) {
+            const SinkEntry& entry = _sinks[i];
+            if (level < entry.minLevel || entry.sink == skip) continue;
+            if (entry.color || !_useColor) {
+                entry.sink->write(msg, level);
+                continue;
+            }
+            if (!plainReady) {
+                plain.clear();
+                const char* p = msg.c_str();
+                const char* end = p + msg.length();
+                while (p < end) {
+                    const char* esc = static_cast<const char*>(memchr(p, '\033', (size_t)(end - p)));
+                    if (!esc) esc = end;
+                    plain.append(p, (size_t)(esc - p));
+                    if (esc == end) break;
+                    p = esc + 1;
+                    if (p < end && *p == '[') {
+                        ++p;
+                        while (p < end && !(*p >= '@' && *p <= '~')) ++p; // 파라미터 바이트 건너뜀
+                        if (p < end) ++p;                                  // 종결 문자 (예: 'm')
+                    }
+                }
+                plainReady = true;
+            }
+            entry.sink->write(plain, level);
+        }
+    }
+
 } // namespace cms
@@ -3,13 +3,54 @@
 
 #pragma once
 
-#include <cstdint>          // uint8_t
+#include <cstdint>          // uint8_t, SIZE_MAX
 #include <cstdarg>          // va_list
 #include <ctime>            // time, gmtime
 #include <cstdio>           // printf
+#include <new>              // placement new (LogRingQueue::Slot)
+#include <atomic>           // 타임스탬프 캐시, 운영 통계
+#include <type_traits>      // 큐 통계 지원 여부 검사
+#include <utility>          // std::declval
+#ifndef ARDUINO
+#include <functional>       // std::hash (ShardedLogQueue 스레드 배정)
+#include <thread>           // std::this_thread::get_id
+#endif
 #include "cmsString.h"
 #include "cmsQueue.h"
 
+/**
+ * @brief 컴파일 타임 최소 로그 레벨 (0: Debug, 1: Info, 2: Warn, 3: Error, 4: None)
+ * 이 레벨보다 낮은 CMS_LOG_D/I/W/E 호출은 인자 평가와 포맷 문자열까지 바이너리에서 제거됩니다.
+ * 릴리스 빌드에서는 build_flags에 -DCMS_LOG_MIN_LEVEL=2 처럼 지정하세요. (모든 소스에 동일하게 적용해야 함)
+ */
+#ifndef CMS_LOG_MIN_LEVEL
+#define CMS_LOG_MIN_LEVEL 0
+#endif
+
+static_assert(CMS_LOG_MIN_LEVEL >= 0 && CMS_LOG_MIN_LEVEL <= 4, "CMS_LOG_MIN_LEVEL must be 0(Debug) ~ 4(None)");
+
+/// [CMS_LOG_D/I/W/E] 컴파일 타임 레벨 필터가 적용되는 로그 매크로
+///
+/// CMS_LOG_MIN_LEVEL 미만의 호출은 if constexpr로 폐기되어 가변 인자 준비, 가상 호출, 인자 평가가 모두 사라집니다.
+///
+/// 사용 예:
+/// @code
+/// CMS_LOG_D(logger, "raw=%d", readSensor()); // CMS_LOG_MIN_LEVEL >= 1이면 readSensor()도 호출되지 않음
+/// @endcode
+#define CMS_LOG_AT(lvl, logger, method, ...) \
+    do { if constexpr (CMS_LOG_MIN_LEVEL <= (lvl)) { (logger).method(__VA_ARGS__); } } while (0)
+#define CMS_LOG_D(logger, ...) CMS_LOG_AT(0, logger, d, __VA_ARGS__)
+#define CMS_LOG_I(logger, ...) CMS_LOG_AT(1, logger, i, __VA_ARGS__)
+#define CMS_LOG_W(logger, ...) CMS_LOG_AT(2, logger, w, __VA_ARGS__)
+#define CMS_LOG_E(logger, ...) CMS_LOG_AT(3, logger, e, __VA_ARGS__)
+
+// 드문 경로의 큰 스택 버퍼가 호출자 프레임에 합쳐지지 않도록 인라인을 막는 속성
+#if defined(__GNUC__) || defined(__clang__)
+    #define CMS_NOINLINE __attribute__((noinline))
+#else
+    #define CMS_NOINLINE
+#endif
+
 namespace cms {
 
     /// [LogLevel] 로그 출력 우선순위 정의
@@ -23,6 +64,168 @@ namespace cms {
         None        ///< 모든 로그 차단
     };
 
+    /// [TimestampResolution] 타임스탬프 해상도
+    ///
+    /// 시간 동기화 상태에서는 [HH:MM:SS] 뒤에 붙는 소수부 자릿수를, 미동기화 상태에서는
+    /// 출력되는 Uptime 단위를 결정합니다. (Seconds/Millis: 밀리초, Micros: 마이크로초)
+    enum class TimestampResolution : uint8_t {
+        Seconds = 0, ///< [HH:MM:SS]
+        Millis,      ///< [HH:MM:SS.mmm]
+        Micros       ///< [HH:MM:SS.uuuuuu] (Uptime은 uint32 마이크로초이므로 약 71분마다 순환)
+    };
+
+    /// [LOG_MIN_LEVEL] 컴파일 타임 최소 로그 레벨 (CMS_LOG_MIN_LEVEL)
+    ///
+    /// 이 레벨 미만의 로그는 런타임 레벨과 무관하게 항상 버려집니다.
+    constexpr LogLevel LOG_MIN_LEVEL = static_cast<LogLevel>(CMS_LOG_MIN_LEVEL);
+
+    /// [LogKeyword] 강조 키워드 정의
+    ///
+    /// 로그 본문에서 대소문자 구분 없이 찾아 지정된 스타일로 강조할 단어입니다.
+    /// 리터럴로 생성하면 길이가 컴파일 타임에 계산됩니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// static const cms::LogKeyword MY_KEYWORDS[] = { {"TIMEOUT", "1;93"}, {"PANIC", "1;91"} };
+    /// logger.setKeywords(MY_KEYWORDS, 2);
+    /// @endcode
+    struct LogKeyword {
+        const char* word;  ///< 강조할 단어 (ASCII)
+        size_t len;        ///< 단어 길이
+        const char* style; ///< ANSI SGR 파라미터 (예: "1;91" = Bold Red)
+
+        template <size_t N>
+        constexpr LogKeyword(const char (&w)[N], const char* s) noexcept : word(w), len(N - 1), style(s) {}
+        constexpr LogKeyword(const char* w, size_t l, const char* s) noexcept : word(w), len(l), style(s) {}
+    };
+
+    /// [LogKeywordTable] 첫 바이트 비트맵을 미리 계산한 키워드 테이블
+    ///
+    /// 스타일 스캐너는 키워드 첫 글자(대/소문자) 비트맵에 걸린 위치에서만 비교합니다.
+    /// constexpr로 선언하면 이 비트맵까지 빌드 단계에서 계산되어 setKeywords()가 복사만 수행합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// static constexpr cms::LogKeyword MY_KEYWORDS[] = { {"TIMEOUT", "1;93"}, {"PANIC", "1;91"} };
+    /// static constexpr cms::LogKeywordTable MY_TABLE{MY_KEYWORDS};
+    /// logger.setKeywords(MY_TABLE);
+    /// @endcode
+    struct LogKeywordTable {
+        const LogKeyword* words = nullptr; ///< 키워드 배열 (복사되지 않음, 정적 배열이어야 함)
+        size_t count = 0;                  ///< 키워드 개수
+        uint32_t first[8] = {};            ///< 키워드 첫 바이트 비트맵 (256비트, 대소문자 모두 표시)
+
+        template <size_t N>
+        constexpr LogKeywordTable(const LogKeyword (&table)[N]) noexcept : words(table), count(N) {
+            for (size_t i = 0; i < N; ++i) mark(table[i]);
+        }
+        constexpr LogKeywordTable(const LogKeyword* table, size_t n) noexcept : words(table), count(table ? n : 0) {
+            for (size_t i = 0; i < count; ++i) mark(table[i]);
+        }
+
+    private:
+        constexpr void mark(const LogKeyword& kw) noexcept {
+            if (kw.len == 0) return;
+            const unsigned char c = (unsigned char)kw.word[0];
+            const unsigned char up = (c >= 'a' && c <= 'z') ? (unsigned char)(c - 'a' + 'A') : c;
+            const unsigned char lo = (up >= 'A' && up <= 'Z') ? (unsigned char)(up - 'A' + 'a') : up;
+            first[up >> 5] |= (1u << (up & 31));
+            first[lo >> 5] |= (1u << (lo & 31));
+        }
+    };
+
+    /// [LogMeta] 로그 레코드 메타데이터
+    ///
+    /// 큐에 저장되는 로그 한 건의 부가 정보입니다. 지연 포맷팅 모드에서는 포맷 문자열 포인터와
+    /// 패킹된 인자 길이를 보관하고, 실제 인자 바이트는 LogEntry::text 버퍼에 저장됩니다.
+    struct LogMeta {
+        uint32_t stamp = 0;              ///< 로그 발생 시각 (Uptime tick)
+        const char* format = nullptr;    ///< 지연 포맷팅 포맷 문자열 (nullptr: text가 완성된 로그)
+        uint16_t argLen = 0;             ///< 지연 포맷팅 시 text 버퍼에 패킹된 인자 바이트 수
+        LogLevel level = LogLevel::Info; ///< 로그 레벨
+    };
+
+    /// [LogEntry] 로그 큐 원소
+    ///
+    /// @tparam M 로그 한 줄의 최대 바이트 크기
+    template <size_t M>
+    struct LogEntry {
+        LogMeta meta;        ///< 메타데이터
+        cms::String<M> text; ///< 완성된 로그 문자열 또는 패킹된 인자 (meta.format != nullptr)
+    };
+
+    /// [LogStats] 로거 운영 통계 스냅샷
+    ///
+    /// 실제 부하에서 QUEUE_DEPTH와 MSG_SIZE를 정하기 위한 지표입니다. 모든 값은 생성 또는 resetStats() 이후 누적값이며,
+    /// 카운터는 uint32로 순환합니다. 큐 항목(overwritten ~ maxLockWaitUs)은 QueuePolicy가 stats()를 제공할 때만
+    /// (ThreadSafeQueue) 채워지고, 그 외에는 0입니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// cms::LogStats st = logger.stats();
+    /// for (size_t b = 0; b < cms::LogStats::LATENCY_BUCKETS; ++b) printf("%u ", (unsigned)st.latency[b]);
+    /// @endcode
+    struct LogStats {
+        /// 지연 시간 히스토그램 구간 수
+        static constexpr size_t LATENCY_BUCKETS = 8;
+        /// 각 구간의 상한 (마이크로초, 미만). 마지막 구간은 1초 이상
+        static constexpr uint32_t LATENCY_BOUNDS_US[LATENCY_BUCKETS - 1] = {
+            100, 1000, 3000, 10000, 30000, 100000, 1000000
+        };
+
+        uint32_t produced = 0;      ///< 레벨 필터와 반복/속도 억제를 통과한 로그 호출 수
+        uint32_t suppressed = 0;    ///< 반복 억제로 요약에 합쳐진 로그 수 (setRepeatWindow)
+        uint32_t rateLimited = 0;   ///< 레벨별 속도 제한으로 버려진 로그 수 (setRateLimit)
+        uint32_t dropped = 0;       ///< 큐 슬롯을 얻지 못해 버려진 새 로그 수
+        uint32_t filtered = 0;      ///< handleLog가 가로챈 로그 수
+        uint32_t truncated = 0;     ///< MSG_SIZE에 도달하여 잘렸을 수 있는 로그 수
+        uint32_t output = 0;        ///< outputLog/outputLogBatch로 전달된 로그 수
+        uint32_t latency[LATENCY_BUCKETS] = {}; ///< 기록 → 출력 지연 히스토그램 (LATENCY_BOUNDS_US 기준)
+        uint32_t maxLatencyUs = 0;  ///< 기록 → 출력 지연 최댓값 (마이크로초)
+
+        uint32_t overwritten = 0;   ///< 큐가 가득 차서 밀려난 오래된 로그 수
+        uint32_t highWater = 0;     ///< 큐에 동시에 쌓였던 최대 줄 수
+        uint32_t contended = 0;     ///< 큐 뮤텍스를 기다린 횟수
+        uint32_t lockWaitUs = 0;    ///< 큐 뮤텍스 대기 시간 합계 (마이크로초)
+        uint32_t maxLockWaitUs = 0; ///< 큐 뮤텍스 대기 시간 최댓값 (마이크로초)
+    };
+
+// ==================================================================================================
+// [LogSink] 개요
+// - 왜 존재하는가: Serial, UDP, 파일처럼 여러 출력 매체에 동시에 로그를 보내기 위해 매번 outputLog를 재정의하는 서브클래스를 만들지 않도록 존재합니다.
+// - 어떻게 동작하는가: LoggerBase::addSink()로 등록된 sink마다 최소 레벨과 색상 여부를 두고, 한 번 조립된 로그를 조건에 맞는 sink로 나눠 보냅니다.
+// ==================================================================================================
+
+    /// 로그 출력 매체 인터페이스입니다.
+    ///
+    /// Why: 출력 매체별 전송 코드를 로거 클래스 계층과 분리하여 조합할 수 있게 하기 위함입니다.
+    /// How: 로거는 완성된 한 줄(줄바꿈 없음)과 레벨을 write()로 넘기며, 스타일링은 로거가 한 번만 수행합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// class UdpSink : public cms::LogSink {
+    /// public:
+    ///     void write(const cms::StringBase& line, cms::LogLevel level) override { send(line.c_str(), line.length()); }
+    /// };
+    /// @endcode
+    class LogSink {
+    public:
+        virtual ~LogSink() = default;
+
+        /// [write] 로그 한 줄 출력 (update()를 호출하는 태스크에서 실행)
+        /// @param line 완성된 로그 (줄바꿈 미포함, 등록 시 color=false면 ANSI 코드가 제거된 상태)
+        /// @param level 로그 레벨
+        virtual void write(const cms::StringBase& line, LogLevel level) = 0;
+
+        /// [flush] 버퍼에 모아 둔 출력을 즉시 내보냄 (기본: 아무 동작 없음)
+        virtual void flush() {}
+
+        /// [tick] 큐가 비어 update()가 할 일이 없을 때 호출됨 (시간 기반 flush 등에 사용, 기본: 아무 동작 없음)
+        virtual void tick() {}
+    };
+
+    class CrashLogSink; // cmsLogSink.h (LoggerBase::replayCrashLog)
+
 // ==================================================================================================
 // [LoggerBase] 개요
 // - 왜 존재하는가: 템플릿 인자(N)에 의존하지 않는 공통 로깅 로직을 분리하여 코드 비대화(Code Bloat)를 방지합니다.
@@ -54,6 +257,20 @@ namespace cms {
         /// @param synced true: [HH:MM:SS] 형식, false: [Uptime] 형식
         void systemTimeSynced(bool synced) noexcept;
 
+        /// [setTimestampResolution] 타임스탬프 해상도 설정
+        ///
+        /// 사용 예:
+        /// @code
+        /// logger.setTimestampResolution(cms::TimestampResolution::Millis); // [12:34:56.789]
+        /// @endcode
+        /// @note 큐에 쌓인 로그의 tick 단위가 바뀌므로 begin 직후에 설정하세요.
+        void setTimestampResolution(TimestampResolution resolution) noexcept;
+
+        /// [setTimezoneOffset] 시간대 오프셋 설정
+        ///
+        /// @param offsetSeconds UTC 기준 오프셋 (초, 기본값: 9 * 3600 = KST)
+        void setTimezoneOffset(int32_t offsetSeconds) noexcept;
+
         /// [setRuntimeLevel] 출력 레벨 변경
         ///
         /// 실행 중에 로그 출력 레벨을 동적으로 변경합니다. 설정된 레벨보다 낮은 로그는 무시됩니다.
@@ -71,6 +288,176 @@ namespace cms {
         /// [setLogLevel] setRuntimeLevel의 별칭 (하위 호환성)
         void setLogLevel(LogLevel level) noexcept;
 
+        /// [setDeferred] 지연 포맷팅 모드 설정
+        ///
+        /// 활성화하면 i()/d() 등의 호출 시점에는 레벨, 시각, 포맷 문자열 포인터, 인자 값만 큐에 복사하고
+        /// 포맷팅, 타임스탬프 변환, 스타일링, handleLog()는 모두 update() 시점에 수행합니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// logger.setDeferred(true);
+        /// logger.i("ADC=%d", raw); // 수백 사이클 내 반환
+        /// @endcode
+        ///
+        /// @note 포맷 문자열은 update() 시점까지 유효해야 하므로 문자열 리터럴만 사용해야 합니다. (%s 인자는 복사되어 무관)
+        /// @note handleLog()가 update()를 호출하는 태스크에서 실행되므로, SpscQueue 사용 시 handleLog에서 pushToQueue()를 호출하면 안 됩니다.
+        void setDeferred(bool deferred) noexcept { _deferred = deferred; }
+
+        /// [isDeferred] 지연 포맷팅 모드 여부 확인
+        bool isDeferred() const noexcept { return _deferred; }
+
+        /// [setKeywords] 강조 키워드 테이블 교체
+        ///
+        /// 기본 키워드(ERROR, CRITICAL, FATAL, FAIL) 대신 사용자 테이블을 사용합니다.
+        /// 테이블은 복사되지 않으므로 로거보다 오래 유지되는 정적 배열이어야 합니다.
+        ///
+        /// @param table 키워드 배열 (nullptr: 기본 테이블 복원)
+        /// @param count 키워드 개수
+        /// @note 로그를 남기는 태스크가 동작하기 전(begin 직후)에 설정하세요.
+        void setKeywords(const LogKeyword* table, size_t count) noexcept;
+
+        /// [setKeywords] 미리 계산된 키워드 테이블로 교체 (비트맵 복사만 수행)
+        void setKeywords(const LogKeywordTable& table) noexcept;
+
+        /// [setTagColors] 태그 색상 팔레트 교체
+        ///
+        /// 등록되지 않은 [TAG]는 DJB2 해시 % count 로 팔레트에서 색상을 고릅니다.
+        /// @param palette ANSI SGR 파라미터 배열 (nullptr: 기본 팔레트 복원, 정적 배열이어야 함)
+        /// @param count 팔레트 크기
+        void setTagColors(const char* const* palette, size_t count) noexcept;
+
+        /// [setTagColor] 특정 태그의 색상 고정
+        ///
+        /// 태그 해시와 색상을 미리 계산된 캐시(최대 TAG_CACHE_SIZE개)에 등록합니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// logger.setTagColor("Network", "94"); // [Network]는 항상 파란색
+        /// @endcode
+        /// @return false: 캐시가 가득 참
+        bool setTagColor(const char* tag, const char* color) noexcept;
+
+        /// [setTagColor] 컴파일 타임 태그의 색상 고정
+        ///
+        /// 태그 해시를 FixedString::tagHash()로 빌드 단계에서 계산하므로 실행 중에는 캐시 등록만 수행합니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// static constexpr cms::FixedString kNetTag{"[Network]"};
+        /// logger.setTagColor<kNetTag>("94");
+        /// @endcode
+        /// @tparam TAG 정적 constexpr cms::FixedString 객체 ("[TAG]" 또는 "TAG")
+        template <const auto& TAG>
+        bool setTagColor(const char* color) noexcept {
+            constexpr uint32_t hash = TAG.tagHash();
+            return setTagColorHash(hash, color);
+        }
+
+        /// [setTagColorHash] 미리 계산된 태그 해시(대소문자 무시 DJB2, 예: "Network"_ihash)의 색상 고정
+        bool setTagColorHash(uint32_t tagHash, const char* color) noexcept;
+
+        /// 태그 색상 캐시 크기
+        static constexpr size_t TAG_CACHE_SIZE = 8;
+
+        /// 등록 가능한 최대 sink 개수
+        static constexpr size_t MAX_SINKS = 4;
+
+        /// [addSink] 출력 sink 등록
+        ///
+        /// sink가 하나라도 등록되면 outputLog()/outputLogBatch() 대신 등록된 sink들로 출력합니다.
+        /// 로그는 한 번만 조립·스타일링되며, color=false인 sink가 있으면 ANSI 코드를 제거한 사본을 한 번만 만들어 공유합니다.
+        /// (setUseColor(false)이면 모든 sink가 색상 없는 로그를 받음)
+        ///
+        /// 사용 예:
+        /// @code
+        /// static cms::ConsoleLogSink console;
+        /// static cms::FileLogSink<4096> file(fopen("/littlefs/app.log", "a"));
+        /// logger.addSink(console, cms::LogLevel::Debug, true);
+        /// logger.addSink(file, cms::LogLevel::Info);
+        /// @endcode
+        ///
+        /// @param sink 등록할 sink (로거보다 오래 유지되어야 함, 복사되지 않음)
+        /// @param minLevel 이 sink로 보낼 최소 레벨
+        /// @param color true: ANSI 색상이 포함된 로그, false: 색상 코드 제거
+        /// @return false: MAX_SINKS 초과 또는 이미 등록됨
+        /// @note 로그를 남기는 태스크가 동작하기 전(begin 직후)에 설정하세요.
+        bool addSink(LogSink& sink, LogLevel minLevel = LogLevel::Debug, bool color = false) noexcept;
+
+        /// [removeSink] 출력 sink 등록 해제
+        /// @return false: 등록되지 않은 sink
+        bool removeSink(LogSink& sink) noexcept;
+
+        /// [sinkCount] 등록된 sink 개수
+        size_t sinkCount() const noexcept { return _sinkCount; }
+
+        /// [flushSinks] 모든 sink의 버퍼를 즉시 내보냄 (재부팅/절전 진입 전 호출)
+        void flushSinks();
+
+        /// [replayCrashLog] 이전 부팅에서 복구된 크래시 로그를 유휴 update마다 재출력
+        ///
+        /// 큐가 비어 update()/updateWait()/updateBatch()가 할 일이 없을 때마다 복구 줄을 최대 linesPerUpdate줄씩
+        /// "[Prev] " 접두사를 붙여 source를 제외한 sink(또는 sink가 없으면 outputLog)로 내보냅니다.
+        /// 재출력된 줄은 source에서 제거되며, 복구 줄을 모두 내보내면 자동으로 해제됩니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// logger.addSink(crashSink, cms::LogLevel::Info);
+        /// logger.replayCrashLog(crashSink, 4); // 부팅 직후의 로그 폭주를 막기 위해 천천히 내보냄
+        /// @endcode
+        ///
+        /// @param source 복구 줄을 가진 CrashLogSink (cmsLogSink.h)
+        /// @param linesPerUpdate 유휴 update 한 번에 내보낼 최대 줄 수 (0: 재출력 중지)
+        /// @note 재출력은 큐가 빌 때만 일어나므로 update()의 반환값(큐의 로그를 출력했는지)에는 영향을 주지 않습니다.
+        void replayCrashLog(CrashLogSink& source, uint8_t linesPerUpdate = 4) noexcept;
+
+        /// 반복 억제 테이블 크기 (호출 위치 해시 색인, 2의 거듭제곱)
+        static constexpr size_t REPEAT_SLOTS = 16;
+        static_assert((REPEAT_SLOTS & (REPEAT_SLOTS - 1)) == 0, "REPEAT_SLOTS must be a power of two");
+
+        /// [setRepeatWindow] 같은 호출 위치의 반복 로그 억제 (기본: 꺼짐)
+        ///
+        /// 같은 포맷 문자열(호출 위치)에서 window 안에 다시 들어온 로그는 큐에 넣지 않고 개수만 셉니다.
+        /// window가 지난 뒤 그 위치의 다음 로그나 같은 색인을 쓰는 다른 위치의 로그가 들어오면
+        /// "<포맷> (반복 N회 생략)" 요약 한 줄을 먼저 남깁니다. 인자가 달라도 같은 위치면 같은 로그로 봅니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// logger.setRepeatWindow(1000); // 호출 위치마다 초당 최대 1줄 + 요약
+        /// @endcode
+        ///
+        /// @param windowMs 억제 구간 (밀리초, 0: 끔, 약 71분 미만)
+        void setRepeatWindow(uint32_t windowMs) noexcept;
+
+        /// [setRateLimit] 레벨별 토큰 버킷 속도 제한 (기본: 꺼짐)
+        ///
+        /// 레벨마다 초당 perSecond개의 토큰이 burst개까지 쌓이며, 토큰이 없을 때 들어온 로그는 버립니다.
+        /// 토큰이 다시 생기면 "[Log] 속도 제한으로 N개 로그 생략" 요약 한 줄을 먼저 남깁니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// logger.setRateLimit(cms::LogLevel::Debug, 20, 50); // Debug는 초당 20줄, 순간 50줄까지
+        /// @endcode
+        ///
+        /// @param level 제한할 레벨 (Debug ~ Error)
+        /// @param perSecond 초당 허용 개수 (0: 이 레벨의 제한 끔)
+        /// @param burst 순간 허용 개수 (0이면 perSecond와 같음)
+        void setRateLimit(LogLevel level, uint16_t perSecond, uint16_t burst = 0) noexcept;
+
+        /// [stats] 운영 통계 조회
+        ///
+        /// 모든 카운터는 원자 변수이므로 로그를 남기는 태스크나 update() 태스크를 막지 않고 어디서든 읽을 수 있습니다.
+        /// 항목 간 시점은 조금 어긋날 수 있습니다. 큐 항목까지 포함하려면 AsyncLogger::stats()를 사용하세요.
+        ///
+        /// 사용 예:
+        /// @code
+        /// cms::LogStats st = logger.stats();
+        /// if (st.truncated > 0) { /* MSG_SIZE 부족 */ }
+        /// @endcode
+        LogStats stats() const noexcept;
+
+        /// [resetStats] 로거 운영 통계 초기화
+        void resetStats() noexcept;
+
         // ---------------------------------------------------------
         // [i/d/w/e] 편리한 로그 출력을 위한 헬퍼 메서드 (Base로 이동)
         // ---------------------------------------------------------
@@ -84,17 +471,25 @@ namespace cms {
         /// [e] Error 레벨 로그 출력 (Red)
         void e(const char* format, ...) CMS_PRINTF_CHECK(2, 3); // Error
 
+        /// @note d/i/w/e는 CMS_LOG_MIN_LEVEL 미만이면 즉시 반환하지만 인자는 평가됩니다. 인자 평가까지 제거하려면 CMS_LOG_D/I/W/E 매크로를 사용하세요.
+
         /// [log] 지정된 레벨로 로그 출력
         ///
-        /// 런타임 레벨 체크를 수행한 후 비동기 큐에 로그를 쌓습니다.
+        /// 컴파일 타임/런타임 레벨 체크를 수행한 후 비동기 큐에 로그를 쌓습니다.
         void log(LogLevel level, const char* format, ...) CMS_PRINTF_CHECK(3, 4);
 
     protected:
-        LoggerBase() = default;
+        LoggerBase() noexcept;
         virtual ~LoggerBase() = default;
 
         bool _timeSynced = false;           ///< 시간 동기화 여부 플래그
+        TimestampResolution _resolution = TimestampResolution::Seconds; ///< 타임스탬프 해상도
+        int32_t _tzOffset = 9 * 3600;       ///< 시간대 오프셋 (초)
+        /// 현재 초의 시작 tick(상위 32비트)과 자정 이후 경과 초(하위 비트)를 묶은 캐시.
+        /// 여러 태스크가 동시에 logV를 호출해도 한 번의 원자적 읽기/쓰기로 일관성을 유지합니다.
+        std::atomic<uint64_t> _clockCache{0};
         bool _useColor = true;              ///< ANSI 색상 사용 여부 플래그
+        bool _deferred = false;             ///< 지연 포맷팅 모드 플래그
         LogLevel _runtimeLevel = LogLevel::Debug; ///< 현재 필터링 레벨
 
         /// [handleLog] 로그 가로채기 및 필터링
@@ -109,31 +504,583 @@ namespace cms {
         const char* getLevelString(LogLevel level) noexcept;
         /// [getColorCode] 레벨별 ANSI 색상 코드 반환
         const char* getColorCode(LogLevel level) noexcept;
-        /// [applyStyling] [태그] 및 키워드 강조 스타일링 적용
+        /// [applyStyling] [태그] 및 키워드 강조 스타일링 적용 (단일 패스)
         void applyStyling(cms::StringBase& out, const char* rawMsg, LogLevel level);
         /// [appendWithKeywords] 특정 키워드(FATAL 등)를 찾아 강조 스타일 추가
         void appendWithKeywords(cms::StringBase& out, const char* src, size_t len);
+        /// [tagColor] 태그 해시에 대응하는 색상 반환 (캐시 우선, 없으면 팔레트)
+        const char* tagColor(uint32_t hash) const noexcept;
+        /// [matchKeyword] p 위치에서 시작하는 키워드 검색 (없으면 nullptr)
+        const LogKeyword* matchKeyword(const char* p, const char* end) const noexcept;
+        /// [scanStyles] [p, end) 구간을 한 번 훑어 일반 구간/스타일 구간을 sink로 전달
+        template <typename Sink>
+        void scanStyles(const char* p, const char* end, bool tags, Sink& sink) const;
+
+        /// 태그 색상 캐시 항목
+        struct TagColor { uint32_t hash; const char* color; };
+
+        const LogKeyword* _keywords = nullptr;     ///< 강조 키워드 테이블
+        size_t _keywordCount = 0;                  ///< 강조 키워드 개수
+        uint32_t _keywordFirst[8] = {};            ///< 키워드 첫 바이트 비트맵 (256비트, 대소문자 모두 표시)
+        const char* const* _tagPalette = nullptr;  ///< 태그 색상 팔레트
+        size_t _tagPaletteSize = 0;                ///< 팔레트 크기
+        TagColor _tagCache[TAG_CACHE_SIZE] = {};   ///< 미리 계산된 태그 해시 → 색상 캐시
+        uint8_t _tagCacheCount = 0;                ///< 등록된 캐시 항목 수
+
+        /// 반복 억제 테이블 항목 (호출 위치별 억제 구간과 억제된 개수)
+        struct RepeatEntry {
+            const char* format;   ///< 호출 위치 (nullptr: 빈 항목)
+            uint64_t startUs;     ///< 억제 구간 시작 (monotonicMicros64, 오래 쉬어도 순환으로 구간 안처럼 보이지 않음)
+            uint32_t repeats;     ///< 구간 안에서 억제된 개수
+            LogLevel level;       ///< 요약에 사용할 레벨
+        };
+
+        /// 레벨별 토큰 버킷
+        struct RateBucket {
+            uint16_t perSecond;   ///< 초당 토큰 (0: 제한 없음)
+            uint16_t burst;       ///< 최대 토큰
+            uint32_t milliTokens; ///< 남은 토큰 x 1000 (고정 소수점)
+            uint64_t lastUs;      ///< 마지막 보충 시각 (monotonicMicros64)
+            uint32_t dropped;     ///< 요약을 남기지 않은 버려진 개수
+        };
+
+        static constexpr size_t RATE_LEVELS = (size_t)LogLevel::None; ///< 제한 가능한 레벨 수 (Debug ~ Error)
+
+        cms::Mutex _suppressLock;                    ///< 억제 테이블/버킷 보호 (여러 생산자 태스크)
+        std::atomic<bool> _suppressOn{false};        ///< 억제 단계 사용 여부 (꺼져 있으면 잠금 없이 통과)
+        uint32_t _repeatWindowUs = 0;                ///< 반복 억제 구간 (0: 끔)
+        RepeatEntry _repeats[REPEAT_SLOTS] = {};     ///< 호출 위치 해시 → 억제 상태
+        RateBucket _rates[RATE_LEVELS] = {};         ///< 레벨별 속도 제한
+
+        // 운영 통계 (stats()가 잠금 없이 읽음)
+        std::atomic<uint32_t> _statProduced{0};
+        std::atomic<uint32_t> _statDropped{0};
+        std::atomic<uint32_t> _statFiltered{0};
+        std::atomic<uint32_t> _statTruncated{0};
+        std::atomic<uint32_t> _statOutput{0};
+        std::atomic<uint32_t> _statLatency[LogStats::LATENCY_BUCKETS] = {};
+        std::atomic<uint32_t> _statMaxLatency{0};
+        std::atomic<uint32_t> _statSuppressed{0};
+        std::atomic<uint32_t> _statRateLimited{0};
+
+        /// [updateSuppressOn] 반복 억제나 속도 제한이 하나라도 켜져 있는지 갱신 (_suppressLock 보유 상태)
+        void updateSuppressOn() noexcept;
+
+        /// 등록된 sink와 sink별 출력 조건
+        struct SinkEntry {
+            LogSink* sink;
+            LogLevel minLevel;
+            bool color;
+        };
+        SinkEntry _sinks[MAX_SINKS] = {}; ///< 출력 sink 목록
+        uint8_t _sinkCount = 0;            ///< 등록된 sink 개수
+
+        /// [hasSinks] sink 출력 모드인지 확인 (false: outputLog/outputLogBatch 사용)
+        bool hasSinks() const noexcept { return _sinkCount > 0; }
+
+        /// [dispatchToSinks] 완성된 로그를 조건에 맞는 sink들로 전달
+        /// @param msg 조립된 로그 (setUseColor(true)이면 ANSI 코드 포함)
+        /// @param level 로그 레벨
+        /// @param plain 색상 코드를 제거한 사본을 만들 임시 버퍼 (필요할 때 한 번만 사용)
+        /// @param skip 전달하지 않을 sink (크래시 로그 재출력 시 원본 sink)
+        void dispatchToSinks(const cms::StringBase& msg, LogLevel level, cms::StringBase& plain, const LogSink* skip = nullptr);
+
+        /// [tickSinks] 큐가 비었을 때 sink들의 tick() 호출
+        void tickSinks();
+
+        CrashLogSink* _replaySource = nullptr; ///< 복구 줄을 재출력 중인 크래시 로그 (nullptr: 없음)
+        uint8_t _replayRate = 0;               ///< 유휴 update 한 번에 재출력할 최대 줄 수
+
+        /// [replayCrashLines] 복구 줄을 최대 _replayRate줄 재출력 (line/plain은 호출자가 제공하는 MSG_SIZE 임시 버퍼)
+        void replayCrashLines(cms::StringBase& line, cms::StringBase& plain);
+
+        /// 억제 단계가 큐에 남겨야 할 요약 (반복 요약, 속도 제한 요약 각각 최대 1줄)
+        struct SuppressNote {
+            const char* format = nullptr;         ///< 반복 요약 대상 호출 위치 (nullptr: 없음)
+            uint32_t repeats = 0;                 ///< 억제된 반복 개수
+            LogLevel level = LogLevel::Info;      ///< 반복 요약 레벨
+            uint32_t limited = 0;                 ///< 속도 제한으로 버려진 개수 (0: 없음)
+            LogLevel limitedLevel = LogLevel::Info; ///< 속도 제한 요약 레벨
+        };
+
+        /// [suppressionEnabled] 억제 단계 사용 여부 (잠금 없음)
+        bool suppressionEnabled() const noexcept { return _suppressOn.load(std::memory_order_relaxed); }
+
+        /// [admitLog] 반복 억제와 속도 제한 판정 (O(1), 고정 메모리)
+        /// @param note 통과 여부와 무관하게 먼저 큐에 남길 요약이 채워짐
+        /// @return true: 큐에 넣음, false: 억제됨 (통계 반영 완료)
+        bool admitLog(LogLevel level, const char* format, SuppressNote& note);
+
+        /// [takeSuppressed] index번째 억제 항목(반복 테이블 → 레벨 버킷 순)의 남은 개수를 꺼내 요약으로 채움
+        /// @return false: index가 범위를 벗어남 (REPEAT_SLOTS + RATE_LEVELS)
+        bool takeSuppressed(size_t index, SuppressNote& note);
+
+        /// [captureNote] 요약 한 줄을 큐 원소에 기록
+        /// @param limitPart false: 반복 요약, true: 속도 제한 요약
+        /// @return captureV와 같음 (false: 슬롯 반환 필요)
+        bool captureNote(LogMeta& meta, cms::StringBase& text, const SuppressNote& note, bool limitPart);
+
+        /// [captureF] captureV의 가변 인자 버전
+        bool captureF(LogMeta& meta, cms::StringBase& text, LogLevel level, const char* format, ...);
+
+        /// [countStat] 통계 카운터 1 증가 (여러 생산 태스크가 동시에 호출할 수 있음)
+        static void countStat(std::atomic<uint32_t>& counter) noexcept { counter.fetch_add(1, std::memory_order_relaxed); }
+
+        /// [countTruncation] 버퍼를 가득 채운 메시지를 잘린 로그로 집계
+        void countTruncation(const cms::StringBase& msg) noexcept {
+            if (msg.length() + 1 >= msg.capacity()) countStat(_statTruncated);
+        }
+
+        /// [recordOutput] 출력된 로그 한 건의 기록 → 출력 지연을 히스토그램에 반영
+        /// @param stamp 로그 발생 시각 (LogMeta::stamp)
+        /// @param now 출력 시각 (currentStamp())
+        void recordOutput(uint32_t stamp, uint32_t now) noexcept;
 
         /// [logV] 로그 메시지 조립 핵심 로직
         ///
-        /// 타임스탬프, 레벨 배지, 스타일링을 적용하여 최종 로그 문자열을 완성합니다.
-        /// @param out 결과가 저장될 버퍼
+        /// 타임스탬프, 레벨 배지, 스타일링을 적용하여 최종 로그 문자열을 out에 완성합니다.
+        /// out은 보통 큐 슬롯 자체이므로 조립된 결과는 추가 복사 없이 그대로 큐에 남습니다.
+        /// @param out 결과가 저장될 버퍼 (큐 슬롯)
         /// @param tmp 포맷팅에 사용될 임시 버퍼
         /// @param level 로그 레벨
         /// @param format printf 스타일 포맷
         /// @param args 가변 인자 리스트
-        void logV(cms::StringBase& out, cms::StringBase& tmp, LogLevel level, const char* format, va_list args);
+        /// @return true: 조립 완료, false: 레벨 필터 또는 잘못된 포맷으로 조립하지 않음
+        bool logV(cms::StringBase& out, cms::StringBase& tmp, LogLevel level, const char* format, va_list args);
+
+        /// [logInPlace] 임시 버퍼 없이 out 하나로 로그 메시지 조립
+        ///
+        /// 접두어 뒤에 본문을 바로 포맷팅한 뒤 styleInPlace로 같은 버퍼 안에서 스타일링합니다.
+        /// 결과는 logV와 같으며, 스타일 코드가 남은 공간에 들어가지 않으면 해당 구간만 스타일 없이 남깁니다.
+        /// @return true: 조립 완료, false: 레벨 필터 또는 잘못된 포맷으로 조립하지 않음
+        bool logInPlace(cms::StringBase& out, LogLevel level, const char* format, va_list args);
+
+        /// [styleInPlace] out[bodyStart..]의 본문에 제자리 스타일링 적용
+        void styleInPlace(cms::StringBase& out, size_t bodyStart);
+
+        /// [captureV] 로그 발생 시점의 큐 원소 기록
+        ///
+        /// 지연 모드에서는 인자만 패킹하고, 그 외에는 logInPlace로 text(보통 큐 슬롯)에 직접 조립한 뒤 handleLog로 필터링합니다.
+        /// @param meta [OUT] 큐 원소 메타데이터
+        /// @param text [OUT] 큐 원소 문자열 버퍼 (조립 결과 또는 패킹된 인자, false 반환 시 빈 문자열)
+        /// @return true: 큐에 저장할 로그, false: 조립 실패 또는 handleLog가 가로챔 (호출자는 슬롯을 반환해야 함)
+        bool captureV(LogMeta& meta, cms::StringBase& text, LogLevel level, const char* format, va_list args);
+
+        /// [renderDeferred] 지연 포맷팅 원소를 최종 로그 문자열로 변환
+        ///
+        /// text의 패킹된 인자로 본문을 tmp에 만든 뒤 out에 타임스탬프/배지/스타일링을 적용하고 handleLog로 필터링합니다.
+        /// out과 text가 같은 버퍼여도 안전합니다. 변환 후 meta.format은 nullptr가 됩니다.
+        /// @return true: 출력 대상, false: handleLog가 가로챔
+        bool renderDeferred(LogMeta& meta, const cms::StringBase& text, cms::StringBase& out, cms::StringBase& tmp);
+
+        /// [isDeferredEntry] 원소가 아직 포맷팅되지 않은 지연 로그인지 확인
+        static bool isDeferredEntry(const LogMeta& meta) noexcept { return meta.format != nullptr; }
+
+        /// [currentStamp] 현재 Uptime tick (Micros 해상도: 마이크로초, 그 외: 밀리초)
+        uint32_t currentStamp() const noexcept;
+
+        /// [appendTimestamp] stamp 시점의 [HH:MM:SS(.fff)] 또는 [Uptime] 추가
+        void appendTimestamp(cms::StringBase& out, uint32_t stamp);
+
+        /// [appendPrefix] 타임스탬프와 레벨 배지 추가
+        void appendPrefix(cms::StringBase& out, LogLevel level, uint32_t stamp);
 
         /// [vlog] 자식 클래스에 버퍼 제공 요청 (순수 가상 함수)
         virtual void vlog(LogLevel level, const char* format, va_list args) = 0;
-        /// [dispatchLog] 가공된 로그를 큐로 전달 (순수 가상 함수)
-        virtual void dispatchLog(const char* msg) = 0;
 
         /// [outputLog] 실제 데이터 출력
         ///
         /// 큐에서 꺼내진 로그 메시지를 시리얼, 네트워크, 파일 등 물리적 매체로 전송합니다.
         /// @param msg 출력할 최종 로그 메시지
         virtual void outputLog(const cms::StringBase& msg);
+
+        /// [outputLogBatch] 여러 로그의 일괄 출력
+        ///
+        /// updateBatch()가 한 번에 꺼낸 로그 묶음을 전달합니다. 재정의하면 여러 줄을 하나의 UDP 패킷이나
+        /// 한 번의 Serial.write로 합쳐 전송할 수 있습니다. 기본 구현은 각 메시지마다 outputLog()를 호출합니다.
+        /// @param msgs 출력할 로그 메시지 포인터 배열 (오래된 순)
+        /// @param count 메시지 개수
+        virtual void outputLogBatch(const cms::StringBase* const* msgs, size_t count);
+    };
+
+// ==================================================================================================
+// [LogRingQueue] 개요
+// - 왜 존재하는가: 로그 한 줄마다 MSG_SIZE 바이트 슬롯을 잡는 대신, 실제 길이만큼만 저장하여 같은 RAM에 더 많은 줄을 보관하기 위해 존재합니다.
+// - 어떻게 동작하는가: ByteRing 레코드를 String 슬롯처럼 보이게 하는 핸들(Slot)로 감싸 AsyncLogger의 QueuePolicy 인터페이스를 제공합니다.
+// ==================================================================================================
+
+    template <typename T, size_t N>
+    class LogRingQueue;
+
+    /// 가변 길이 레코드로 로그를 저장하는 AsyncLogger용 큐 정책입니다.
+    ///
+    /// Why: 대부분의 로그는 MSG_SIZE보다 훨씬 짧아 고정 슬롯 큐에서는 RAM의 상당 부분이 사용되지 않기 때문입니다.
+    /// How: 고정 슬롯 큐와 같은 RAM(N * M 바이트)을 바이트 링으로 사용합니다. 기록 시 최대 크기를 예약한 뒤
+    ///      commit 시점에 [LogMeta + 실제 길이]만 남기므로, 평균 50바이트 로그 기준 4~5배 많은 줄을 보관합니다.
+    ///      지연 포맷팅 모드에서는 패킹된 인자만 남아 더 많은 줄을 보관합니다.
+    ///
+    /// @note 가득 차면 ThreadSafeQueue와 같이 가장 오래된 로그부터 버립니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// // 4KB(256 x 16) 링에 가변 길이로 로그 저장
+    /// cms::AsyncLogger<256, 16, cms::LogRingQueue> logger;
+    /// @endcode
+    ///
+    /// @tparam M 로그 한 줄의 최대 바이트 크기 (LogEntry<M>)
+    /// @tparam N 고정 슬롯 기준 큐 깊이 (링 크기 = N * M 바이트, 한 번에 조회 가능한 최대 줄 수)
+    template <size_t M, size_t N>
+    class LogRingQueue<cms::LogEntry<M>, N> {
+    public:
+        /// 링 레코드를 LogEntry처럼 다루기 위한 슬롯 핸들입니다.
+        ///
+        /// 핸들 내부의 뷰(meta, text)가 레코드 메모리를 직접 가리키므로, 핸들을 통해 복사 없이 읽고 쓸 수 있습니다.
+        class Slot {
+        public:
+            /// 레코드 메모리 위의 문자열 (StringBase 생성자 접근용)
+            class Text : public cms::StringBase {
+            public:
+                Text(char* buf, size_t capacity, size_t len) : cms::StringBase(buf, capacity, len) {}
+                Text(const Text& other) : cms::StringBase(other._buf, other._capacity, other._len) {}
+                using cms::StringBase::operator=;
+            };
+
+            /// LogEntry와 같은 이름(meta, text)으로 레코드에 접근하는 뷰
+            struct Entry {
+                cms::LogMeta& meta;
+                Text text;
+            };
+
+            /// 빈(무효) 핸들
+            Slot() : _valid(false) {}
+            /// 레코드 메모리를 가리키는 핸들
+            Slot(uint8_t* record, size_t textCapacity, size_t textLen) : _valid(true) {
+                new (_storage) Entry{*reinterpret_cast<cms::LogMeta*>(record),
+                                     Text(reinterpret_cast<char*>(record + sizeof(cms::LogMeta)), textCapacity, textLen)};
+            }
+            Slot(const Slot& other) : _valid(other._valid) { if (_valid) new (_storage) Entry(other.entry()); }
+            Slot& operator=(const Slot& other) {
+                _valid = other._valid;
+                if (_valid) new (_storage) Entry(other.entry());
+                return *this;
+            }
+
+            /// 유효한 레코드를 가리키는지 확인합니다.
+            explicit operator bool() const { return _valid; }
+
+            Entry* operator->() { return &entry(); }
+            const Entry* operator->() const { return &entry(); }
+
+            /// 레코드 시작 위치 (LogMeta)
+            uint8_t* record() const { return reinterpret_cast<uint8_t*>(&entry().meta); }
+
+        private:
+            Entry& entry() { return *std::launder(reinterpret_cast<Entry*>(_storage)); }
+            const Entry& entry() const { return *std::launder(reinterpret_cast<const Entry*>(_storage)); }
+
+            alignas(Entry) unsigned char _storage[sizeof(Entry)];
+            bool _valid;
+        };
+
+        /// 최대 M 바이트 로그를 기록할 레코드를 예약합니다.
+        Slot reserve() { return prepare(_ring.reserve(sizeof(cms::LogMeta) + M)); }
+
+        /// 오래된 로그를 버리지 않고 빈 공간에만 레코드를 예약합니다.
+        Slot tryReserve() { return prepare(_ring.tryReserve(sizeof(cms::LogMeta) + M)); }
+
+        /// 예약한 레코드를 공개하지 않고 반환합니다. (false: 뒤에 다른 예약이 있어 commit 필요)
+        bool cancel(const Slot& slot) { return _ring.cancel(slot.record()); }
+
+        /// 실제 사용한 크기(완성된 문자열 + 널 종료 문자, 또는 패킹된 인자)만큼만 레코드를 남기고 공개합니다.
+        void commit(const Slot& slot) {
+            const size_t body = (slot->meta.format != nullptr) ? slot->meta.argLen : slot->text.length() + 1;
+            _ring.commit(slot.record(), sizeof(cms::LogMeta) + body);
+        }
+
+        /// 가장 오래된 로그 레코드를 조회합니다.
+        Slot peek() {
+            Slot slot;
+            peekBatch(&slot, 1);
+            return slot;
+        }
+
+        /// peek()으로 조회한 레코드를 제거합니다.
+        void release(const Slot& slot) { (void)slot; _ring.releaseBatch(1); }
+
+        /// 가장 오래된 레코드부터 최대 maxCount개를 조회합니다. (최대 N개)
+        size_t peekBatch(Slot* outSlots, size_t maxCount) {
+            if (maxCount > N) maxCount = N;
+            uint8_t* records[N];
+            size_t lens[N];
+            const size_t n = _ring.peekBatch(records, lens, maxCount);
+            for (size_t i = 0; i < n; ++i) {
+                const cms::LogMeta& meta = *reinterpret_cast<const cms::LogMeta*>(records[i]);
+                const size_t body = lens[i] - sizeof(cms::LogMeta);
+                // 완성된 문자열은 널 종료 문자를 포함하여 저장됨
+                const size_t textLen = (meta.format != nullptr) ? 0 : body - 1;
+                outSlots[i] = Slot(records[i], body, textLen);
+            }
+            return n;
+        }
+
+        /// peekBatch()로 조회한 레코드들을 제거합니다.
+        void releaseBatch(const Slot* slots, size_t count) { (void)slots; _ring.releaseBatch(count); }
+
+        /// 로그 원소를 복사하여 추가합니다.
+        void enqueue(const cms::LogEntry<M>& item) {
+            Slot slot = reserve();
+            if (!slot) return;
+            slot->meta = item.meta;
+            if ((item.meta.format != nullptr)) memcpy(slot.record() + sizeof(cms::LogMeta), item.text.c_str(), item.meta.argLen);
+            else slot->text = item.text;
+            commit(slot);
+        }
+
+        /// 가장 오래된 로그 원소를 꺼내 복사합니다.
+        bool pop(cms::LogEntry<M>& outItem) {
+            Slot slot = peek();
+            if (!slot) return false;
+            outItem.meta = slot->meta;
+            if ((slot->meta.format != nullptr)) memcpy(outItem.text._data, slot.record() + sizeof(cms::LogMeta), slot->meta.argLen);
+            else outItem.text = slot->text.c_str();
+            release(slot);
+            return true;
+        }
+
+        /// 저장된 로그 줄 수 (기록 중인 레코드 포함)
+        size_t size() const { return _ring.size(); }
+        /// 비어있는지 확인합니다.
+        bool isEmpty() const { return _ring.isEmpty(); }
+        /// 링 버퍼 사용률 (%)
+        float utilization() const { return _ring.utilization(); }
+#ifdef CMS_ENABLE_PROFILING
+        /// 링 버퍼 최대 사용률 (%)
+        float peakUtilization() const { return _ring.peakUtilization(); }
+#endif
+
+    private:
+        /// 예약된 레코드를 빈 로그로 초기화한 슬롯 핸들 (record가 nullptr이면 빈 핸들)
+        static Slot prepare(uint8_t* record) {
+            if (!record) return Slot();
+            new (record) cms::LogMeta();
+            record[sizeof(cms::LogMeta)] = '\0';
+            return Slot(record, M, 0);
+        }
+
+        /// 고정 슬롯 큐와 같은 RAM을 사용하는 가변 길이 레코드 링
+        cms::ByteRing<M * N, cms::QueueFullPolicy::OverwriteOldest> _ring;
+    };
+
+// ==================================================================================================
+// [ShardedLogQueue] 개요
+// - 왜 존재하는가: 모든 코어/스레드가 하나의 큐를 공유하면 로그 호출마다 같은 뮤텍스와 인덱스 캐시 라인을 두고 경합하기 때문에 존재합니다.
+// - 어떻게 동작하는가: 생산자는 자기 코어(ESP32) 또는 스레드(native)에 배정된 shard 큐에만 기록하고,
+//   소비자는 각 shard의 가장 오래된 로그를 타임스탬프 순으로 병합하여 꺼냅니다.
+// ==================================================================================================
+
+    /// [CMS_LOG_SHARDS] ShardedLogQueue의 기본 shard 개수
+    ///
+    /// ESP32에서는 코어 수(portNUM_PROCESSORS), native에서는 4입니다. native에서 스레드가 shard보다 많으면
+    /// 스레드 ID 해시가 같은 스레드끼리 한 shard를 공유합니다. (shard 큐 자체는 다중 생산자에 안전)
+#ifndef CMS_LOG_SHARDS
+#ifdef ARDUINO
+#define CMS_LOG_SHARDS portNUM_PROCESSORS
+#else
+#define CMS_LOG_SHARDS 4
+#endif
+#endif
+
+    template <typename T, size_t N, size_t SHARDS = CMS_LOG_SHARDS>
+    class ShardedLogQueue;
+
+    /// 코어/스레드별 shard로 로그를 나누어 저장하는 AsyncLogger용 큐 정책입니다.
+    ///
+    /// Why: 두 코어(또는 여러 스레드)에서 동시에 로그를 남겨도 서로 다른 뮤텍스와 캐시 라인만 건드리게 하여 경합을 없애기 위함입니다.
+    /// How: shard마다 ThreadSafeQueue를 두고, 생산자는 ESP32에서 xPortGetCoreID(), native에서 스레드 ID로 shard를 고릅니다.
+    ///      소비자는 shard별로 완성된 로그를 한 번에 조회해 두고(peekBatch), 각 shard의 맨 앞 로그 중 LogMeta::stamp가
+    ///      가장 이른 것부터 내보냅니다. stamp가 같으면 shard 번호가 작은 쪽이 먼저이므로 출력 순서는 결정적입니다.
+    ///
+    /// @note 소비자(update/updateBatch)는 한 태스크여야 합니다. 병합 시점에 아직 보이지 않던 로그는 다음 병합에 포함되므로,
+    ///       기록이 오래 걸린 로그는 이미 출력된 더 늦은 로그 뒤에 나올 수 있습니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// // shard(코어)마다 16줄, 두 코어 합계 32줄
+    /// cms::AsyncLogger<256, 16, cms::ShardedLogQueue> logger;
+    /// @endcode
+    ///
+    /// @tparam M 로그 한 줄의 최대 바이트 크기 (LogEntry<M>)
+    /// @tparam N shard 하나의 큐 깊이 (한 번에 조회 가능한 최대 줄 수)
+    /// @tparam SHARDS shard 개수 (기본값: CMS_LOG_SHARDS)
+    template <size_t M, size_t N, size_t SHARDS>
+    class ShardedLogQueue<cms::LogEntry<M>, N, SHARDS> {
+        static_assert(SHARDS >= 1 && SHARDS <= 255, "cms::ShardedLogQueue SHARDS must be 1 ~ 255.");
+
+        using Entry = cms::LogEntry<M>;
+        using ShardQueue = cms::ThreadSafeQueue<Entry, N>;
+
+    public:
+        /// shard 번호를 함께 기억하는 슬롯 핸들입니다.
+        struct Slot {
+            Entry* entry = nullptr; ///< shard 큐 내부 원소
+            uint8_t shard = 0;      ///< 원소가 속한 shard
+
+            /// 유효한 원소를 가리키는지 확인합니다.
+            explicit operator bool() const { return entry != nullptr; }
+            Entry* operator->() const { return entry; }
+            Entry& operator*() const { return *entry; }
+        };
+
+        /// 현재 코어/스레드의 shard에 기록할 슬롯을 예약합니다.
+        Slot reserve() {
+            const uint8_t shard = currentShard();
+            Slot slot;
+            slot.entry = _shards[shard].queue.reserve();
+            slot.shard = shard;
+            return slot;
+        }
+
+        /// 현재 shard에 빈 자리가 있을 때만 슬롯을 예약합니다. (오래된 로그를 밀어내지 않음)
+        Slot tryReserve() {
+            const uint8_t shard = currentShard();
+            Slot slot;
+            slot.entry = _shards[shard].queue.tryReserve();
+            slot.shard = shard;
+            return slot;
+        }
+
+        /// reserve()로 예약한 슬롯의 기록 완료를 알립니다.
+        void commit(const Slot& slot) { _shards[slot.shard].queue.commit(slot.entry); }
+
+        /// 예약한 슬롯을 공개하지 않고 반환합니다. (false: 같은 shard에 뒤이은 예약이 있어 commit 필요)
+        bool cancel(const Slot& slot) { return _shards[slot.shard].queue.cancel(slot.entry); }
+
+        /// 모든 shard 중 stamp가 가장 이른 로그를 조회합니다.
+        Slot peek() {
+            Slot slot;
+            peekBatch(&slot, 1);
+            return slot;
+        }
+
+        /// peek()으로 조회한 로그를 제거합니다.
+        void release(const Slot& slot) { releaseBatch(&slot, 1); }
+
+        /// stamp 순으로 병합한 로그를 최대 maxCount개 조회합니다.
+        ///
+        /// How: 비어 있는 shard만 새로 조회하고, 이미 조회해 둔 로그는 releaseBatch() 전까지 Reading 상태로 유지합니다.
+        size_t peekBatch(Slot* outSlots, size_t maxCount) {
+            size_t cursor[SHARDS];
+            for (size_t s = 0; s < SHARDS; ++s) {
+                Shard& sh = _shards[s];
+                if (sh.heldBegin == sh.heldEnd) {
+                    sh.heldBegin = 0;
+                    sh.heldEnd = sh.queue.peekBatch(sh.held, N);
+                }
+                cursor[s] = sh.heldBegin;
+            }
+
+            size_t n = 0;
+            while (n < maxCount) {
+                size_t best = SHARDS;
+                uint32_t bestStamp = 0;
+                for (size_t s = 0; s < SHARDS; ++s) {
+                    if (cursor[s] == _shards[s].heldEnd) continue;
+                    const uint32_t stamp = _shards[s].held[cursor[s]]->meta.stamp;
+                    // uint32 tick 순환을 고려하여 차이의 부호로 비교
+                    if (best == SHARDS || (int32_t)(stamp - bestStamp) < 0) {
+                        best = s;
+                        bestStamp = stamp;
+                    }
+                }
+                if (best == SHARDS) break;
+                outSlots[n].entry = _shards[best].held[cursor[best]++];
+                outSlots[n].shard = (uint8_t)best;
+                n++;
+            }
+            return n;
+        }
+
+        /// peekBatch()로 조회한 로그들을 제거합니다. (shard별로 한 번의 뮤텍스 획득)
+        void releaseBatch(const Slot* slots, size_t count) {
+            size_t used[SHARDS] = {};
+            for (size_t i = 0; i < count; ++i) used[slots[i].shard]++;
+            for (size_t s = 0; s < SHARDS; ++s) {
+                if (used[s] == 0) continue;
+                _shards[s].queue.releaseBatch(nullptr, used[s]);
+                _shards[s].heldBegin += used[s];
+            }
+        }
+
+        /// 로그 원소를 복사하여 현재 shard에 추가합니다.
+        void enqueue(const Entry& item) {
+            Slot slot = reserve();
+            if (!slot) return;
+            *slot = item;
+            commit(slot);
+        }
+
+        /// stamp가 가장 이른 로그 원소를 꺼내 복사합니다.
+        bool pop(Entry& outItem) {
+            Slot slot = peek();
+            if (!slot) return false;
+            outItem = *slot;
+            release(slot);
+            return true;
+        }
+
+        /// 모든 shard에 저장된 로그 줄 수 (기록/조회 중인 슬롯 포함)
+        size_t size() const {
+            size_t total = 0;
+            for (const Shard& sh : _shards) total += sh.queue.size();
+            return total;
+        }
+        /// 모든 shard가 비어있는지 확인합니다.
+        bool isEmpty() const { return size() == 0; }
+
+        /// shard 통계의 합계를 조회합니다. (highWater, maxLockWaitUs는 shard 중 최댓값)
+        cms::QueueStats stats() const {
+            cms::QueueStats total;
+            for (const Shard& sh : _shards) {
+                const cms::QueueStats st = sh.queue.stats();
+                total.enqueued += st.enqueued;
+                total.overwritten += st.overwritten;
+                total.dropped += st.dropped;
+                total.contended += st.contended;
+                total.lockWaitUs += st.lockWaitUs;
+                if (st.highWater > total.highWater) total.highWater = st.highWater;
+                if (st.maxLockWaitUs > total.maxLockWaitUs) total.maxLockWaitUs = st.maxLockWaitUs;
+            }
+            return total;
+        }
+
+        /// 모든 shard의 통계를 초기화합니다.
+        void resetStats() {
+            for (Shard& sh : _shards) sh.queue.resetStats();
+        }
+
+    private:
+        /// shard 하나: 생산자가 쓰는 큐와 소비자만 쓰는 조회 목록
+        ///
+        /// shard 간 False Sharing을 막기 위해 캐시 라인 단위로 정렬합니다.
+        struct alignas(CMS_CACHE_LINE_SIZE) Shard {
+            ShardQueue queue;
+            Entry* held[N];      ///< peekBatch로 조회해 둔 로그 (오래된 순)
+            size_t heldBegin = 0; ///< 아직 제거하지 않은 첫 조회 항목
+            size_t heldEnd = 0;   ///< 조회 항목 끝
+        };
+
+        /// 현재 코어(ESP32) 또는 스레드(native)에 배정된 shard 번호
+        static uint8_t currentShard() {
+#ifdef ARDUINO
+            return (uint8_t)((size_t)xPortGetCoreID() % SHARDS);
+#else
+            // 스레드마다 한 번만 해시를 계산
+            thread_local const size_t hashed = std::hash<std::thread::id>()(std::this_thread::get_id());
+            return (uint8_t)(hashed % SHARDS);
+#endif
+        }
+
+        Shard _shards[SHARDS];
     };
 
 // ==================================================================================================
@@ -145,11 +1092,19 @@ namespace cms {
     /// AsyncLogger의 역할 요약
     ///
     /// Why: 로깅 성능 최적화 및 스레드 안전한 로그 수집을 위함입니다.
-    /// How: 템플릿 인자로 지정된 크기의 정적 큐와 스택 버퍼를 관리합니다.
+    /// How: 템플릿 인자로 지정된 크기의 정적 큐를 관리하며, 로그는 큐 슬롯 안에서 직접 조립되어 호출자 스택을 거의 쓰지 않습니다.
     ///
     /// @tparam MSG_SIZE 로그 한 줄의 최대 바이트 크기
     /// @tparam QUEUE_DEPTH 로그 큐에 저장할 수 있는 최대 메시지 개수
-    template <uint16_t MSG_SIZE = 256, uint8_t QUEUE_DEPTH = 16>
+    /// @tparam QueuePolicy 로그 큐 구현 (기본값: ThreadSafeQueue, 생산/소비 태스크가 하나씩이면 SpscQueue 권장)
+    ///
+    /// 사용 예:
+    /// @code
+    /// // 뮤텍스 없는 SPSC 큐를 사용하는 로거 (QUEUE_DEPTH는 2의 거듭제곱)
+    /// cms::AsyncLogger<256, 16, cms::SpscQueue> logger;
+    /// @endcode
+    template <uint16_t MSG_SIZE = 256, uint8_t QUEUE_DEPTH = 16,
+              template <typename, size_t> class QueuePolicy = cms::ThreadSafeQueue>
     class AsyncLogger : public LoggerBase {
     public:
         /// [instance] 싱글톤 인스턴스 접근
@@ -158,28 +1113,166 @@ namespace cms {
             return inst;
         }
 
+        /// 로그 메시지를 보관하는 큐 타입 (QueuePolicy로 구현 선택)
+        using QueueType = QueuePolicy<cms::LogEntry<MSG_SIZE>, QUEUE_DEPTH>;
+        /// 큐 슬롯 핸들 타입
+        using Slot = typename QueueType::Slot;
+
+        /// [LOG_STACK_BYTES] 큐에 빈 자리가 있을 때 로그 호출(d/i/w/e/log) 한 번이 호출자 스택에 두는 메시지 버퍼 크기
+        ///
+        /// 메시지는 큐 슬롯 안에서 직접 조립(또는 인자 패킹)되므로 슬롯 핸들만 스택에 놓입니다.
+        /// 포맷터 내부의 지역 변수(수십 바이트)와 함수 호출 프레임은 포함하지 않습니다.
+        /// 큐가 가득 찬 경우의 최악값은 LOG_FULL_STACK_BYTES입니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// static_assert(Logger::LOG_STACK_BYTES < 64, "로그 태스크 스택 예산 초과");
+        /// @endcode
+        static constexpr size_t LOG_STACK_BYTES = sizeof(Slot);
+        /// [LOG_FULL_STACK_BYTES] 큐가 가득 찬 경우 로그 호출 한 번의 최악 스택 버퍼 크기
+        ///
+        /// 덮어쓰기/대기 전에 handleLog 판정을 끝내야 하므로 즉시 모드에서는 메시지를 스택에서 먼저 조립합니다.
+        static constexpr size_t LOG_FULL_STACK_BYTES = sizeof(Slot) + sizeof(cms::String<MSG_SIZE>) + sizeof(LogMeta);
+        /// [UPDATE_STACK_BYTES] update() 한 번의 최악 스택 버퍼 크기 (지연 포맷팅 렌더링 포함)
+        static constexpr size_t UPDATE_STACK_BYTES = sizeof(Slot) + 3 * sizeof(cms::String<MSG_SIZE>);
+        /// [UPDATE_BATCH_STACK_BYTES] updateBatch() 한 번의 최악 스택 버퍼 크기
+        static constexpr size_t UPDATE_BATCH_STACK_BYTES =
+            QUEUE_DEPTH * (sizeof(Slot) + sizeof(const cms::StringBase*)) + 3 * sizeof(cms::String<MSG_SIZE>);
+
         /// [pushToQueue] 가공된 로그를 큐에 수동 투입
         ///
         /// handleLog() 내부에서 메시지를 변형한 후 다시 큐에 넣을 때 주로 사용합니다.
-        void pushToQueue(const cms::String<MSG_SIZE>& logMsg) { _queue.enqueue(logMsg); }
+        void pushToQueue(const cms::String<MSG_SIZE>& logMsg);
 
         /// [update] 보류된 로그 처리
         ///
-        /// 비동기 큐에 쌓여있는 로그 메시지를 하나 꺼내어 실제 출력 장치(outputLog)로 전송합니다.
-        /// @return true: 로그를 하나 처리함, false: 처리할 로그가 없음
+        /// 비동기 큐에 쌓여있는 가장 오래된 로그 슬롯을 복사 없이 출력 장치(outputLog)로 전달한 뒤 반환합니다.
+        /// 지연 포맷팅 원소는 이 시점에 포맷팅 및 handleLog 필터링을 거칩니다.
+        /// @return true: 슬롯을 하나 처리함, false: 처리할 로그가 없음
         bool update();
 
+        /// [updateWait] 로그가 들어올 때까지 잠들었다가 하나를 처리
+        ///
+        /// 출력 태스크가 `while (update())` 폴링이나 주기적 sleep 없이, 대기 중에는 CPU를 쓰지 않고
+        /// 첫 로그가 기록되는 즉시 깨어나 출력하게 합니다. QueuePolicy가 peekWait()를 제공해야 합니다. (ThreadSafeQueue, BlockingQueue)
+        ///
+        /// 사용 예:
+        /// @code
+        /// void logTask(void*) {
+        ///     for (;;) {
+        ///         if (logger.updateWait(cms::WAIT_FOREVER)) while (logger.update()) {}
+        ///     }
+        /// }
+        /// @endcode
+        ///
+        /// @param timeoutMs 최대 대기 시간 (밀리초, WAIT_FOREVER: 무제한)
+        /// @return true: 슬롯을 하나 처리함, false: 시간 초과
+        bool updateWait(uint32_t timeoutMs);
+
+        /// [updateBatch] 보류된 로그 일괄 처리
+        ///
+        /// 큐 잠금을 한 번만 획득하여 최대 maxMessages개의 로그를 꺼내고, 메시지 길이의 합이 maxBytes를
+        /// 넘지 않는 묶음 단위로 outputLogBatch()에 전달합니다. (maxBytes보다 긴 메시지는 단독 묶음)
+        ///
+        /// 사용 예:
+        /// @code
+        /// // UDP 패킷 하나(약 1400바이트)에 들어갈 만큼씩 묶어 전송
+        /// while (logger.updateBatch(16, 1400) > 0) {}
+        /// @endcode
+        ///
+        /// @param maxMessages 한 번에 꺼낼 최대 메시지 개수 (QUEUE_DEPTH로 제한)
+        /// @param maxBytes outputLogBatch() 한 번에 전달할 최대 바이트 수
+        /// @return 처리한 슬롯 개수 (0: 처리할 로그가 없음)
+        size_t updateBatch(size_t maxMessages = QUEUE_DEPTH, size_t maxBytes = SIZE_MAX);
+
+        /// [flushSuppressed] 아직 요약되지 않은 반복/속도 제한 개수를 요약 로그로 큐에 남김
+        ///
+        /// 폭주가 멈춘 뒤 같은 호출 위치가 다시 로그를 남기지 않으면 요약이 나오지 않으므로,
+        /// 주기 작업이나 재부팅 직전에 호출하여 남은 개수를 기록합니다.
+        /// @note 로그를 남기는 쪽(생산자)에서 호출하세요. SpscQueue 사용 시 update() 태스크에서 호출하면 안 됩니다.
+        void flushSuppressed();
+
+        /// [queue] 내부 로그 큐 조회
+        ///
+        /// 큐 사용량(size, utilization 등)을 모니터링할 때 사용합니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// float usage = logger.queue().utilization(); // LogRingQueue 사용 시
+        /// @endcode
+        const QueueType& queue() const { return _queue; }
+
+        /// [queue] 내부 로그 큐 설정용 접근
+        ///
+        /// 사용 예:
+        /// @code
+        /// logger.queue().setBlockTimeout(20); // BlockingQueue: 로그 생산자가 최대 20ms 대기
+        /// @endcode
+        QueueType& queue() { return _queue; }
+
+        /// [stats] 로거와 큐의 운영 통계 조회
+        ///
+        /// LoggerBase::stats()에 큐가 제공하는 덮어쓰기 횟수, 최대 깊이(High Water Mark), 뮤텍스 대기 시간을 합칩니다.
+        /// highWater가 QUEUE_DEPTH에 닿고 overwritten이 늘어난다면 QUEUE_DEPTH를 키우거나 update() 주기를 줄여야 합니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// cms::LogStats st = logger.stats();
+        /// printf("hw=%u/%u lost=%u\n", (unsigned)st.highWater, 16u, (unsigned)(st.overwritten + st.dropped));
+        /// @endcode
+        LogStats stats() const noexcept {
+            LogStats st = LoggerBase::stats();
+            if constexpr (HasQueueStats<QueueType>::value) {
+                const cms::QueueStats q = _queue.stats();
+                st.overwritten = q.overwritten;
+                st.highWater = q.highWater;
+                st.contended = q.contended;
+                st.lockWaitUs = q.lockWaitUs;
+                st.maxLockWaitUs = q.maxLockWaitUs;
+            }
+            return st;
+        }
+
+        /// [resetStats] 로거와 큐의 운영 통계 초기화
+        void resetStats() noexcept {
+            LoggerBase::resetStats();
+            if constexpr (HasQueueStats<QueueType>::value) _queue.resetStats();
+        }
+
     protected:
-        /// [dispatchLog] 문자열을 큐에 저장 가능한 객체로 변환하여 전달
-        void dispatchLog(const char* msg) override;
-        /// [dispatchLog] 실제 큐 저장 로직 (handleLog 필터링 포함)
-        virtual void dispatchLog(const cms::String<MSG_SIZE>& logMsg);
-        /// [vlog] 템플릿 크기에 맞는 스택 버퍼를 생성하여 가공 로직 호출
+        /// [vlog] 큐 슬롯을 예약하여 제자리에서 가공 로직 호출
+        ///
+        /// 슬롯 예약 → 슬롯에 직접 조립(또는 지연 모드에서 인자 패킹) → handleLog 필터링 → commit 순서로 동작합니다.
+        /// handleLog가 가로챈 로그는 cancel()로 예약을 반환하므로 큐 공간을 차지하지 않습니다.
+        /// (다른 태스크가 뒤이어 예약한 경우에만 빈 슬롯으로 commit되어 update()에서 건너뜀)
         void vlog(LogLevel level, const char* format, va_list args) override;
 
     private:
-        /// 로그 메시지를 보관하는 스레드 안전 원형 큐
-        cms::ThreadSafeQueue<cms::String<MSG_SIZE>, QUEUE_DEPTH> _queue;
+        /// [vlogFull] 큐가 가득 찼을 때의 vlog (스택에서 조립과 handleLog 판정을 먼저 끝낸 뒤에만 덮어쓰거나 기다림)
+        ///
+        /// 메시지 버퍼가 이 함수 프레임에만 있도록 인라인하지 않습니다. (빈 자리가 있는 평상시 vlog 프레임은 작게 유지)
+        CMS_NOINLINE void vlogFull(LogLevel level, const char* format, va_list args);
+
+        /// [outputSlot] 조회한 슬롯 하나를 출력하고 큐에서 제거 (update/updateWait 공통)
+        void outputSlot(Slot& slot);
+
+        /// [emit] 로그 한 줄을 sink들 또는 outputLog()로 출력
+        void emit(const cms::StringBase& msg, LogLevel level);
+
+        /// [idle] 큐가 비었을 때의 처리 (크래시 로그 재출력, sink tick)
+        void idle();
+
+        /// [enqueueNote] 억제 요약을 큐에 추가
+        void enqueueNote(const SuppressNote& note);
+
+        /// 큐 정책이 stats()/resetStats()를 제공하는지 검사 (ThreadSafeQueue)
+        template <typename Q, typename = void>
+        struct HasQueueStats : std::false_type {};
+        template <typename Q>
+        struct HasQueueStats<Q, std::void_t<decltype(std::declval<const Q&>().stats())>> : std::true_type {};
+
+        /// 로그 메시지를 보관하는 큐
+        QueueType _queue;
     };
 } // namespace cms
 
@@ -8,41 +8,230 @@
 namespace cms {
 
     /// [update] 템플릿 클래스 전용 큐 펌프 구현
-    template <uint16_t MSG_SIZE, uint8_t QUEUE_DEPTH>
-    bool AsyncLogger<MSG_SIZE, QUEUE_DEPTH>::update() {
-        cms::String<MSG_SIZE> msg;
-        if (_queue.pop(msg)) {
+    template <uint16_t MSG_SIZE, uint8_t QUEUE_DEPTH, template <typename, size_t> class QueuePolicy>
+    bool AsyncLogger<MSG_SIZE, QUEUE_DEPTH, QueuePolicy>::update() {
+        Slot slot = _queue.peek();
+        if (!slot) {
+            idle();
+            return false;
+        }
+        outputSlot(slot);
+        return true;
+    }
+
+    /// [updateWait] 블로킹 큐 펌프 구현
+    template <uint16_t MSG_SIZE, uint8_t QUEUE_DEPTH, template <typename, size_t> class QueuePolicy>
+    bool AsyncLogger<MSG_SIZE, QUEUE_DEPTH, QueuePolicy>::updateWait(uint32_t timeoutMs) {
+        Slot slot = _queue.peekWait(timeoutMs);
+        if (!slot) {
+            idle();
+            return false;
+        }
+        outputSlot(slot);
+        return true;
+    }
+
+    /// [outputSlot] 슬롯 하나의 렌더링/출력/제거 구현
+    template <uint16_t MSG_SIZE, uint8_t QUEUE_DEPTH, template <typename, size_t> class QueuePolicy>
+    void AsyncLogger<MSG_SIZE, QUEUE_DEPTH, QueuePolicy>::outputSlot(Slot& slot) {
+        const uint32_t stamp = slot->meta.stamp;
+        const LogLevel level = slot->meta.level;
+        if (isDeferredEntry(slot->meta)) {
+            cms::String<MSG_SIZE> body;
+            if (slot->text.capacity() >= MSG_SIZE) {
+                // 고정 슬롯: 패킹된 인자를 body로 풀어낸 뒤 슬롯 자체에 최종 로그를 조립
+                if (renderDeferred(slot->meta, slot->text, slot->text, body)) {
+                    recordOutput(stamp, currentStamp());
+                    emit(slot->text, level);
+                }
+            } else {
+                // 가변 길이 레코드: 레코드에 여유 공간이 없으므로 별도 버퍼에 조립
+                cms::String<MSG_SIZE> rendered;
+                if (renderDeferred(slot->meta, slot->text, rendered, body)) {
+                    recordOutput(stamp, currentStamp());
+                    emit(rendered, level);
+                }
+            }
+        } else if (!slot->text.isEmpty()) {
+            // handleLog가 가로챈 로그는 빈 슬롯으로 남아 있으므로 출력하지 않음
+            recordOutput(stamp, currentStamp());
+            emit(slot->text, level);
+        }
+        _queue.release(slot);
+    }
+
+    /// [emit] 출력 경로 선택 구현 (sink 미등록 시 기존 outputLog 그대로)
+    template <uint16_t MSG_SIZE, uint8_t QUEUE_DEPTH, template <typename, size_t> class QueuePolicy>
+    void AsyncLogger<MSG_SIZE, QUEUE_DEPTH, QueuePolicy>::emit(const cms::StringBase& msg, LogLevel level) {
+        if (!hasSinks()) {
             outputLog(msg);
-            return true;
+            return;
         }
-        return false;
+        cms::String<MSG_SIZE> plain; // 색상 없는 sink용 사본 (필요할 때만 채워짐)
+        dispatchToSinks(msg, level, plain);
     }
 
-    /// [vlog] 템플릿 크기에 최적화된 스택 버퍼 할당 및 가공 요청
-    template <uint16_t MSG_SIZE, uint8_t QUEUE_DEPTH>
-    void AsyncLogger<MSG_SIZE, QUEUE_DEPTH>::vlog(LogLevel level, const char* format, va_list args) {
-        if (level < _runtimeLevel) return;
+    /// [idle] 유휴 처리 구현 (재출력 버퍼는 복구 줄이 남아 있을 때만 스택에 잡힘)
+    template <uint16_t MSG_SIZE, uint8_t QUEUE_DEPTH, template <typename, size_t> class QueuePolicy>
+    void AsyncLogger<MSG_SIZE, QUEUE_DEPTH, QueuePolicy>::idle() {
+        if (_replaySource) {
+            cms::String<MSG_SIZE> line;
+            cms::String<MSG_SIZE> plain;
+            replayCrashLines(line, plain);
+        }
+        tickSinks();
+    }
+
+    /// [updateBatch] 슬롯 묶음을 한 번에 꺼내 바이트 한도 단위로 일괄 출력
+    template <uint16_t MSG_SIZE, uint8_t QUEUE_DEPTH, template <typename, size_t> class QueuePolicy>
+    size_t AsyncLogger<MSG_SIZE, QUEUE_DEPTH, QueuePolicy>::updateBatch(size_t maxMessages, size_t maxBytes) {
+        if (maxMessages > QUEUE_DEPTH) maxMessages = QUEUE_DEPTH;
+
+        Slot slots[QUEUE_DEPTH];
+        const size_t n = _queue.peekBatch(slots, maxMessages);
+        if (n == 0) {
+            idle();
+            return 0;
+        }
+        const bool toSinks = hasSinks();
+        const uint32_t now = currentStamp(); // 묶음 전체의 출력 시각 (지연 통계용)
+
+        const cms::StringBase* msgs[QUEUE_DEPTH];
+        size_t count = 0;
+        size_t bytes = 0;
+        cms::String<MSG_SIZE> body;     // 지연 로그 본문 포맷팅용
+        cms::String<MSG_SIZE> rendered; // 제자리 조립이 불가능한 레코드(가변 길이 링)용
+        bool renderedInUse = false;
 
-        cms::String<MSG_SIZE> finalLog;
-        cms::String<MSG_SIZE> rawBody;
+        for (size_t i = 0; i < n; ++i) {
+            const cms::StringBase* msg = &slots[i]->text;
+            const uint32_t stamp = slots[i]->meta.stamp;
+            if (isDeferredEntry(slots[i]->meta)) {
+                cms::StringBase* dst = &slots[i]->text;
+                if (dst->capacity() < MSG_SIZE) {
+                    // 공용 버퍼가 이미 묶음에 포함되어 있으면 먼저 내보낸 뒤 재사용
+                    if (renderedInUse) {
+                        outputLogBatch(msgs, count);
+                        count = 0;
+                        bytes = 0;
+                    }
+                    dst = &rendered;
+                    renderedInUse = true;
+                }
+                if (!renderDeferred(slots[i]->meta, slots[i]->text, *dst, body)) continue;
+                msg = dst;
+            } else if (msg->isEmpty()) {
+                continue; // handleLog가 가로챈 빈 슬롯
+            }
 
-        // 베이스 클래스의 공통 로직 호출
-        LoggerBase::logV(finalLog, rawBody, level, format, args);
+            if (toSinks) {
+                // sink는 메시지 단위로 받으므로 묶지 않고 바로 분배 (공용 버퍼도 즉시 재사용 가능)
+                recordOutput(stamp, now);
+                emit(*msg, slots[i]->meta.level);
+                renderedInUse = false;
+                continue;
+            }
+
+            // 현재 묶음에 더하면 한도를 넘는 경우 먼저 내보냄
+            if (count > 0 && bytes + msg->length() > maxBytes) {
+                const bool holdsRendered = renderedInUse && msg == &rendered;
+                outputLogBatch(msgs, count);
+                count = 0;
+                bytes = 0;
+                renderedInUse = holdsRendered;
+            }
+            msgs[count++] = msg;
+            bytes += msg->length();
+            recordOutput(stamp, now);
+        }
+        if (count > 0) outputLogBatch(msgs, count);
+
+        _queue.releaseBatch(slots, n);
+        return n;
+    }
+
+    /// [pushToQueue] 완성된 로그 문자열을 새 슬롯에 복사
+    template <uint16_t MSG_SIZE, uint8_t QUEUE_DEPTH, template <typename, size_t> class QueuePolicy>
+    void AsyncLogger<MSG_SIZE, QUEUE_DEPTH, QueuePolicy>::pushToQueue(const cms::String<MSG_SIZE>& logMsg) {
+        Slot slot = _queue.reserve();
+        if (!slot) {
+            countStat(_statDropped);
+            return;
+        }
+        slot->meta = cms::LogMeta();
+        slot->meta.stamp = currentStamp();
+        slot->text = logMsg;
+        _queue.commit(slot);
+    }
+
+    /// [vlog] 큐 슬롯 예약 후 슬롯에 직접 로그 조립 (또는 인자 패킹)
+    template <uint16_t MSG_SIZE, uint8_t QUEUE_DEPTH, template <typename, size_t> class QueuePolicy>
+    void AsyncLogger<MSG_SIZE, QUEUE_DEPTH, QueuePolicy>::vlog(LogLevel level, const char* format, va_list args) {
+        if (level < LOG_MIN_LEVEL || level < _runtimeLevel) return;
+        if (suppressionEnabled()) {
+            SuppressNote note;
+            const bool admit = admitLog(level, format, note);
+            enqueueNote(note); // 요약은 새 로그보다 먼저
+            if (!admit) return;
+        }
+        countStat(_statProduced);
+
+        // 즉시 모드는 handleLog가 가로챌 수 있으므로 빈 자리에만 예약 (가득 찼으면 판정 후에만 덮어쓰거나 기다림)
+        Slot slot = _deferred ? _queue.reserve() : _queue.tryReserve();
+        if (!slot) {
+            if (_deferred) countStat(_statDropped); // 공간이 없음: 새 로그 버림
+            else vlogFull(level, format, args);
+            return;
+        }
+
+        // 즉시 모드는 슬롯에 직접 조립, 지연 모드는 인자만 패킹 (어느 쪽도 스택 메시지 버퍼 없음)
+        if (captureV(slot->meta, slot->text, level, format, args)) {
+            _queue.commit(slot);
+            return;
+        }
+        // 저장하지 않는 로그는 예약을 반환 (뒤이은 예약이 있어 반환할 수 없으면 빈 슬롯으로 공개되어 update()가 건너뜀)
+        if (!_queue.cancel(slot)) _queue.commit(slot);
+    }
+
+    /// [vlogFull] 가득 찬 큐의 로그 기록 구현 (handleLog 판정 전에는 기존 로그를 밀어내지 않음)
+    template <uint16_t MSG_SIZE, uint8_t QUEUE_DEPTH, template <typename, size_t> class QueuePolicy>
+    void AsyncLogger<MSG_SIZE, QUEUE_DEPTH, QueuePolicy>::vlogFull(LogLevel level, const char* format, va_list args) {
+        LogMeta meta;
+        cms::String<MSG_SIZE> line;
+        if (!captureV(meta, line, level, format, args)) return;
+
+        Slot slot = _queue.reserve();
+        if (!slot) {
+            countStat(_statDropped);
+            return;
+        }
+        slot->meta = meta;
+        slot->text = line;
+        _queue.commit(slot);
     }
 
-    /// [dispatchLog] const char*를 템플릿 객체로 래핑하여 전달
-    template <uint16_t MSG_SIZE, uint8_t QUEUE_DEPTH>
-    void AsyncLogger<MSG_SIZE, QUEUE_DEPTH>::dispatchLog(const char* msg) {
-        cms::String<MSG_SIZE> s = msg;
-        dispatchLog(s);
+    /// [enqueueNote] 억제 요약 큐 추가 구현 (요약은 억제 단계를 거치지 않음)
+    template <uint16_t MSG_SIZE, uint8_t QUEUE_DEPTH, template <typename, size_t> class QueuePolicy>
+    void AsyncLogger<MSG_SIZE, QUEUE_DEPTH, QueuePolicy>::enqueueNote(const SuppressNote& note) {
+        for (int part = 0; part < 2; ++part) {
+            const bool limitPart = (part == 1);
+            if (limitPart ? note.limited == 0 : note.format == nullptr) continue;
+            Slot slot = _queue.reserve();
+            if (!slot) {
+                countStat(_statDropped);
+                continue;
+            }
+            if (captureNote(slot->meta, slot->text, note, limitPart) || !_queue.cancel(slot)) _queue.commit(slot);
+        }
     }
 
-    /// [dispatchLog] handleLog 필터링 후 최종 큐 저장 수행
-    template <uint16_t MSG_SIZE, uint8_t QUEUE_DEPTH>
-    void AsyncLogger<MSG_SIZE, QUEUE_DEPTH>::dispatchLog(const cms::String<MSG_SIZE>& logMsg) {
-        if (!handleLog(logMsg)) {
-            // handleLog가 false를 반환한 경우에만 기본 큐에 저장합니다.
-            _queue.enqueue(logMsg);
+    /// [flushSuppressed] 남은 억제 개수 요약 구현
+    template <uint16_t MSG_SIZE, uint8_t QUEUE_DEPTH, template <typename, size_t> class QueuePolicy>
+    void AsyncLogger<MSG_SIZE, QUEUE_DEPTH, QueuePolicy>::flushSuppressed() {
+        SuppressNote note;
+        for (size_t i = 0; takeSuppressed(i, note); ++i) {
+            enqueueNote(note);
+            note = SuppressNote();
         }
     }
 
@@ -0,0 +1,117 @@
+/// @author comser.dev
+///
+/// 컴파일 타임에 만들고 결합할 수 있는 불변 고정 길이 문자열입니다.
+/// 태그, 접두사처럼 내용이 빌드 시점에 정해지는 문자열을 .rodata에 두고 길이와 DJB2 해시를 미리 계산합니다.
+
+#pragma once // 중복 포함 방지
+
+#include <stddef.h> // size_t 정의
+#include <stdint.h> // uint32_t 정의
+#include "cmsStringUtil.h" // cms::string::djb2
+
+namespace cms {
+
+// ==================================================================================================
+// [FixedString] 개요
+// - 왜 존재하는가: "[RETRY-SYSTEM] " 같은 상수 접두사나 태그를 String<N>으로 만들면 매번 실행 중에 복사하고,
+//   태그 색상 해시도 실행 중에 다시 계산합니다. 이런 상수를 빌드 단계에서 완성하여 읽기 전용 메모리에 두기 위해 존재합니다.
+// - 어떻게 동작하는가: 리터럴 타입(literal type)이라 constexpr 변수로 선언하면 내용이 상수 초기화되며,
+//   operator+는 길이가 합쳐진 새 FixedString을 constexpr로 만듭니다. C++17에서는 클래스 타입을 템플릿 인자로 쓸 수 없으므로
+//   정적 constexpr 객체의 참조(template <const auto& S>)를 템플릿 인자로 넘깁니다.
+//
+// 사용 예:
+// @code
+// static constexpr cms::FixedString kRetryTag{"[RETRY-SYSTEM]"};
+// static constexpr auto kRetryPrefix = kRetryTag + " ";              // "[RETRY-SYSTEM] " (컴파일 타임 결합)
+// static_assert(kRetryPrefix.length() == 15, "");
+//
+// cms::String<128> msg = kRetryPrefix;                               // 길이가 상수인 memcpy 한 번
+// logger.setTagColor<kRetryTag>("93");                               // 태그 해시도 컴파일 타임에 계산
+// @endcode
+// ==================================================================================================
+
+    /// 컴파일 타임 고정 문자열입니다.
+    ///
+    /// Why: 상수 문자열의 길이/해시/결합을 실행 시간이 아닌 빌드 시간에 끝내기 위함입니다.
+    /// How: 널 종료 문자를 포함한 N바이트 배열을 값으로 소유합니다. 내용은 생성 후 바뀌지 않으며 길이는 항상 N - 1입니다.
+    ///
+    /// @tparam N 널 종료 문자를 포함한 크기 (리터럴에서 자동 추론)
+    template <size_t N>
+    class FixedString {
+        static_assert(N > 0, "cms::FixedString size N must be at least 1 for the null terminator.");
+
+    public:
+        /// 문자열 리터럴로부터 생성합니다. (NUL 포함 N바이트 복사)
+        constexpr FixedString(const char (&src)[N]) noexcept {
+            for (size_t i = 0; i < N; ++i) _data[i] = src[i];
+        }
+
+        /// [length] 바이트 길이 (널 종료 문자 제외, 컴파일 타임 상수)
+        static constexpr size_t length() noexcept { return N - 1; }
+
+        /// [isEmpty] 빈 문자열 여부
+        static constexpr bool isEmpty() noexcept { return N == 1; }
+
+        /// [c_str] 널 종료 문자열 포인터
+        constexpr const char* c_str() const noexcept { return _data; }
+        constexpr operator const char*() const noexcept { return _data; }
+
+        /// [operator[]] 바이트 단위 읽기
+        constexpr char operator[](size_t i) const noexcept { return _data[i]; }
+
+        /// [hash] 전체 내용의 DJB2 해시 (StringBase::hash와 같은 값)
+        constexpr uint32_t hash(bool ignoreCase = false) const noexcept {
+            return cms::string::djb2(_data, N - 1, ignoreCase);
+        }
+
+        /// [tagHash] 로거 태그 색상 해시
+        ///
+        /// "[Net] ..."처럼 '['로 시작하면 첫 번째 괄호 안쪽, 아니면 전체 내용을 대소문자 무시 DJB2로 계산합니다.
+        /// 로거가 본문의 [TAG]에서 계산하는 값, setTagColor("Net", ...)가 등록하는 값과 같습니다.
+        constexpr uint32_t tagHash() const noexcept {
+            size_t begin = 0;
+            size_t end = N - 1;
+            if (N > 1 && _data[0] == '[') {
+                begin = 1;
+                end = begin;
+                while (end < N - 1 && _data[end] != ']') ++end;
+            }
+            return cms::string::djb2(_data + begin, end - begin, true);
+        }
+
+        /// [operator+] 두 고정 문자열을 결합한 새 고정 문자열
+        template <size_t M>
+        constexpr FixedString<N + M - 1> operator+(const FixedString<M>& rhs) const noexcept {
+            return FixedString<N + M - 1>(_data, N - 1, rhs.c_str(), M - 1);
+        }
+
+        /// [operator+] 리터럴을 결합한 새 고정 문자열
+        template <size_t M>
+        constexpr FixedString<N + M - 1> operator+(const char (&rhs)[M]) const noexcept {
+            return FixedString<N + M - 1>(_data, N - 1, rhs, M - 1);
+        }
+
+    private:
+        template <size_t> friend class FixedString;
+
+        /// 결합 전용 생성자 (a + b, 길이 합은 N - 1)
+        constexpr FixedString(const char* a, size_t aLen, const char* b, size_t bLen) noexcept {
+            for (size_t i = 0; i < aLen; ++i) _data[i] = a[i];
+            for (size_t i = 0; i < bLen; ++i) _data[aLen + i] = b[i];
+            _data[aLen + bLen] = '\0';
+        }
+
+        char _data[N] = {};
+    };
+
+    /// 리터럴 → FixedString<N> 추론 (cms::FixedString tag{"[Net]"})
+    template <size_t N>
+    FixedString(const char (&)[N]) -> FixedString<N>;
+
+    /// [operator+] 리터럴 + 고정 문자열
+    template <size_t M, size_t N>
+    constexpr FixedString<M + N - 1> operator+(const char (&lhs)[M], const FixedString<N>& rhs) noexcept {
+        return FixedString<M>(lhs) + rhs;
+    }
+
+} // namespace cms
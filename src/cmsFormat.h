@@ -0,0 +1,261 @@
+/// @author comser.dev
+///
+/// 포맷 문자열을 컴파일 타임에 해석하는 printf 스타일 포맷팅 프런트엔드입니다.
+/// 지정자와 인자 타입을 컴파일 중에 검사하고, 실행 시에는 지정자 해석 없이 리터럴 복사와 값 직렬화만 수행합니다.
+
+#pragma once // 중복 포함 방지
+
+#include <stddef.h>     // size_t
+#include <stdint.h>     // uint64_t
+#include <cstring>      // strlen
+#include <tuple>        // std::forward_as_tuple, std::get
+#include <type_traits>  // std::is_integral, std::is_floating_point
+#include <utility>      // std::index_sequence
+#include "cmsStringUtil.h"
+
+// ==================================================================================================
+// [format] 개요
+// - 왜 존재하는가: appendPrintf는 호출마다 포맷 문자열을 한 글자씩 해석하고 va_list로 인자를 꺼내므로,
+//   초당 수천 줄의 센서 JSON을 만드는 경로에서 해석 비용을 없애고 잘못된 인자 타입을 빌드 단계에서 잡기 위해 존재합니다.
+// - 어떻게 동작하는가: constexpr 함수가 포맷을 (리터럴, 지정자) 조각 배열로 분해하고,
+//   조각마다 인자 타입에 맞는 직렬화 함수(appendInt/appendHex/appendFloat 등) 호출을 펼쳐서 생성합니다.
+//
+// 지원 지정자는 appendPrintf와 같습니다: %s %d %u %x %X %f %c %% (플래그 '0', 너비, 정밀도 .N, 'l' 한정자)
+// 너비/'0' 플래그는 %d %u %x %X %f에, 정밀도는 %f에만(최대 9) 적용됩니다. 출력에 반영되지 않는 조합(%5s, %.3d, %-5d 등)과
+// 잘못된 지정자, 인자 개수 불일치, 타입 불일치(예: %d에 실수)는 모두 컴파일 오류입니다.
+// 정밀도를 생략한 %f는 printf(6자리)와 달리 소수점 2자리로 출력하며, 중간값은 0에서 먼 쪽으로 반올림합니다.
+//
+// 사용 예:
+// @code
+// static constexpr char kTempJson[] = "{\"id\":%d,\"t\":%.1f,\"raw\":\"0x%04X\"}";
+// json.format<kTempJson>(id, temp, raw);                          // 기존 내용을 지우고 작성
+// CMS_APPEND_FORMAT(line, ",\"rssi\":%d", rssi);                  // 리터럴을 바로 쓰는 매크로 형태
+// @endcode
+//
+// @note C++17에서는 문자열 리터럴을 템플릿 인자로 쓸 수 없으므로, 정적 constexpr char 배열을 넘기거나 매크로를 사용합니다.
+// ==================================================================================================
+
+/// 리터럴 포맷으로 기존 내용을 지우고 작성합니다. (StringBase::format)
+#define CMS_FORMAT(target, fmt, ...) \
+    do { static constexpr char cmsFormat_[] = fmt; (target).template format<cmsFormat_>(__VA_ARGS__); } while (0)
+
+/// 리터럴 포맷으로 기존 내용 뒤에 추가합니다. (StringBase::appendFormat)
+#define CMS_APPEND_FORMAT(target, fmt, ...) \
+    do { static constexpr char cmsFormat_[] = fmt; (target).template appendFormat<cmsFormat_>(__VA_ARGS__); } while (0)
+
+namespace cms {
+    namespace string {
+        namespace detail {
+            /// 포맷 문자열의 한 조각: 앞쪽 리터럴 구간과 뒤따르는 지정자 (type이 0이면 리터럴만 있는 마지막 조각)
+            struct FormatPiece {
+                size_t litBegin;   ///< 리터럴 시작 오프셋
+                size_t litLen;     ///< 리터럴 바이트 수
+                char type;         ///< 변환 문자 (s d u x X f c %), 0: 없음, '?': 잘못된 지정자
+                bool isLong;       ///< 'l' 한정자 여부
+                char padChar;      ///< 채움 문자 (' ' 또는 '0')
+                int width;         ///< 최소 출력 너비
+                int precision;     ///< 정밀도 (-1: 미지정)
+                size_t argIndex;   ///< 이 지정자가 사용하는 인자 번호
+            };
+
+            /// 컴파일 타임에 분해한 포맷 조각 배열
+            template<size_t N>
+            struct FormatPlan {
+                FormatPiece pieces[N];
+            };
+
+            constexpr bool isFormatDigit(char c) { return c >= '0' && c <= '9'; }
+
+            /// '%' 다음 위치부터 지정자를 해석하고 다음 위치를 반환합니다. (appendPrintf의 parseSpec과 같은 규칙)
+            constexpr size_t parseFormatSpec(const char* fmt, size_t i, FormatPiece& piece) {
+                piece.padChar = ' ';
+                piece.width = 0;
+                piece.precision = -1;
+                piece.isLong = false;
+
+                if (fmt[i] == '0') { piece.padChar = '0'; ++i; }
+                while (isFormatDigit(fmt[i])) {
+                    if (piece.width < 100) piece.width = piece.width * 10 + (fmt[i] - '0'); // 비정상적인 너비 제한
+                    ++i;
+                }
+                if (fmt[i] == '.') {
+                    ++i;
+                    piece.precision = 0;
+                    while (isFormatDigit(fmt[i])) {
+                        if (piece.precision < 100) piece.precision = piece.precision * 10 + (fmt[i] - '0');
+                        ++i;
+                    }
+                }
+                if (fmt[i] == 'l') { piece.isLong = true; ++i; }
+
+                const char t = fmt[i];
+                const bool integer = (t == 'd' || t == 'u' || t == 'x' || t == 'X');
+                const bool other = (t == 'f' || t == 'c' || t == 's' || t == '%');
+                // 무시될 너비/정밀도는 조용히 버리지 않고 거부 (printf와 다른 출력 방지)
+                const bool widthIgnored = (t == 'c' || t == 's' || t == '%') && (piece.width > 0 || piece.padChar == '0');
+                const bool precisionIgnored = (t != 'f') ? piece.precision >= 0 : piece.precision > 9; // appendFloat 상한
+                const bool supported = (integer || (!piece.isLong && other)) && !widthIgnored && !precisionIgnored;
+                piece.type = supported ? t : '?';
+                return t ? i + 1 : i;
+            }
+
+            /// 조각 수 (지정자 수 + 마지막 리터럴 1개)
+            constexpr size_t countFormatPieces(const char* fmt) {
+                size_t n = 1;
+                size_t i = 0;
+                while (fmt[i]) {
+                    if (fmt[i] != '%') { ++i; continue; }
+                    FormatPiece piece{};
+                    i = parseFormatSpec(fmt, i + 1, piece);
+                    ++n;
+                }
+                return n;
+            }
+
+            /// 포맷 문자열을 조각 배열로 분해합니다.
+            template<size_t N>
+            constexpr FormatPlan<N> buildFormatPlan(const char* fmt) {
+                FormatPlan<N> plan{};
+                size_t count = 0, litBegin = 0, argIndex = 0, i = 0;
+                while (fmt[i]) {
+                    if (fmt[i] != '%') { ++i; continue; }
+                    FormatPiece& piece = plan.pieces[count++];
+                    piece.litBegin = litBegin;
+                    piece.litLen = i - litBegin;
+                    i = parseFormatSpec(fmt, i + 1, piece);
+                    piece.argIndex = argIndex;
+                    if (piece.type != '%') ++argIndex;
+                    litBegin = i;
+                }
+                FormatPiece& last = plan.pieces[count];
+                last.litBegin = litBegin;
+                last.litLen = i - litBegin;
+                last.type = 0;
+                return plan;
+            }
+
+            /// 포맷 하나에 대한 컴파일 결과 (조각 수, 인자 수, 유효성, 조각 배열)
+            template<const char* FMT>
+            struct CompiledFormat {
+                static constexpr size_t PIECES = countFormatPieces(FMT);
+                static constexpr FormatPlan<PIECES> PLAN = buildFormatPlan<PIECES>(FMT);
+
+                static constexpr size_t countArgs() {
+                    size_t n = 0;
+                    for (size_t i = 0; i + 1 < PIECES; ++i) {
+                        if (PLAN.pieces[i].type != '%') ++n;
+                    }
+                    return n;
+                }
+                static constexpr bool isValid() {
+                    for (size_t i = 0; i + 1 < PIECES; ++i) {
+                        if (PLAN.pieces[i].type == '?') return false;
+                    }
+                    return true;
+                }
+                static constexpr size_t ARGS = countArgs();
+                static constexpr bool VALID = isValid();
+            };
+
+            /// c_str()/length()를 제공하는 문자열 객체(StringBase 등)인지 판별합니다.
+            template<typename T, typename = void>
+            struct HasCStr : std::false_type {};
+            template<typename T>
+            struct HasCStr<T, std::void_t<decltype(std::declval<const T&>().c_str()),
+                                          decltype(std::declval<const T&>().length())>> : std::true_type {};
+
+            template<typename T>
+            struct AlwaysFalse : std::false_type {};
+
+            /// 정수 인자를 10진수로 기록합니다. (타입 폭에 맞는 32/64비트 경로 선택)
+            template<bool AS_UNSIGNED, typename T>
+            inline void writeDecimalArg(char* buffer, size_t maxLen, size_t& curLen, const FormatPiece& piece, T v) {
+                if constexpr (std::is_signed<T>::value && !AS_UNSIGNED) {
+                    if constexpr (sizeof(T) <= sizeof(long)) appendInt(buffer, maxLen, curLen, static_cast<long>(v), piece.width, piece.padChar);
+                    else appendInt64(buffer, maxLen, curLen, static_cast<long long>(v), piece.width, piece.padChar);
+                } else {
+                    using U = typename std::make_unsigned<T>::type;
+                    if constexpr (sizeof(T) <= sizeof(unsigned long)) appendUInt(buffer, maxLen, curLen, static_cast<unsigned long>(static_cast<U>(v)), piece.width, piece.padChar);
+                    else appendUInt64(buffer, maxLen, curLen, static_cast<unsigned long long>(static_cast<U>(v)), piece.width, piece.padChar);
+                }
+            }
+
+            /// 지정자 하나에 해당하는 인자를 직렬화합니다. 지정자와 맞지 않는 타입은 컴파일 오류입니다.
+            template<char TYPE, typename T>
+            inline void writeFormatArg(char* buffer, size_t maxLen, size_t& curLen, const FormatPiece& piece, const T& value) {
+                using V = typename std::decay<T>::type;
+                if constexpr (TYPE == 's') {
+                    if constexpr (std::is_convertible<const T&, const char*>::value) {
+                        const char* s = value;
+                        if (!s) s = "(null)";
+                        append(buffer, maxLen, curLen, s, strlen(s));
+                    } else if constexpr (std::is_same<V, Token>::value) {
+                        append(buffer, maxLen, curLen, value.ptr, value.len);
+                    } else if constexpr (HasCStr<V>::value) {
+                        append(buffer, maxLen, curLen, value.c_str(), value.length());
+                    } else {
+                        static_assert(AlwaysFalse<T>::value, "cms::string::format %s expects const char*, Token or a c_str()/length() string.");
+                    }
+                } else if constexpr (TYPE == 'f') {
+                    static_assert(std::is_floating_point<V>::value, "cms::string::format %f expects float or double.");
+                    appendFloat(buffer, maxLen, curLen, static_cast<double>(value), (piece.precision >= 0) ? piece.precision : 2,
+                                piece.width, piece.padChar);
+                } else {
+                    static_assert(std::is_integral<V>::value, "cms::string::format %d/%u/%x/%X/%c expects an integer type.");
+                    using I = typename std::conditional<std::is_same<V, bool>::value, int, V>::type; // bool은 0/1로 출력
+                    if constexpr (TYPE == 'c') {
+                        const char c = static_cast<char>(value);
+                        append(buffer, maxLen, curLen, &c, 1);
+                    } else if constexpr (TYPE == 'x' || TYPE == 'X') {
+                        static_assert(sizeof(V) <= sizeof(unsigned long), "cms::string::format %x/%X supports up to unsigned long.");
+                        using U = typename std::make_unsigned<I>::type;
+                        appendHex(buffer, maxLen, curLen, static_cast<unsigned long>(static_cast<U>(static_cast<I>(value))), piece.width, piece.padChar, TYPE == 'X');
+                    } else {
+                        writeDecimalArg<TYPE == 'u', I>(buffer, maxLen, curLen, piece, static_cast<I>(value));
+                    }
+                }
+            }
+
+            /// I번째 조각(리터럴 + 지정자)을 기록합니다.
+            template<const char* FMT, size_t I, typename Tuple>
+            inline void formatPiece(char* buffer, size_t maxLen, size_t& curLen, const Tuple& args) {
+                constexpr FormatPiece piece = CompiledFormat<FMT>::PLAN.pieces[I];
+                if constexpr (piece.litLen > 0) append(buffer, maxLen, curLen, FMT + piece.litBegin, piece.litLen);
+                if constexpr (piece.type == '%') append(buffer, maxLen, curLen, "%", 1);
+                else if constexpr (piece.type != 0) writeFormatArg<piece.type>(buffer, maxLen, curLen, piece, std::get<piece.argIndex>(args));
+            }
+
+            template<const char* FMT, typename Tuple, size_t... I>
+            inline void formatPieces(char* buffer, size_t maxLen, size_t& curLen, const Tuple& args, std::index_sequence<I...>) {
+                (formatPiece<FMT, I>(buffer, maxLen, curLen, args), ...);
+            }
+        } // detail
+
+        // ---------------------------------------------------------
+        // [format] 컴파일 타임에 해석된 포맷으로 버퍼 끝에 추가합니다.
+        //
+        // Usage:
+        //   static constexpr char kFmt[] = "T:%.1f H:%d";
+        //   cms::string::format<kFmt>(buf, sizeof(buf), len, temp, hum);
+        //
+        // @tparam FMT 정적 저장 기간을 갖는 constexpr char 배열 (appendPrintf와 같은 지정자)
+        // @param buffer 결과가 저장될 버퍼
+        // @param maxLen 버퍼의 최대 크기 (널 종료 문자 포함)
+        // @param curLen 현재 문자열 길이 (참조로 전달되어 업데이트됨)
+        // @return 포맷팅 완료 후 최종 문자열의 전체 바이트 길이
+        // ---------------------------------------------------------
+        template<const char* FMT, typename... Args>
+        int format(char* buffer, size_t maxLen, size_t& curLen, const Args&... args) {
+            using Compiled = detail::CompiledFormat<FMT>;
+            static_assert(Compiled::VALID, "cms::string::format: unsupported or malformed format specifier.");
+            static_assert(Compiled::ARGS == sizeof...(Args), "cms::string::format: argument count does not match the format.");
+            if constexpr (Compiled::VALID && Compiled::ARGS == sizeof...(Args)) {
+                if (buffer && maxLen > 0) {
+                    detail::formatPieces<FMT>(buffer, maxLen, curLen, std::forward_as_tuple(args...),
+                                              std::make_index_sequence<Compiled::PIECES>());
+                }
+            }
+            return static_cast<int>(curLen);
+        }
+    } // string
+} // namespace cms
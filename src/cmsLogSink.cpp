@@ -0,0 +1,238 @@
+/// @author comser.dev
+/// @brief 기본 로그 sink(콘솔, 버퍼 파일)의 구현부입니다.
+/// 버퍼링/flush 로직은 비-템플릿으로 한 번만 컴파일되어 페이지 크기별 코드 비대화를 방지합니다.
+
+#include <cstdio>
+#include <cstring>
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+#include "cmsLogSink.h"
+
+namespace cms {
+
+    /// [ConsoleLogSink::write] 콘솔 한 줄 출력 구현
+    void ConsoleLogSink::write(const cms::StringBase& line, LogLevel) {
+#ifdef ARDUINO
+        Serial.println(line.c_str());
+#else
+        std::printf("%s\n", line.c_str());
+#endif
+    }
+
+    /// [write] 줄 버퍼링 구현
+    void BufferedLogSinkBase::write(const cms::StringBase& line, LogLevel level) {
+        if (_capacity == 0) return;
+        append(line.c_str(), line.length());
+        append("\n", 1);
+        if (_flushLevel != LogLevel::None && level >= _flushLevel) flush();
+    }
+
+    /// [append] 페이지 분할 추가 구현
+    ///
+    /// 줄이 페이지 경계를 넘으면 앞부분으로 페이지를 채워 기록한 뒤 나머지를 새 페이지에 이어 씁니다.
+    /// 따라서 크기 기반 기록은 항상 정확히 한 페이지이며, 남은 조각만 시간/레벨 기반 flush로 나갑니다.
+    void BufferedLogSinkBase::append(const char* data, size_t len) {
+        while (len > 0) {
+            if (_used == 0) _firstUs = cms::monotonicMicros();
+            size_t room = _capacity - _used;
+            size_t n = len < room ? len : room;
+            memcpy(_buffer + _used, data, n);
+            _used += n;
+            data += n;
+            len -= n;
+            if (_used == _capacity) commitBlock();
+        }
+    }
+
+    /// [commitBlock] 블록 기록 구현
+    void BufferedLogSinkBase::commitBlock() {
+        if (!writeBlock(_buffer, _used)) _writeErrors++;
+        _used = 0;
+    }
+
+    /// [flush] 잔여 버퍼 기록 구현
+    void BufferedLogSinkBase::flush() {
+        if (_used > 0) commitBlock();
+    }
+
+    /// [tick] 시간 기반 flush 구현 (차이값 비교라 시계 순환에 안전, 주기는 약 71분 미만)
+    void BufferedLogSinkBase::tick() {
+        if (_used == 0 || _flushIntervalMs == 0) return;
+        const uint32_t waitedMs = (cms::monotonicMicros() - _firstUs) / 1000u;
+        if (waitedMs >= _flushIntervalMs) flush();
+    }
+
+    /// [setFile] 대상 파일 교체 구현
+    void FileLogSinkBase::setFile(FILE* file) {
+        flush();
+        _file = file;
+    }
+
+    /// [writeBlock] fwrite + fflush 구현
+    bool FileLogSinkBase::writeBlock(const uint8_t* data, size_t len) {
+        if (!_file) return false;
+        if (fwrite(data, 1, len, _file) != len) return false;
+        return fflush(_file) == 0;
+    }
+
+    namespace {
+        constexpr uint32_t CRASH_LOG_MAGIC = 0x4C534D43u; // "CMSL"
+
+        /// [stateChecksum] 헤더 상태의 FNV-1a 체크섬 (magic/capacity 포함)
+        uint32_t stateChecksum(const CrashLogHeader& header, const CrashLogHeader::State& st) noexcept {
+            const uint32_t words[6] = {header.magic, header.capacity, st.seq, st.head, st.used, st.count};
+            uint32_t h = 2166136261u;
+            for (uint32_t w : words) {
+                for (int i = 0; i < 4; ++i) {
+                    h ^= (w >> (i * 8)) & 0xFFu;
+                    h *= 16777619u;
+                }
+            }
+            return h;
+        }
+    } // namespace
+
+    /// [CrashLogSink] 저장소 검증/초기화 구현
+    CrashLogSink::CrashLogSink(CrashLogHeader& header, uint8_t* data, size_t capacity) noexcept
+        : _header(header), _data(data), _capacity(capacity) {
+        if (recover()) {
+            _recovered = _count;
+            return;
+        }
+        _header.magic = CRASH_LOG_MAGIC;
+        _header.capacity = static_cast<uint32_t>(_capacity);
+        _seq = 0;
+        clear();
+    }
+
+    /// [recover] 복구 검증 구현
+    ///
+    /// 전원 인가 직후의 임의 RAM 값이나 펌웨어 변경(용량 차이)은 매직/체크섬에서 걸러지고,
+    /// 드물게 체크섬이 맞더라도 레코드 길이의 합이 used와 다르면 폐기합니다.
+    bool CrashLogSink::recover() noexcept {
+        if (_header.magic != CRASH_LOG_MAGIC || _header.capacity != _capacity) return false;
+
+        const CrashLogHeader::State* best = nullptr;
+        for (const CrashLogHeader::State& st : _header.state) {
+            if (st.checksum != stateChecksum(_header, st)) continue;
+            if (st.head >= _capacity || st.used > _capacity) continue;
+            if (!best || static_cast<int32_t>(st.seq - best->seq) > 0) best = &st;
+        }
+        if (!best) return false;
+
+        _seq = best->seq;
+        _head = best->head;
+        _used = best->used;
+        _count = best->count;
+
+        size_t offset = _head;
+        size_t walked = 0;
+        for (size_t i = 0; i < _count; ++i) {
+            if (_used - walked < RECORD_HEADER_SIZE) return false;
+            const size_t span = RECORD_HEADER_SIZE + recordLen(offset);
+            if (span > _used - walked) return false;
+            walked += span;
+            offset = (offset + span) % _capacity;
+        }
+        return walked == _used;
+    }
+
+    /// [seal] 헤더 기록 구현 (오래된 쪽 슬롯을 덮어쓰므로 기록 중 리셋되어도 최신 유효 상태 하나는 남음)
+    void CrashLogSink::seal() noexcept {
+        ++_seq;
+        CrashLogHeader::State& st = _header.state[_seq & 1u];
+        st.seq = _seq;
+        st.head = static_cast<uint32_t>(_head);
+        st.used = static_cast<uint32_t>(_used);
+        st.count = static_cast<uint32_t>(_count);
+        st.checksum = stateChecksum(_header, st);
+    }
+
+    /// [write] 레코드 추가 구현
+    ///
+    /// 공간 확보(오래된 레코드 제거)를 먼저 seal한 뒤 본문을 쓰고, 마지막 seal에서 새 레코드를 공개합니다.
+    /// 따라서 어느 시점에 리셋되어도 헤더가 가리키는 레코드는 모두 온전합니다.
+    void CrashLogSink::write(const cms::StringBase& line, LogLevel level) {
+        if (_capacity <= RECORD_HEADER_SIZE) return;
+        size_t len = line.length();
+        if (len > _capacity - RECORD_HEADER_SIZE) len = _capacity - RECORD_HEADER_SIZE;
+        if (len > MAX_LINE) len = MAX_LINE;
+        const size_t span = RECORD_HEADER_SIZE + len;
+
+        if (_used + span > _capacity) {
+            while (_used + span > _capacity) dropOldest();
+            seal();
+        }
+
+        const size_t tail = (_head + _used) % _capacity;
+        const uint8_t hdr[RECORD_HEADER_SIZE] = {static_cast<uint8_t>(len & 0xFFu), static_cast<uint8_t>(len >> 8),
+                                                 static_cast<uint8_t>(level)};
+        writeAt(tail, hdr, RECORD_HEADER_SIZE);
+        writeAt((tail + RECORD_HEADER_SIZE) % _capacity, line.c_str(), len);
+        _used += span;
+        ++_count;
+        seal();
+    }
+
+    /// [popRecovered] 복구 줄 재출력 구현 (복구 줄은 항상 링의 가장 오래된 쪽에 있음)
+    bool CrashLogSink::popRecovered(cms::StringBase& out, LogLevel& level) {
+        if (_recovered == 0) return false;
+        uint8_t hdr[RECORD_HEADER_SIZE];
+        readAt(_head, hdr, RECORD_HEADER_SIZE);
+        const size_t len = recordLen(_head);
+        level = (hdr[2] <= static_cast<uint8_t>(LogLevel::Error)) ? static_cast<LogLevel>(hdr[2]) : LogLevel::Error;
+
+        const size_t begin = (_head + RECORD_HEADER_SIZE) % _capacity;
+        const size_t first = (len < _capacity - begin) ? len : _capacity - begin;
+        out.append(reinterpret_cast<const char*>(_data + begin), first);
+        if (first < len) out.append(reinterpret_cast<const char*>(_data), len - first);
+
+        dropOldest();
+        seal();
+        return true;
+    }
+
+    /// [clear] 전체 삭제 구현
+    void CrashLogSink::clear() {
+        _head = 0;
+        _used = 0;
+        _count = 0;
+        _recovered = 0;
+        // 두 슬롯을 모두 빈 상태로 맞춰 이전 상태가 다시 선택되지 않도록 함
+        seal();
+        seal();
+    }
+
+    /// [dropOldest] 가장 오래된 레코드 제거 구현
+    void CrashLogSink::dropOldest() noexcept {
+        if (_count == 0) return;
+        const size_t span = RECORD_HEADER_SIZE + recordLen(_head);
+        _head = (_head + span) % _capacity;
+        _used -= span;
+        --_count;
+        if (_recovered > 0) --_recovered;
+    }
+
+    /// [recordLen] 레코드 길이 읽기 구현
+    size_t CrashLogSink::recordLen(size_t offset) const noexcept {
+        uint8_t hdr[2];
+        readAt(offset, hdr, 2);
+        return static_cast<size_t>(hdr[0]) | (static_cast<size_t>(hdr[1]) << 8);
+    }
+
+    /// [readAt] 링 경계 복사 구현 (읽기)
+    void CrashLogSink::readAt(size_t offset, void* dst, size_t len) const noexcept {
+        const size_t first = (len < _capacity - offset) ? len : _capacity - offset;
+        memcpy(dst, _data + offset, first);
+        if (first < len) memcpy(static_cast<uint8_t*>(dst) + first, _data, len - first);
+    }
+
+    /// [writeAt] 링 경계 복사 구현 (쓰기)
+    void CrashLogSink::writeAt(size_t offset, const void* src, size_t len) noexcept {
+        const size_t first = (len < _capacity - offset) ? len : _capacity - offset;
+        memcpy(_data + offset, src, first);
+        if (first < len) memcpy(_data, static_cast<const uint8_t*>(src) + first, len - first);
+    }
+
+} // namespace cms
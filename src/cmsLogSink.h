@@ -0,0 +1,284 @@
+/// @author comser.dev
+///
+/// LoggerBase::addSink()에 등록하여 사용하는 기본 출력 sink 모음입니다.
+/// 콘솔(Serial/stdout) sink와, 로그를 페이지 단위로 모아 파일(LittleFS/SPIFFS/SD 등)에 기록하는 버퍼 sink를 제공합니다.
+
+#pragma once // 중복 포함 방지
+
+#include <stddef.h> // size_t 정의
+#include <stdint.h> // uint8_t, uint32_t 정의
+#include <cstdio>   // FILE, fwrite, fflush
+#include <type_traits> // std::is_trivial
+#include "cmsAsyncLogger.h"
+
+#ifdef ARDUINO
+#include <esp_attr.h> // RTC_NOINIT_ATTR
+#endif
+
+/// [CMS_LOG_NOINIT] 재부팅 시 초기화되지 않는 메모리 배치 속성 (CrashLogStore 선언용)
+///
+/// ESP32에서는 RTC_NOINIT_ATTR(RTC slow memory, 약 8KB)이며, 더 큰 링이 필요하면 __NOINIT_ATTR(.noinit DRAM)로 재정의합니다.
+/// Native에서는 프로세스 재시작을 넘어 유지될 수 없으므로 빈 속성(0으로 초기화되어 항상 빈 링으로 시작)입니다.
+#ifndef CMS_LOG_NOINIT
+#ifdef ARDUINO
+#define CMS_LOG_NOINIT RTC_NOINIT_ATTR
+#else
+#define CMS_LOG_NOINIT
+#endif
+#endif
+
+namespace cms {
+
+// ==================================================================================================
+// [BufferedLogSink] 개요
+// - 왜 존재하는가: 플래시 파일 시스템은 쓰기 한 번의 고정 비용(블록 갱신, 메타데이터, 마모)이 크므로
+//   줄마다 기록하면 느리고 수명을 깎습니다. 여러 줄을 한 페이지로 모아 한 번에 기록하기 위해 존재합니다.
+// - 어떻게 동작하는가: write()는 줄 + '\n'을 버퍼에 이어 붙이고, 버퍼가 가득 차면 정확히 한 페이지를 writeBlock()으로 넘깁니다.
+//   그 밖에 flushLevel 이상(기본 Error)의 로그가 오거나, 가장 오래된 줄이 flushInterval보다 오래 머물면(tick) 남은 내용을 내보냅니다.
+// ==================================================================================================
+
+/// Serial(Arduino) 또는 stdout(Native)으로 한 줄씩 출력하는 sink입니다.
+///
+/// Why: sink를 등록하면 outputLog()가 더 이상 쓰이지 않으므로, 콘솔 출력도 다른 sink와 나란히 등록할 수 있게 하기 위함입니다.
+/// How: LoggerBase::outputLog()의 기본 구현과 같은 방식으로 출력합니다.
+///
+/// 사용 예:
+/// @code
+/// static cms::ConsoleLogSink console;
+/// logger.addSink(console, cms::LogLevel::Debug, true); // 터미널은 색상 유지
+/// @endcode
+class ConsoleLogSink : public LogSink {
+public:
+    void write(const cms::StringBase& line, LogLevel level) override;
+};
+
+/// 로그 줄을 고정 버퍼에 모아 블록 단위로 기록하는 sink의 공통 로직입니다.
+///
+/// Why: 페이지 크기(PAGE)별로 버퍼링/flush 코드가 중복 생성되지 않도록 비-템플릿으로 분리하기 위함입니다. (Thin Template)
+/// How: 외부에서 주입된 버퍼를 사용하며, 실제 기록은 파생 클래스의 writeBlock()이 담당합니다.
+///
+/// @note write()/tick()은 update()를 호출하는 태스크에서 실행됩니다. 다른 태스크에서 flush()를 호출하려면
+///       (예: 재부팅 직전 logger.flushSinks()) 그 시점에 update()가 동작하지 않도록 하세요.
+class BufferedLogSinkBase : public LogSink {
+public:
+    /// 기본 시간 기반 flush 주기 (밀리초)
+    static constexpr uint32_t DEFAULT_FLUSH_INTERVAL_MS = 1000;
+
+    /// [write] 줄 + '\n'을 버퍼에 추가 (가득 차면 페이지 단위 기록, flushLevel 이상이면 즉시 flush)
+    void write(const cms::StringBase& line, LogLevel level) override;
+
+    /// [flush] 버퍼에 남은 내용을 즉시 기록
+    void flush() override;
+
+    /// [tick] 가장 오래된 줄이 flushInterval 이상 머물렀으면 flush
+    void tick() override;
+
+    /// [setFlushInterval] 시간 기반 flush 주기 설정 (0: 시간 기반 flush 끔, 약 71분 미만)
+    void setFlushInterval(uint32_t ms) noexcept { _flushIntervalMs = ms; }
+
+    /// [setFlushLevel] 즉시 flush를 유발하는 최소 레벨 설정 (LogLevel::None: 레벨 기반 flush 끔)
+    void setFlushLevel(LogLevel level) noexcept { _flushLevel = level; }
+
+    /// [buffered] 아직 기록되지 않은 바이트 수
+    size_t buffered() const noexcept { return _used; }
+
+    /// [pageSize] 한 번에 기록하는 최대 블록 크기 (버퍼 용량)
+    size_t pageSize() const noexcept { return _capacity; }
+
+    /// [writeErrors] writeBlock() 실패 횟수 (실패한 블록의 내용은 버려짐)
+    uint32_t writeErrors() const noexcept { return _writeErrors; }
+
+protected:
+    BufferedLogSinkBase(uint8_t* buffer, size_t capacity) noexcept
+        : _buffer(buffer), _capacity(capacity) {}
+
+    /// [writeBlock] 모아 둔 블록을 매체에 기록 (파생 클래스 구현)
+    /// @return false: 기록 실패 (writeErrors 증가)
+    virtual bool writeBlock(const uint8_t* data, size_t len) = 0;
+
+private:
+    /// [append] 바이트를 버퍼에 추가하며 가득 찰 때마다 한 페이지씩 기록
+    void append(const char* data, size_t len);
+    /// [commitBlock] 버퍼 내용을 writeBlock()으로 넘기고 비움
+    void commitBlock();
+
+    uint8_t* _buffer;
+    size_t _capacity;
+    size_t _used = 0;
+    uint32_t _firstUs = 0; ///< 버퍼가 비어 있다가 처음 채워진 시각 (monotonicMicros, 가장 오래된 줄의 대기 시작)
+    uint32_t _flushIntervalMs = DEFAULT_FLUSH_INTERVAL_MS;
+    uint32_t _writeErrors = 0;
+    LogLevel _flushLevel = LogLevel::Error;
+};
+
+/// FILE*에 블록을 기록하는 버퍼 sink의 공통 로직입니다.
+///
+/// Why: ESP-IDF VFS를 통해 LittleFS/SPIFFS/SD가 모두 FILE*로 열리므로, 같은 코드로 Native와 타깃을 지원하기 위함입니다.
+/// How: 블록마다 fwrite 후 fflush하여 페이지 하나가 곧 파일 시스템 쓰기 한 번이 되도록 합니다.
+class FileLogSinkBase : public BufferedLogSinkBase {
+public:
+    /// [setFile] 기록 대상 파일 교체 (이전 파일에 남은 내용은 먼저 flush, 파일을 닫지는 않음)
+    void setFile(FILE* file);
+
+    /// [file] 현재 기록 대상 파일
+    FILE* file() const noexcept { return _file; }
+
+protected:
+    FileLogSinkBase(FILE* file, uint8_t* buffer, size_t capacity) noexcept
+        : BufferedLogSinkBase(buffer, capacity), _file(file) {}
+
+    bool writeBlock(const uint8_t* data, size_t len) override;
+
+private:
+    FILE* _file;
+};
+
+/// 페이지 버퍼를 내장한 파일 로그 sink입니다.
+///
+/// 사용 예:
+/// @code
+/// static cms::FileLogSink<4096> fileSink(fopen("/littlefs/app.log", "a"));
+/// logger.addSink(fileSink, cms::LogLevel::Info); // 색상 코드가 제거된 로그가 페이지 단위로 기록됨
+/// fileSink.setFlushInterval(5000);
+/// @endcode
+///
+/// @tparam PAGE 한 번에 기록하는 블록 크기 (파일 시스템 페이지/섹터 크기에 맞추면 쓰기 증폭이 최소화됨)
+template <size_t PAGE = 4096>
+class FileLogSink : public FileLogSinkBase {
+    static_assert(PAGE > 0, "FileLogSink PAGE must be greater than 0");
+
+public:
+    explicit FileLogSink(FILE* file = nullptr) noexcept : FileLogSinkBase(file, _page, PAGE) {}
+
+    // 내장 버퍼를 가리키므로 복사 금지
+    FileLogSink(const FileLogSink&) = delete;
+    FileLogSink& operator=(const FileLogSink&) = delete;
+
+private:
+    alignas(4) uint8_t _page[PAGE];
+};
+
+// ==================================================================================================
+// [CrashLogSink] 개요
+// - 왜 존재하는가: 워치독/패닉 리셋 직전의 로그가 가장 중요하지만, 매 줄을 플래시에 동기 기록하면 로깅 경로가 너무 느려집니다.
+//   리셋에도 지워지지 않는 RAM에 최근 로그를 남겨 두고, 다음 부팅에서 평소의 sink 경로로 천천히 내보내기 위해 존재합니다.
+// - 어떻게 동작하는가: write()는 [길이 + 레벨 + 본문] 레코드를 noinit 바이트 링에 memcpy만 하고(I/O 없음), 링 상태는 매직/용량과
+//   체크섬이 붙은 두 벌의 헤더에 번갈아 기록합니다. 부팅 시 생성자가 헤더와 레코드 체인을 검증하여 남아 있던 줄을 "복구 로그"로 표시하고,
+//   LoggerBase::replayCrashLog()를 등록하면 큐가 빌 때마다(update의 유휴 시점) 정해진 줄 수씩 다른 sink로 재출력하며 링에서 제거합니다.
+//
+// 사용 예:
+// @code
+// CMS_LOG_NOINIT static cms::CrashLogStore<6144> g_crashStore; // 리셋에도 유지 (생성자 없음)
+// static cms::CrashLogSink crashSink(g_crashStore);            // 부팅 시 헤더 검증 → 이전 로그 복구
+// static cms::FileLogSink<4096> fileSink(fopen("/littlefs/app.log", "a"));
+//
+// logger.addSink(fileSink, cms::LogLevel::Info);
+// logger.addSink(crashSink, cms::LogLevel::Info);  // 최근 로그를 RAM에 보존 (링이 차면 가장 오래된 줄부터 버림)
+// logger.replayCrashLog(crashSink, 4);             // 복구된 줄을 유휴 update마다 4줄씩 "[Prev] ..."로 fileSink에 기록
+// @endcode
+//
+// @note write()는 출력 시점(update)에 호출되므로, 리셋 순간에 아직 큐에 남아 있던 로그는 포함되지 않습니다.
+// ==================================================================================================
+
+/// 리셋에도 유지되는 링 상태 헤더입니다. (CrashLogStore 내부용)
+///
+/// 상태를 두 벌 두고 번갈아 기록하므로, 헤더를 쓰는 도중에 리셋되어도 직전 상태 하나는 체크섬이 맞은 채로 남습니다.
+struct CrashLogHeader {
+    /// 링 상태 한 벌
+    struct State {
+        uint32_t seq;      ///< 기록 순번 (두 벌 중 큰 쪽이 최신)
+        uint32_t head;     ///< 가장 오래된 레코드 위치
+        uint32_t used;     ///< 레코드 헤더를 포함한 사용 바이트 수
+        uint32_t count;    ///< 레코드 개수
+        uint32_t checksum; ///< magic, capacity와 위 필드들의 FNV-1a 체크섬
+    };
+
+    uint32_t magic;    ///< CrashLogSink가 초기화한 링인지 표시
+    uint32_t capacity; ///< 데이터 영역 크기 (펌웨어에서 크기가 바뀌면 이전 내용 폐기)
+    State state[2];
+};
+
+/// noinit 메모리에 선언하는 크래시 로그 저장소입니다.
+///
+/// Why: 생성자가 있는 객체는 부팅 때마다 초기화되므로, 저장소는 생성자 없는 단순 구조체로 두고 검증/관리는 CrashLogSink가 맡기 위함입니다.
+/// How: 헤더와 데이터 영역만 가지며, CMS_LOG_NOINIT과 함께 정적 변수로 선언합니다.
+///
+/// @tparam BYTES 데이터 영역 크기 (레코드당 3바이트 헤더가 추가됨)
+template <size_t BYTES>
+struct CrashLogStore {
+    static_assert(BYTES >= 16 && BYTES <= 0xFFFFFFF0u, "cms::CrashLogStore BYTES must be 16 ~ 0xFFFFFFF0.");
+
+    CrashLogHeader header;
+    uint8_t data[BYTES];
+};
+
+/// 최근 로그를 리셋에도 유지되는 RAM 링에 보존하는 sink입니다.
+///
+/// Why: 출력 경로에서는 memcpy만 수행하여 사후 분석용 로그의 런타임 I/O 비용을 없애기 위함입니다.
+/// How: 저장소 크기와 무관한 비-템플릿 클래스이며, 템플릿 생성자는 저장소의 헤더/데이터 위치만 넘깁니다. (Thin Template)
+///
+/// @note write()/popRecovered()는 update()를 호출하는 태스크에서 실행됩니다. 색상 없는 sink(addSink의 기본값)로 등록하세요.
+class CrashLogSink : public LogSink {
+public:
+    /// 레코드 헤더 크기 (길이 2바이트 + 레벨 1바이트)
+    static constexpr size_t RECORD_HEADER_SIZE = 3;
+    /// 레코드 하나의 최대 본문 크기
+    static constexpr size_t MAX_LINE = 0xFFFF;
+
+    /// 저장소를 검증하여 이전 부팅의 로그를 복구하거나, 유효하지 않으면 빈 링으로 초기화합니다.
+    template <size_t BYTES>
+    explicit CrashLogSink(CrashLogStore<BYTES>& store) noexcept : CrashLogSink(store.header, store.data, BYTES) {
+        static_assert(std::is_trivial<CrashLogStore<BYTES>>::value, "cms::CrashLogStore must stay trivial so noinit memory is not cleared.");
+    }
+
+    // 저장소 상태를 함께 관리하므로 복사 금지
+    CrashLogSink(const CrashLogSink&) = delete;
+    CrashLogSink& operator=(const CrashLogSink&) = delete;
+
+    /// [write] 한 줄을 링에 추가 (공간이 부족하면 가장 오래된 줄부터 버림, 용량을 넘는 줄은 잘림)
+    void write(const cms::StringBase& line, LogLevel level) override;
+
+    /// [recoveredCount] 이전 부팅에서 복구되어 아직 재출력되지 않은 줄 수
+    size_t recoveredCount() const noexcept { return _recovered; }
+
+    /// [popRecovered] 가장 오래된 복구 줄을 out 뒤에 덧붙이고 링에서 제거
+    /// @return false: 남은 복구 줄 없음
+    bool popRecovered(cms::StringBase& out, LogLevel& level);
+
+    /// [clear] 복구 줄을 포함한 모든 기록 삭제
+    void clear();
+
+    /// [size] 링에 남은 줄 수 (복구 줄 포함)
+    size_t size() const noexcept { return _count; }
+    /// [bytesUsed] 레코드 헤더를 포함한 사용 바이트 수
+    size_t bytesUsed() const noexcept { return _used; }
+    /// [capacity] 데이터 영역 크기
+    size_t capacity() const noexcept { return _capacity; }
+
+private:
+    CrashLogSink(CrashLogHeader& header, uint8_t* data, size_t capacity) noexcept;
+
+    /// [recover] 헤더 두 벌 중 최신 유효 상태를 고르고 레코드 체인을 검증 (실패 시 false)
+    bool recover() noexcept;
+    /// [seal] 현재 상태를 오래된 쪽 헤더에 체크섬과 함께 기록
+    void seal() noexcept;
+    /// [dropOldest] 가장 오래된 레코드 제거 (seal은 호출자가 수행)
+    void dropOldest() noexcept;
+    /// [readAt] / [writeAt] 링 경계를 넘는 복사
+    void readAt(size_t offset, void* dst, size_t len) const noexcept;
+    void writeAt(size_t offset, const void* src, size_t len) noexcept;
+    /// [recordLen] offset 위치 레코드의 본문 길이
+    size_t recordLen(size_t offset) const noexcept;
+
+    CrashLogHeader& _header;
+    uint8_t* const _data;
+    const size_t _capacity;
+    // 작업용 사본 (seal 시점에만 noinit 헤더에 기록)
+    uint32_t _seq = 0;
+    size_t _head = 0;
+    size_t _used = 0;
+    size_t _count = 0;
+    size_t _recovered = 0;
+};
+
+} // namespace cms
@@ -0,0 +1,234 @@
+/// @author comser.dev
+/// @brief ByteRingBase 비-템플릿 클래스의 구현부입니다.
+/// 이 파일은 독립적으로 컴파일되어 버퍼 크기별 코드 비대화를 방지합니다.
+
+#include <cstring>
+#include "cmsQueue.h"
+
+namespace {
+    /// 레코드 헤더 크기 (span + len, 페이로드 정렬을 위해 RECORD_ALIGN까지 패딩)
+    constexpr size_t RECORD_HEADER_SIZE = cms::ByteRingBase::RECORD_ALIGN;
+
+    /// 레코드 크기를 RECORD_ALIGN 경계로 올림합니다.
+    inline size_t alignRecord(size_t n) {
+        return (n + RECORD_HEADER_SIZE - 1) & ~static_cast<size_t>(RECORD_HEADER_SIZE - 1);
+    }
+}
+
+namespace cms {
+
+    /// [ByteRingBase] 생성자 구현
+    ByteRingBase::ByteRingBase(uint8_t* buf, size_t capacity, QueueFullPolicy policy)
+        : _buf(buf), _capacity(capacity & ~static_cast<size_t>(RECORD_ALIGN - 1)), _policy(policy) {
+        static_assert(sizeof(RecordHeader) <= RECORD_HEADER_SIZE, "RecordHeader must fit in RECORD_ALIGN bytes.");
+    }
+
+    /// [reserveRecord] 연속 공간 예약 구현 (reserve/tryReserve 공통)
+    ///
+    /// 1) 비어 있으면 위치를 0으로 되돌려 단편화 제거
+    /// 2) 버퍼 끝이 부족하고 앞부분이 충분하면 래핑 마커를 남기고 앞부분 사용
+    /// 3) 공간이 부족하면 정책에 따라 오래된 레코드를 버리고 재시도 (makeRoom이 false면 바로 실패)
+    uint8_t* ByteRingBase::reserveRecord(size_t maxLen, bool makeRoom) {
+        if (maxLen > MAX_RECORD_SIZE) return nullptr;
+        const size_t need = alignRecord(RECORD_HEADER_SIZE + maxLen);
+        if (need > _capacity) return nullptr;
+
+        _mutex.lock();
+        for (;;) {
+            size_t avail;
+            if (_used == 0) {
+                _head = _tail = 0;
+                avail = _capacity;
+            } else if (_tail > _head) {
+                avail = _capacity - _tail;
+                if (avail < need && _head >= need) {
+                    RecordHeader* marker = headerAt(_tail);
+                    marker->span = static_cast<uint16_t>(avail);
+                    marker->len = LEN_WRAP;
+                    _used += avail;
+                    _tail = 0;
+                    avail = _head;
+                }
+            } else {
+                avail = _head - _tail; // tail == head면 가득 참
+            }
+            if (avail >= need) break;
+
+            if (!makeRoom || _policy != QueueFullPolicy::OverwriteOldest || !evictOldest()) {
+                _mutex.unlock();
+                return nullptr;
+            }
+        }
+
+        RecordHeader* h = headerAt(_tail);
+        h->span = static_cast<uint16_t>(need);
+        h->len = LEN_WRITING;
+        uint8_t* payload = _buf + _tail + RECORD_HEADER_SIZE;
+        _tail += need;
+        if (_tail == _capacity) _tail = 0;
+        _used += need;
+        _count++;
+#ifdef CMS_ENABLE_PROFILING
+        if (_used > _peakUsed) _peakUsed = _used;
+#endif
+        _mutex.unlock();
+        return payload;
+    }
+
+    /// [commit] 레코드 공개 및 마지막 레코드의 남는 공간 반환 구현
+    void ByteRingBase::commit(uint8_t* payload, size_t len) {
+        const size_t offset = static_cast<size_t>(payload - _buf) - RECORD_HEADER_SIZE;
+        _mutex.lock();
+        RecordHeader* h = headerAt(offset);
+        if (len > h->span - RECORD_HEADER_SIZE) len = h->span - RECORD_HEADER_SIZE;
+        h->len = static_cast<uint16_t>(len);
+
+        // 이 레코드 뒤에 예약된 레코드가 없다면 사용하지 않은 꼬리 공간을 즉시 반환
+        size_t end = offset + h->span;
+        if (end == _capacity) end = 0;
+        const size_t shrunk = alignRecord(RECORD_HEADER_SIZE + len);
+        if (end == _tail && shrunk < h->span) {
+            _used -= h->span - shrunk;
+            h->span = static_cast<uint16_t>(shrunk);
+            _tail = offset + shrunk;
+        }
+        _mutex.unlock();
+    }
+
+    /// [cancel] 마지막 예약 레코드 반환 구현
+    ///
+    /// 레코드 끝이 tail이면 그 뒤에 예약된 레코드가 없으므로 tail을 레코드 시작으로 되돌립니다.
+    /// 이 예약이 남긴 래핑 마커는 그대로 두며, 소비자가 head를 마커까지 옮길 때 평소처럼 제거됩니다.
+    bool ByteRingBase::cancel(uint8_t* payload) {
+        const size_t offset = static_cast<size_t>(payload - _buf) - RECORD_HEADER_SIZE;
+        _mutex.lock();
+        const RecordHeader* h = headerAt(offset);
+        size_t end = offset + h->span;
+        if (end == _capacity) end = 0;
+        const bool newest = (h->len == LEN_WRITING && end == _tail);
+        if (newest) {
+            _used -= h->span;
+            _tail = offset;
+            _count--;
+        }
+        _mutex.unlock();
+        return newest;
+    }
+
+    /// [peekBatch] 완성된 레코드 구간 조회 구현
+    size_t ByteRingBase::peekBatch(uint8_t** outPayloads, size_t* outLens, size_t maxCount) {
+        _mutex.lock();
+        size_t n = 0;
+        if (_readCount == 0) {
+            size_t offset = _head;
+            while (n < maxCount && n < _count) {
+                const RecordHeader* h = headerAt(offset);
+                if (h->len == LEN_WRAP) { offset = 0; continue; }
+                if (h->len == LEN_WRITING) break; // 순서 보장을 위해 기록 중인 레코드에서 중단
+                outPayloads[n] = _buf + offset + RECORD_HEADER_SIZE;
+                outLens[n] = h->len;
+                n++;
+                offset += h->span;
+                if (offset == _capacity) offset = 0;
+            }
+            _readCount = n;
+        }
+        _mutex.unlock();
+        return n;
+    }
+
+    /// [releaseBatch] 조회한 레코드 제거 구현
+    void ByteRingBase::releaseBatch(size_t count) {
+        _mutex.lock();
+        if (count > _readCount) count = _readCount;
+        for (size_t i = 0; i < count; ++i) {
+            const RecordHeader* h = headerAt(_head);
+            _used -= h->span;
+            _head += h->span;
+            if (_head == _capacity) _head = 0;
+            _count--;
+            skipWrapMarker();
+        }
+        _readCount = 0;
+        _mutex.unlock();
+    }
+
+    /// [enqueue] 복사 기반 추가 구현
+    bool ByteRingBase::enqueue(const void* data, size_t len) {
+        uint8_t* payload = reserve(len);
+        if (!payload) return false;
+        memcpy(payload, data, len);
+        commit(payload, len);
+        return true;
+    }
+
+    /// [pop] 복사 기반 추출 구현
+    bool ByteRingBase::pop(void* out, size_t outCapacity, size_t& outLen) {
+        uint8_t* payload;
+        size_t len;
+        if (peekBatch(&payload, &len, 1) == 0) return false;
+        outLen = (len < outCapacity) ? len : outCapacity;
+        memcpy(out, payload, outLen);
+        releaseBatch(1);
+        return true;
+    }
+
+    /// [size] 레코드 개수 조회 구현
+    size_t ByteRingBase::size() const {
+        _mutex.lock();
+        const size_t n = _count;
+        _mutex.unlock();
+        return n;
+    }
+
+    /// [bytesUsed] 사용 바이트 조회 구현
+    size_t ByteRingBase::bytesUsed() const {
+        _mutex.lock();
+        const size_t n = _used;
+        _mutex.unlock();
+        return n;
+    }
+
+    /// [utilization] 현재 사용률 계산 구현
+    float ByteRingBase::utilization() const {
+        if (_capacity == 0) return 0.0f;
+        return (static_cast<float>(bytesUsed()) / _capacity) * 100.0f;
+    }
+
+#ifdef CMS_ENABLE_PROFILING
+    /// [peakUtilization] 최대 사용률 계산 구현
+    float ByteRingBase::peakUtilization() const {
+        if (_capacity == 0) return 0.0f;
+        _mutex.lock();
+        const size_t peak = _peakUsed;
+        _mutex.unlock();
+        return (static_cast<float>(peak) / _capacity) * 100.0f;
+    }
+#endif
+
+    /// [skipWrapMarker] head가 래핑 마커에 도달하면 버퍼 처음으로 이동
+    void ByteRingBase::skipWrapMarker() {
+        if (_used == 0) return;
+        const RecordHeader* h = headerAt(_head);
+        if (h->len == LEN_WRAP) {
+            _used -= h->span;
+            _head = 0;
+        }
+    }
+
+    /// [evictOldest] 가장 오래된 완성 레코드 폐기 구현
+    ///
+    /// 조회 중이거나 기록 중인 레코드는 버릴 수 없으므로 false를 반환합니다.
+    bool ByteRingBase::evictOldest() {
+        if (_readCount > 0 || _count == 0) return false;
+        const RecordHeader* h = headerAt(_head);
+        if (h->len == LEN_WRITING) return false;
+        _used -= h->span;
+        _head += h->span;
+        if (_head == _capacity) _head = 0;
+        _count--;
+        skipWrapMarker();
+        return true;
+    }
+
+} // namespace cms
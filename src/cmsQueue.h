@@ -5,16 +5,270 @@
 #pragma once // 중복 포함 방지
 
 #include <stddef.h> // size_t 정의
+#include <stdint.h> // uint8_t 정의
+#include <string.h> // memcpy (enqueueN/popN)
+#include <atomic>   // SpscQueue의 head/tail 원자 인덱스
+#include <type_traits> // std::is_trivially_copyable
 #ifndef ARDUINO // PC 환경(테스트용) 지원
 #include <mutex> // 표준 뮤텍스 사용
+#include <chrono> // 잠금 대기 시간 측정
+#include <condition_variable> // Signal (블로킹 소비자)
 #endif
 #ifdef ARDUINO // ESP32/Arduino 환경
 #include <freertos/FreeRTOS.h> // FreeRTOS 커널
 #include <freertos/semphr.h> // 세마포어/뮤텍스 API
+#include <esp_timer.h> // 잠금 대기 시간 측정 (esp_timer_get_time)
+#endif
+
+// 락프리 큐의 head/tail 인덱스를 서로 다른 캐시 라인에 배치하기 위한 정렬 크기 (False Sharing 방지)
+#ifndef CMS_CACHE_LINE_SIZE
+#ifdef ARDUINO
+#define CMS_CACHE_LINE_SIZE 4  // ESP32 내부 SRAM은 코어별 데이터 캐시가 없으므로 패딩 불필요
+#else
+#define CMS_CACHE_LINE_SIZE 64 // x86/ARM64 PC 환경의 일반적인 캐시 라인 크기
+#endif
 #endif
 
 namespace cms {
 
+/// [QueueFullPolicy] 큐가 가득 찼을 때의 동작 정책
+///
+/// 새 데이터를 받을 공간이 없을 때 어떤 데이터를 희생할지(또는 기다릴지) 결정합니다.
+enum class QueueFullPolicy : uint8_t {
+    DropNewest = 0,  ///< 새 데이터를 버리고 기존 데이터를 보존 (락프리 큐의 기본값)
+    OverwriteOldest, ///< 가장 오래된 데이터를 버리고 새 데이터를 저장 (Queue/ThreadSafeQueue의 기본 동작)
+    Block            ///< 공간이 생길 때까지 생산자를 재우고, 제한 시간이 지나면 새 데이터를 버림 (ThreadSafeQueue 전용)
+};
+
+/// [WAIT_FOREVER] 블로킹 API의 무제한 대기 값 (밀리초 인자에 사용)
+constexpr uint32_t WAIT_FOREVER = UINT32_MAX;
+
+// ==================================================================================================
+// [Mutex] 개요
+// - 왜 존재하는가: 뮤텍스 기반 큐들이 플랫폼별(FreeRTOS/std) 잠금 코드를 각자 중복 구현하지 않도록 하기 위해 존재합니다.
+// - 어떻게 동작하는가: ARDUINO 환경에서는 FreeRTOS 뮤텍스 세마포어를, 그 외에는 std::mutex를 감싸 lock/unlock만 노출합니다.
+// ==================================================================================================
+
+/// 플랫폼 독립적인 최소 뮤텍스 래퍼입니다.
+///
+/// 사용 예:
+/// @code
+/// cms::Mutex m;
+/// m.lock();
+/// // 임계 영역
+/// m.unlock();
+/// @endcode
+class Mutex {
+public:
+    /// 플랫폼별 뮤텍스를 생성합니다.
+    Mutex() {
+#ifdef ARDUINO
+        _handle = xSemaphoreCreateMutex();
+#endif
+    }
+
+    /// 할당된 뮤텍스 자원을 시스템에 반환합니다.
+    ~Mutex() {
+#ifdef ARDUINO
+        if (_handle) vSemaphoreDelete(_handle);
+#endif
+    }
+
+    Mutex(const Mutex&) = delete;
+    Mutex& operator=(const Mutex&) = delete;
+
+    /// 뮤텍스를 획득하여 임계 영역에 진입합니다.
+    void lock() {
+#ifdef ARDUINO
+        if (_handle) xSemaphoreTake(_handle, portMAX_DELAY);
+#else
+        _mutex.lock();
+#endif
+    }
+
+    /// 기다리지 않고 뮤텍스 획득을 시도합니다.
+    ///
+    /// @return true: 획득함, false: 다른 태스크가 잡고 있음
+    bool tryLock() {
+#ifdef ARDUINO
+        return !_handle || xSemaphoreTake(_handle, 0) == pdTRUE;
+#else
+        return _mutex.try_lock();
+#endif
+    }
+
+    /// 뮤텍스를 해제하여 임계 영역에서 나옵니다.
+    void unlock() {
+#ifdef ARDUINO
+        if (_handle) xSemaphoreGive(_handle);
+#else
+        _mutex.unlock();
+#endif
+    }
+
+private:
+#ifdef ARDUINO
+    /// FreeRTOS 환경에서 사용하는 뮤텍스 제어 핸들.
+    SemaphoreHandle_t _handle = nullptr;
+#else
+    /// 표준 C++ 환경에서 사용하는 뮤텍스 객체.
+    std::mutex _mutex;
+#endif
+};
+
+// ==================================================================================================
+// [Signal] 개요
+// - 왜 존재하는가: 큐가 비었을 때 소비 태스크가 폴링 대신 CPU를 쓰지 않고 잠들었다가, 첫 데이터가 들어오는 즉시 깨어나게 하기 위해 존재합니다.
+// - 어떻게 동작하는가: ARDUINO 환경에서는 FreeRTOS 바이너리 세마포어를, 그 외에는 std::condition_variable과 플래그를 감쌉니다.
+// ==================================================================================================
+
+/// 플랫폼 독립적인 자동 리셋 이벤트(바이너리 세마포어)입니다.
+///
+/// 대기자가 없을 때의 notify()는 한 번 기억되므로, wait() 직전에 도착한 신호를 놓치지 않습니다.
+/// 대신 깨어난 뒤에는 조건을 다시 확인해야 합니다. (여러 번의 notify가 한 번으로 합쳐질 수 있음)
+///
+/// 사용 예:
+/// @code
+/// cms::Signal ready;
+/// ready.notify();                 // 생산 측
+/// if (ready.wait(100)) { ... }    // 소비 측: 최대 100ms 대기
+/// @endcode
+class Signal {
+public:
+    /// 플랫폼별 이벤트 객체를 생성합니다.
+    Signal() {
+#ifdef ARDUINO
+        _handle = xSemaphoreCreateBinary();
+#endif
+    }
+
+    /// 할당된 세마포어 자원을 시스템에 반환합니다.
+    ~Signal() {
+#ifdef ARDUINO
+        if (_handle) vSemaphoreDelete(_handle);
+#endif
+    }
+
+    Signal(const Signal&) = delete;
+    Signal& operator=(const Signal&) = delete;
+
+    /// 대기 중인 태스크 하나를 깨웁니다. 대기자가 없으면 다음 wait()가 즉시 반환합니다.
+    void notify() {
+#ifdef ARDUINO
+        if (_handle) xSemaphoreGive(_handle);
+#else
+        {
+            std::lock_guard<std::mutex> guard(_mutex);
+            _set = true;
+        }
+        _cv.notify_one();
+#endif
+    }
+
+    /// notify()가 올 때까지 최대 timeoutMs 동안 잠듭니다.
+    ///
+    /// @param timeoutMs 최대 대기 시간 (밀리초, WAIT_FOREVER: 무제한)
+    ///
+    /// @return true: 신호를 받음, false: 시간 초과
+    bool wait(uint32_t timeoutMs) {
+#ifdef ARDUINO
+        if (!_handle) return false;
+        TickType_t ticks = (timeoutMs == WAIT_FOREVER) ? portMAX_DELAY : pdMS_TO_TICKS(timeoutMs);
+        if (ticks == 0 && timeoutMs > 0) ticks = 1; // tick 주기보다 짧은 대기가 바쁜 대기로 바뀌지 않도록 올림
+        return xSemaphoreTake(_handle, ticks) == pdTRUE;
+#else
+        std::unique_lock<std::mutex> guard(_mutex);
+        if (timeoutMs == WAIT_FOREVER) {
+            _cv.wait(guard, [this] { return _set; });
+        } else if (!_cv.wait_for(guard, std::chrono::milliseconds(timeoutMs), [this] { return _set; })) {
+            return false;
+        }
+        _set = false;
+        return true;
+#endif
+    }
+
+private:
+#ifdef ARDUINO
+    /// FreeRTOS 바이너리 세마포어 핸들.
+    SemaphoreHandle_t _handle = nullptr;
+#else
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    /// notify()가 소비되지 않고 남아 있는지 여부.
+    bool _set = false;
+#endif
+};
+
+namespace detail {
+
+    /// [NullSignal] 블로킹이 필요 없는 정책에서 Signal 대신 쓰는 빈 이벤트 (RTOS 객체를 만들지 않음)
+    struct NullSignal {
+        void notify() {}
+        bool wait(uint32_t) { return false; }
+    };
+
+} // namespace detail
+
+/// [monotonicMicros] 단조 증가 마이크로초 시계 (uint32, 약 71분마다 순환)
+///
+/// 큐 통계의 잠금 대기 시간처럼 짧은 구간을 재기 위한 용도이므로 차이값((b - a))으로만 사용하세요.
+inline uint32_t monotonicMicros() {
+#ifdef ARDUINO
+    return (uint32_t)esp_timer_get_time();
+#else
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+/// [monotonicMicros64] 순환하지 않는 64비트 단조 증가 마이크로초 시계
+///
+/// 로그 반복 억제 구간이나 토큰 버킷 보충처럼 수 시간 이상 떨어진 두 시각을 비교해야 하는 곳에 사용합니다.
+inline uint64_t monotonicMicros64() {
+#ifdef ARDUINO
+    return (uint64_t)esp_timer_get_time();
+#else
+    return (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+namespace detail {
+
+    /// [waitRemaining] start(monotonicMicros()) 이후 timeoutMs 중 남은 밀리초 (WAIT_FOREVER는 그대로, 지났으면 0)
+    inline uint32_t waitRemaining(uint32_t start, uint32_t timeoutMs) {
+        if (timeoutMs == WAIT_FOREVER) return WAIT_FOREVER;
+        const uint32_t elapsedMs = (monotonicMicros() - start) / 1000u;
+        return (elapsedMs >= timeoutMs) ? 0 : timeoutMs - elapsedMs;
+    }
+
+    /// [ringAdvance] 원형 인덱스 i(0 ~ N-1)를 k(0 ~ N)만큼 전진시킵니다.
+    ///
+    /// Why: `% N`은 N이 2의 거듭제곱이 아니면 Xtensa에서 실제 나눗셈 명령이 되기 때문입니다.
+    /// How: N이 2의 거듭제곱이면 컴파일 타임에 마스크(&)로, 아니면 비교와 뺄셈 한 번으로 순환합니다.
+    template <size_t N>
+    constexpr size_t ringAdvance(size_t i, size_t k) noexcept {
+        if constexpr ((N & (N - 1)) == 0) {
+            return (i + k) & (N - 1);
+        } else {
+            const size_t j = i + k;
+            return (j >= N) ? j - N : j;
+        }
+    }
+
+    /// [copyRun] 연속된 n개의 원소를 복사합니다. (trivially copyable 타입은 memcpy 한 번)
+    template <typename T>
+    void copyRun(T* dst, const T* src, size_t n) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (n) memcpy(dst, src, n * sizeof(T));
+        } else {
+            for (size_t i = 0; i < n; ++i) dst[i] = src[i];
+        }
+    }
+
+} // namespace detail
+
 // ==================================================================================================
 // [Queue] 개요
 // - 왜 존재하는가: 동적 할당 없이 고정된 메모리 내에서 데이터를 관리하기 위해 존재합니다.
@@ -30,7 +284,11 @@ namespace cms {
 /// @tparam N 큐의 최대 용량
 template <typename T, size_t N>
 class Queue {
+    static_assert(N >= 1, "cms::Queue size N must be at least 1.");
 public:
+    /// 예약/조회된 슬롯을 가리키는 핸들 타입 (큐 내부 데이터에 대한 포인터)
+    using Slot = T*;
+
     /// 큐의 상태를 초기화합니다.
     ///
     /// 사용 예:
@@ -53,12 +311,12 @@ public:
     void enqueue(const T& item) {
         // 큐가 가득 찬 경우 헤드를 밀어내어 공간 확보
         if (isFull()) {
-            _head = (_head + 1) % N;
+            _head = advance(_head, 1);
             _count--;
         }
         // 데이터 저장 및 테일 포인터 이동
         _data[_tail] = item;
-        _tail = (_tail + 1) % N;
+        _tail = advance(_tail, 1);
         _count++;
     }
 
@@ -80,11 +338,208 @@ public:
         if (isEmpty()) return false;
         // 헤드 위치의 데이터 추출 및 인덱스 갱신
         outItem = _data[_head];
-        _head = (_head + 1) % N;
+        _head = advance(_head, 1);
+        _count--;
+        return true;
+    }
+
+    /// 다음 쓰기 슬롯을 예약하여 복사 없이 제자리에서 데이터를 기록할 수 있게 합니다.
+    ///
+    /// Why: 큰 객체(로그 문자열 등)를 임시 변수에 만든 뒤 enqueue로 다시 복사하는 비용을 없애기 위함입니다.
+    /// How: enqueue와 동일하게 가득 찬 경우 가장 오래된 데이터를 밀어내고, 테일을 즉시 전진시킵니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// cms::Queue<Packet, 8>::Slot slot = queue.reserve();
+    /// slot->len = 0; // 슬롯에 직접 기록
+    /// queue.commit(slot);
+    /// @endcode
+    ///
+    /// @return 기록할 슬롯 핸들 (Queue는 항상 성공)
+    Slot reserve() {
+        if (isFull()) {
+            _head = advance(_head, 1);
+            _count--;
+        }
+        Slot slot = &_data[_tail];
+        _tail = advance(_tail, 1);
+        _count++;
+        return slot;
+    }
+
+    /// reserve()로 예약한 슬롯의 기록 완료를 알립니다. (단일 태스크 전용 큐이므로 추가 동작 없음)
+    ///
+    /// @param slot reserve()가 반환한 슬롯 핸들
+    void commit(Slot slot) { (void)slot; }
+
+    /// 빈 자리가 있을 때만 다음 쓰기 슬롯을 예약합니다. (가장 오래된 데이터를 밀어내지 않음)
+    ///
+    /// Why: 기록 결과에 따라 버려질 수 있는 데이터(필터링되는 로그 등)가 기존 데이터를 밀어내지 않게 하기 위함입니다.
+    ///
+    /// @return 기록할 슬롯 핸들, 가득 찼으면 nullptr
+    Slot tryReserve() { return isFull() ? nullptr : reserve(); }
+
+    /// reserve()로 예약한 슬롯을 commit하지 않고 반환합니다.
+    ///
+    /// Why: 기록 도중 저장하지 않기로 한 데이터가 빈 슬롯으로 남아 공간을 차지하지 않게 하기 위함입니다.
+    /// How: 가장 최근에 예약한 슬롯이면 테일을 되돌립니다. 그 뒤에 다른 예약이 있으면 되돌릴 수 없으므로 false를 반환하며,
+    ///      이때 슬롯은 예약된 상태 그대로이므로 호출자가 빈 데이터로 표시하여 commit해야 합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// if (fill(*slot)) queue.commit(slot);
+    /// else if (!queue.cancel(slot)) { slot->len = 0; queue.commit(slot); }
+    /// @endcode
+    ///
+    /// @param slot reserve()가 반환한 슬롯 핸들
+    ///
+    /// @return true: 예약 반환, false: 뒤에 다른 예약이 있어 반환하지 못함 (commit 필요)
+    bool cancel(Slot slot) {
+        const size_t last = advance(_tail, N - 1);
+        if (_count == 0 || slot != &_data[last]) return false;
+        _tail = last;
         _count--;
         return true;
     }
 
+    /// 가장 오래된 데이터를 복사하지 않고 제자리에서 조회합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// if (cms::Queue<Packet, 8>::Slot slot = queue.peek()) {
+    ///     send(*slot);
+    ///     queue.release(slot);
+    /// }
+    /// @endcode
+    ///
+    /// @return 가장 오래된 슬롯 핸들, 비어있으면 nullptr
+    Slot peek() { return isEmpty() ? nullptr : &_data[_head]; }
+
+    /// peek()으로 조회한 슬롯의 사용을 마치고 큐에서 제거합니다.
+    ///
+    /// @param slot peek()이 반환한 슬롯 핸들
+    void release(Slot slot) {
+        (void)slot;
+        if (isEmpty()) return;
+        _head = advance(_head, 1);
+        _count--;
+    }
+
+    /// 가장 오래된 데이터부터 최대 maxCount개의 슬롯을 한 번에 조회합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// cms::Queue<Packet, 8>::Slot slots[8];
+    /// size_t n = queue.peekBatch(slots, 8);
+    /// sendAll(slots, n);
+    /// queue.releaseBatch(slots, n);
+    /// @endcode
+    ///
+    /// @param outSlots [OUT] 조회된 슬롯 핸들을 저장할 배열 (최소 maxCount개)
+    /// @param maxCount 조회할 최대 개수
+    ///
+    /// @return 실제 조회된 슬롯 개수
+    size_t peekBatch(Slot* outSlots, size_t maxCount) {
+        const size_t n = (maxCount < _count) ? maxCount : _count;
+        for (size_t i = 0; i < n; ++i) outSlots[i] = &_data[advance(_head, i)];
+        return n;
+    }
+
+    /// peekBatch()로 조회한 슬롯들을 한 번에 큐에서 제거합니다.
+    ///
+    /// @param slots peekBatch()가 채운 슬롯 핸들 배열
+    /// @param count 제거할 개수 (peekBatch()의 반환값 이하)
+    void releaseBatch(const Slot* slots, size_t count) {
+        (void)slots;
+        if (count > _count) count = _count;
+        _head = advance(_head, count);
+        _count -= count;
+    }
+
+    /// 여러 개의 데이터를 한 번에 추가합니다. 공간이 부족하면 가장 오래된 데이터부터 덮어씁니다.
+    ///
+    /// Why: 센서 샘플 묶음처럼 여러 원소를 옮길 때 원소마다 enqueue를 호출하는 비용을 없애기 위함입니다.
+    /// How: 필요한 만큼 헤드를 한 번에 밀어낸 뒤, 배열 끝에서 끊기는 지점을 기준으로 최대 두 구간으로 나누어 복사합니다.
+    ///      (trivially copyable 타입은 구간마다 memcpy 한 번)
+    ///
+    /// 사용 예:
+    /// @code
+    /// int16_t samples[64];
+    /// queue.enqueueN(samples, 64);
+    /// @endcode
+    ///
+    /// @param items 추가할 데이터 배열
+    /// @param n 추가할 개수 (N보다 많으면 마지막 N개만 남음)
+    ///
+    /// @return 저장된 개수 (min(n, N))
+    size_t enqueueN(const T* items, size_t n) {
+        if (n > N) {
+            // 어차피 덮어써질 앞부분은 건너뜀
+            items += n - N;
+            n = N;
+        }
+        if (n > N - _count) {
+            const size_t drop = n - (N - _count);
+            _head = advance(_head, drop);
+            _count -= drop;
+        }
+        const size_t first = (n < N - _tail) ? n : N - _tail;
+        detail::copyRun(&_data[_tail], items, first);
+        detail::copyRun(&_data[0], items + first, n - first);
+        _tail = advance(_tail, n);
+        _count += n;
+        return n;
+    }
+
+    /// 가장 오래된 데이터부터 최대 n개를 한 번에 꺼냅니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// int16_t batch[32];
+    /// size_t got = queue.popN(batch, 32);
+    /// @endcode
+    ///
+    /// @param outItems [OUT] 꺼낸 데이터를 저장할 배열 (최소 n개)
+    /// @param n 꺼낼 최대 개수
+    ///
+    /// @return 실제로 꺼낸 개수
+    size_t popN(T* outItems, size_t n) {
+        if (n > _count) n = _count;
+        const size_t first = (n < N - _head) ? n : N - _head;
+        detail::copyRun(outItems, &_data[_head], first);
+        detail::copyRun(outItems + first, &_data[0], n - first);
+        _head = advance(_head, n);
+        _count -= n;
+        return n;
+    }
+
+    /// 가장 오래된 데이터부터 배열 끝(순환 지점) 전까지의 연속 구간을 복사 없이 조회합니다.
+    ///
+    /// Why: DMA 전송이나 write()처럼 연속 메모리를 받는 API에 큐 내용을 그대로 넘기기 위함입니다.
+    /// How: 순환 지점에서 끊기므로, 남은 데이터는 releaseN() 후 다시 호출하여 두 번째 구간으로 받습니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// size_t n;
+    /// while (cms::Queue<uint8_t, 256>::Slot p = queue.peekContiguous(n)) {
+    ///     uart.write(p, n);
+    ///     queue.releaseN(n);
+    /// }
+    /// @endcode
+    ///
+    /// @param outCount [OUT] 구간의 원소 개수 (비어있으면 0)
+    ///
+    /// @return 구간의 첫 슬롯, 비어있으면 nullptr
+    Slot peekContiguous(size_t& outCount) {
+        outCount = (_count < N - _head) ? _count : N - _head;
+        return outCount ? &_data[_head] : nullptr;
+    }
+
+    /// 가장 오래된 데이터부터 count개를 복사 없이 제거합니다. (peekContiguous()와 짝)
+    ///
+    /// @param count 제거할 개수 (저장된 개수보다 많으면 모두 제거)
+    void releaseN(size_t count) { releaseBatch(nullptr, count); }
+
     /// 특정 인덱스(상대적 위치)의 데이터를 조회합니다.
     ///
     /// 큐를 비우지 않고 내부 데이터를 순회하거나 특정 시점의 기록을 찾기 위함입니다.
@@ -103,7 +558,7 @@ public:
     bool getAt(size_t index, T& outItem) const {
         if (index >= _count) return false;
         // 원형 버퍼의 물리적 위치 계산
-        size_t pos = (_head + index) % N;
+        size_t pos = advance(_head, index);
         outItem = _data[pos];
         return true;
     }
@@ -135,16 +590,39 @@ public:
     size_t size() const { return _count; }
 
 private:
+    /// 인덱스 i를 k만큼 순환 전진시킵니다. (N이 2의 거듭제곱이면 마스크 연산)
+    static constexpr size_t advance(size_t i, size_t k) { return detail::ringAdvance<N>(i, k); }
+
     /// 데이터를 저장하는 고정 크기 정적 배열.
     T _data[N];
     /// 읽기 작업을 수행할 가장 오래된 데이터의 인덱스.
     size_t _head;
     /// 쓰기 작업을 수행할 다음 데이터의 저장 위치 인덱스.
     size_t _tail;
-    /// 현재 큐에 저장된 유효 데이터의 총 개수 (0 ~ N).
+    /// 현재 큐에 저장된 유효 데이터의 총 개수 (0 ~ N). head == tail일 때 빈 큐와 가득 찬 큐를 슬롯 낭비 없이 구분합니다.
     size_t _count;
 };
 
+/// [QueueStats] 큐 운영 통계 스냅샷
+///
+/// 실제 부하에서 큐 깊이(N)를 정하기 위한 지표입니다. 모든 값은 생성 또는 resetStats() 이후 누적값이며,
+/// 카운터는 uint32로 순환합니다.
+///
+/// 사용 예:
+/// @code
+/// cms::QueueStats st = tsQueue.stats();
+/// if (st.overwritten > 0) { /* 소비가 생산을 따라가지 못함: N을 늘리거나 소비 주기를 줄임 */ }
+/// @endcode
+struct QueueStats {
+    uint32_t enqueued = 0;      ///< 예약(reserve/enqueue)에 성공한 횟수 (cancel()로 반환한 예약 제외)
+    uint32_t overwritten = 0;   ///< 가득 차서 밀려난 가장 오래된 데이터 수
+    uint32_t dropped = 0;       ///< 가장 오래된 슬롯이 사용 중이라 버려진 새 데이터 수
+    uint32_t highWater = 0;     ///< 동시에 저장되었던 최대 개수 (기록 중인 슬롯 포함)
+    uint32_t contended = 0;     ///< 뮤텍스를 바로 얻지 못하고 기다린 횟수
+    uint32_t lockWaitUs = 0;    ///< 뮤텍스 대기 시간 합계 (마이크로초)
+    uint32_t maxLockWaitUs = 0; ///< 뮤텍스 대기 시간 최댓값 (마이크로초)
+};
+
 // ==================================================================================================
 // [ThreadSafeQueue] 개요
 // - 왜 존재하는가: 멀티태스킹 환경에서 여러 태스크가 동시에 큐에 접근할 때 발생하는 데이터 오염을 방지합니다.
@@ -154,43 +632,44 @@ private:
 /// 뮤텍스를 사용하여 스레드 안전(Thread-Safe)을 보장하는 큐 클래스입니다.
 ///
 /// Why: 인터럽트나 멀티태스크 환경에서 데이터 경합(Race Condition)을 방지하기 위함입니다.
-/// How: 모든 공개 메서드 실행 시 내부 뮤텍스를 획득(Lock)하고 종료 시 해제(Unlock)합니다.
+/// How: 인덱스와 슬롯 상태를 조작하는 짧은 구간에서만 뮤텍스를 획득(Lock)하고, 슬롯 데이터의 기록/조회는 잠금 밖에서 수행합니다.
+///      소비자는 popWait()/peekWait()로 데이터가 들어올 때까지 CPU를 쓰지 않고 잠들 수 있습니다.
+///
+/// 사용 예:
+/// @code
+/// // 가득 차면 생산자가 최대 50ms 기다리는 큐
+/// cms::ThreadSafeQueue<Sample, 64, cms::QueueFullPolicy::Block> q;
+/// q.setBlockTimeout(50);
+/// @endcode
 ///
 /// @tparam T 저장할 데이터 타입
 /// @tparam N 큐의 최대 용량
-template <typename T, size_t N>
+/// @tparam Policy 가득 찼을 때의 동작 (기본값: OverwriteOldest, 가장 오래된 슬롯이 사용 중이면 새 데이터를 버림)
+template <typename T, size_t N, QueueFullPolicy Policy = QueueFullPolicy::OverwriteOldest>
 class ThreadSafeQueue {
+    static_assert(N >= 1, "cms::ThreadSafeQueue size N must be at least 1.");
 public:
-    /// 뮤텍스를 생성하고 내부 큐를 초기화합니다.
+    /// Block 정책의 기본 대기 제한 시간 (밀리초)
     ///
-    /// 사용 예:
-    /// @code
-    /// cms::ThreadSafeQueue<int, 5> tsQueue;
-    /// @endcode
-    ThreadSafeQueue() {
-        // 플랫폼별 뮤텍스 초기화
-#ifdef ARDUINO
-        _mutex = xSemaphoreCreateMutex();
-#endif
-    }
+    /// 소비 태스크가 아직 시작되지 않은 부팅 초기에 생산자가 영원히 멈추지 않도록 유한한 값을 기본으로 둡니다.
+    static constexpr uint32_t DEFAULT_BLOCK_TIMEOUT_MS = 100;
 
-    /// 할당된 뮤텍스 자원을 시스템에 반환합니다.
+    /// 내부 큐를 초기화합니다. (뮤텍스는 멤버 Mutex가 생성/해제)
     ///
     /// 사용 예:
     /// @code
-    /// delete tsQueue; // 소멸자 자동 호출
+    /// cms::ThreadSafeQueue<int, 5> tsQueue;
     /// @endcode
-    ~ThreadSafeQueue() {
-        // 할당된 뮤텍스 자원 해제
-#ifdef ARDUINO
-        if (_mutex) {
-            vSemaphoreDelete(_mutex);
-        }
-#endif
-    }
+    ThreadSafeQueue() = default;
+
+    /// 예약/조회된 슬롯을 가리키는 핸들 타입 (큐 내부 데이터에 대한 포인터)
+    using Slot = T*;
 
     /// 뮤텍스 잠금 후 데이터를 안전하게 추가합니다.
     ///
+    /// 가득 찬 경우의 동작은 Policy를 따릅니다. (OverwriteOldest: 가장 오래된 데이터를 덮어쓰되 기록/조회 중이면 새 데이터를 버림,
+    /// DropNewest: 새 데이터를 버림, Block: 공간이 생길 때까지 최대 setBlockTimeout() 동안 대기)
+    ///
     /// 사용 예:
     /// @code
     /// tsQueue.enqueue(50);
@@ -198,9 +677,10 @@ public:
     ///
     /// @param item 추가할 데이터 참조
     void enqueue(const T& item) {
-        lock();
-        _queue.enqueue(item);
-        unlock();
+        Slot slot = reserve();
+        if (!slot) return;
+        *slot = item;
+        commit(slot);
     }
 
     /// 뮤텍스 잠금 후 데이터를 안전하게 꺼내옵니다.
@@ -213,89 +693,1271 @@ public:
     ///
     /// @param outItem [OUT] 꺼낸 데이터를 저장할 참조 변수
     ///
-    /// @return true: 성공, false: 큐가 비어있음
+    /// @return true: 성공, false: 큐가 비어있음 (또는 가장 오래된 슬롯이 아직 기록 중)
     bool pop(T& outItem) {
-        lock();
-        bool ok = _queue.pop(outItem);
-        unlock();
-        return ok;
+        Slot slot = peek();
+        if (!slot) return false;
+        outItem = *slot;
+        release(slot);
+        return true;
     }
 
-    /// 뮤텍스 잠금 후 특정 인덱스의 데이터를 안전하게 조회합니다.
+    /// 데이터가 들어올 때까지 최대 timeoutMs 동안 잠들었다가 꺼내옵니다.
+    ///
+    /// Why: 소비 태스크가 폴링 루프나 주기적 sleep 없이, 대기 중에는 CPU를 쓰지 않고 첫 데이터에 즉시 반응하게 하기 위함입니다.
+    /// How: peekWait()로 슬롯을 얻은 뒤 pop()과 같이 복사하고 제거합니다.
     ///
     /// 사용 예:
     /// @code
-    /// int data;
-    /// if (tsQueue.getAt(0, data)) { ... }
+    /// Sample s;
+    /// while (q.popWait(s, cms::WAIT_FOREVER)) process(s);
     /// @endcode
     ///
-    /// @param index 조회할 상대적 인덱스
-    /// @param outItem [OUT] 조회된 데이터를 저장할 참조 변수
+    /// @param outItem [OUT] 꺼낸 데이터를 저장할 참조 변수
+    /// @param timeoutMs 최대 대기 시간 (밀리초, 0: 기다리지 않음, WAIT_FOREVER: 무제한)
     ///
-    /// @return true: 조회 성공, false: 범위 초과
-    bool getAt(size_t index, T& outItem) const {
-        lock();
-        bool ok = _queue.getAt(index, outItem);
-        unlock();
-        return ok;
+    /// @return true: 성공, false: 시간 초과
+    bool popWait(T& outItem, uint32_t timeoutMs) {
+        Slot slot = peekWait(timeoutMs);
+        if (!slot) return false;
+        outItem = *slot;
+        release(slot);
+        return true;
     }
 
-    /// 큐가 비어있는지 스레드 안전하게 확인합니다.
+    /// 다음 쓰기 슬롯을 예약합니다. 뮤텍스는 예약 순간에만 잡고 기록 중에는 해제된 상태입니다.
+    ///
+    /// Why: 로그 포맷팅처럼 긴 기록 작업 동안 다른 태스크를 막지 않으면서, 복사 없이 큐 내부 메모리에 직접 쓰기 위함입니다.
+    /// How: 슬롯별 상태(Writing/Ready/Reading)를 두어, 기록 중인 슬롯은 소비자와 덮어쓰기 대상에서 제외합니다.
     ///
     /// 사용 예:
     /// @code
-    /// if (tsQueue.isEmpty()) { ... }
+    /// if (cms::ThreadSafeQueue<Packet, 8>::Slot slot = tsQueue.reserve()) {
+    ///     fill(*slot);
+    ///     tsQueue.commit(slot);
+    /// }
     /// @endcode
-    bool isEmpty() const { lock(); bool empty = _queue.isEmpty(); unlock(); return empty; }
+    ///
+    /// @return 기록할 슬롯 핸들, 가득 차서 공간을 확보하지 못하면 nullptr (정책별 조건은 enqueue() 참고)
+    Slot reserve() { return claimSlot(true); }
 
-    /// 큐가 가득 찼는지 스레드 안전하게 확인합니다.
+    /// reserve()로 예약한 슬롯의 기록 완료를 알리고 소비자에게 공개합니다.
+    ///
+    /// @param slot reserve()가 반환한 슬롯 핸들
+    void commit(Slot slot) {
+        lock();
+        _state[slot - _data] = Ready;
+        const bool wakeConsumer = (_popWaiters > 0);
+        unlock();
+        if (wakeConsumer) _notEmpty.notify();
+    }
+
+    /// 빈 자리가 있을 때만 다음 쓰기 슬롯을 예약합니다. (Policy와 무관하게 덮어쓰거나 기다리지 않으며, dropped에 집계하지 않음)
+    ///
+    /// Why: 기록 결과에 따라 버려질 수 있는 데이터(필터링되는 로그 등)가 기존 데이터를 밀어내거나 생산자를 재우지 않게 하기 위함입니다.
+    ///      실패하면 호출자가 저장 여부를 먼저 확정한 뒤 reserve()로 다시 예약합니다.
+    ///
+    /// @return 기록할 슬롯 핸들, 가득 찼으면 nullptr
+    Slot tryReserve() { return claimSlot(false); }
+
+    /// reserve()로 예약한 슬롯을 commit하지 않고 반환합니다.
+    ///
+    /// Why: 기록 도중 저장하지 않기로 한 데이터가 빈 슬롯으로 남아 공간을 차지하지 않게 하기 위함입니다.
+    /// How: 가장 최근에 예약한 슬롯이면 테일을 되돌리고 enqueued 집계에서도 뺍니다. 그 뒤에 다른 태스크의 예약이 있으면
+    ///      되돌릴 수 없으므로 false를 반환하며, 이때 슬롯은 예약된 상태 그대로이므로 호출자가 빈 데이터로 표시하여 commit해야 합니다.
     ///
     /// 사용 예:
     /// @code
-    /// if (tsQueue.isFull()) { ... }
+    /// if (fill(*slot)) tsQueue.commit(slot);
+    /// else if (!tsQueue.cancel(slot)) { slot->len = 0; tsQueue.commit(slot); }
     /// @endcode
-    bool isFull() const { lock(); bool full = _queue.isFull(); unlock(); return full; }
+    ///
+    /// @param slot reserve()가 반환한 슬롯 핸들
+    ///
+    /// @return true: 예약 반환, false: 뒤에 다른 예약이 있어 반환하지 못함 (commit 필요)
+    bool cancel(Slot slot) {
+        lock();
+        const size_t last = advance(_tail, N - 1);
+        const bool newest = (_count > 0 && slot == &_data[last] && _state[last] == Writing);
+        if (newest) {
+            _state[last] = Free;
+            _tail = last;
+            _count--;
+            const uint32_t enqueued = _enqueued.load(std::memory_order_relaxed);
+            if (enqueued > 0) _enqueued.store(enqueued - 1, std::memory_order_relaxed);
+        }
+        const bool wakeProducer = (newest && _pushWaiters > 0);
+        unlock();
+        if (wakeProducer) _notFull.notify();
+        return newest;
+    }
 
-    /// 현재 데이터 개수를 스레드 안전하게 조회합니다.
+    /// 가장 오래된 데이터를 복사하지 않고 제자리에서 조회합니다.
+    ///
+    /// 조회 중인 슬롯은 release() 전까지 덮어쓰지 않으므로 뮤텍스 없이 출력 작업을 수행할 수 있습니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// if (cms::ThreadSafeQueue<Packet, 8>::Slot slot = tsQueue.peek()) {
+    ///     send(*slot);
+    ///     tsQueue.release(slot);
+    /// }
+    /// @endcode
+    ///
+    /// @return 가장 오래된 슬롯 핸들, 비어있거나 아직 기록 중(또는 다른 태스크가 조회 중)이면 nullptr
+    Slot peek() {
+        lock();
+        if (_count == 0 || _state[_head] != Ready) {
+            unlock();
+            return nullptr;
+        }
+        _state[_head] = Reading;
+        Slot slot = &_data[_head];
+        unlock();
+        return slot;
+    }
+
+    /// 완성된 데이터가 들어올 때까지 최대 timeoutMs 동안 잠들었다가 가장 오래된 슬롯을 조회합니다.
+    ///
+    /// How: 가장 오래된 슬롯이 Ready가 아니면 대기자 수를 올리고 잠금을 푼 채 Signal에서 잠듭니다.
+    ///      commit()은 대기자가 있을 때만 Signal을 울리므로, 아무도 기다리지 않는 평상시에는 추가 비용이 없습니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// if (cms::ThreadSafeQueue<Packet, 8>::Slot slot = tsQueue.peekWait(1000)) {
+    ///     send(*slot);
+    ///     tsQueue.release(slot);
+    /// }
+    /// @endcode
+    ///
+    /// @param timeoutMs 최대 대기 시간 (밀리초, 0: 기다리지 않음, WAIT_FOREVER: 무제한)
+    ///
+    /// @return 가장 오래된 슬롯 핸들, 시간 초과 시 nullptr
+    Slot peekWait(uint32_t timeoutMs) {
+        const uint32_t start = monotonicMicros();
+        lock();
+        while (_count == 0 || _state[_head] != Ready) {
+            const uint32_t remaining = detail::waitRemaining(start, timeoutMs);
+            if (remaining == 0) {
+                unlock();
+                return nullptr;
+            }
+            _popWaiters++;
+            unlock();
+            _notEmpty.wait(remaining);
+            lock();
+            _popWaiters--;
+        }
+        _state[_head] = Reading;
+        Slot slot = &_data[_head];
+        unlock();
+        return slot;
+    }
+
+    /// peek()으로 조회한 슬롯의 사용을 마치고 큐에서 제거합니다.
+    ///
+    /// @param slot peek()이 반환한 슬롯 핸들
+    void release(Slot slot) {
+        (void)slot; // 조회는 항상 가장 오래된 슬롯(_head)에서만 이루어짐
+        lock();
+        _state[_head] = Free;
+        _head = advance(_head, 1);
+        _count--;
+        unlockAndWake();
+    }
+
+    /// 한 번의 뮤텍스 획득으로 가장 오래된 슬롯부터 최대 maxCount개를 조회합니다.
+    ///
+    /// Why: 로그 폭주 시 메시지마다 잠금을 반복하지 않고, 출력 장치가 여러 메시지를 묶어 전송할 수 있게 하기 위함입니다.
+    /// How: 기록이 끝난(Ready) 슬롯이 연속된 구간까지만 Reading 상태로 전환합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// cms::ThreadSafeQueue<Packet, 8>::Slot slots[8];
+    /// size_t n = tsQueue.peekBatch(slots, 8);
+    /// sendAll(slots, n);
+    /// tsQueue.releaseBatch(slots, n);
+    /// @endcode
+    ///
+    /// @param outSlots [OUT] 조회된 슬롯 핸들을 저장할 배열 (최소 maxCount개)
+    /// @param maxCount 조회할 최대 개수
+    ///
+    /// @return 실제 조회된 슬롯 개수 (다른 태스크가 조회 중이면 0)
+    size_t peekBatch(Slot* outSlots, size_t maxCount) {
+        lock();
+        size_t n = 0;
+        while (n < maxCount && n < _count) {
+            const size_t pos = advance(_head, n);
+            if (_state[pos] != Ready) break;
+            _state[pos] = Reading;
+            outSlots[n++] = &_data[pos];
+        }
+        unlock();
+        return n;
+    }
+
+    /// 한 번의 뮤텍스 획득으로 peekBatch()가 조회한 슬롯들을 큐에서 제거합니다.
+    ///
+    /// @param slots peekBatch()가 채운 슬롯 핸들 배열
+    /// @param count 제거할 개수 (peekBatch()의 반환값과 같아야 함)
+    void releaseBatch(const Slot* slots, size_t count) {
+        (void)slots;
+        lock();
+        for (size_t i = 0; i < count; ++i) {
+            _state[_head] = Free;
+            _head = advance(_head, 1);
+        }
+        _count -= count;
+        unlockAndWake();
+    }
+
+    /// 여러 개의 데이터를 적은 뮤텍스 왕복으로 추가합니다.
+    ///
+    /// Why: 원소마다 enqueue를 호출하면 원소 수만큼 잠금을 반복하기 때문입니다.
+    /// How: 잠금 안에서 공간을 확보하고 구간 전체를 Writing으로 예약한 뒤, 잠금 밖에서 최대 두 구간으로 나누어 복사하고
+    ///      다시 잠금 안에서 한 번에 Ready로 공개합니다. (구간 하나당 뮤텍스 왕복 두 번)
+    ///
+    /// 가득 찼을 때는 Policy를 따릅니다.
+    /// - OverwriteOldest: 완성된(Ready) 가장 오래된 데이터부터 덮어쓰고, 그래도 모자라면 items의 앞쪽(오래된) 원소를 버림
+    /// - DropNewest: 들어가는 만큼만 저장하고 items의 뒤쪽(새) 원소를 버림
+    /// - Block: 공간이 생기는 대로 나누어 저장하며, 제한 시간이 지나면 남은 원소를 버림
+    ///
+    /// 사용 예:
+    /// @code
+    /// int16_t samples[64];
+    /// size_t stored = tsQueue.enqueueN(samples, 64);
+    /// @endcode
+    ///
+    /// @param items 추가할 데이터 배열
+    /// @param n 추가할 개수
+    ///
+    /// @return 실제로 저장된 개수
+    size_t enqueueN(const T* items, size_t n) {
+        if (n == 0) return 0;
+        size_t stored = 0;
+        lock();
+        if constexpr (Policy == QueueFullPolicy::OverwriteOldest) {
+            if (n > N) {
+                // 어차피 덮어써질 앞부분은 건너뜀
+                bump(_overwritten, (uint32_t)(n - N));
+                items += n - N;
+                n = N;
+            }
+            while (_count + n > N && _count > 0 && _state[_head] == Ready) evictHead();
+            if (n > N - _count) {
+                const size_t lost = n - (N - _count);
+                bump(_dropped, (uint32_t)lost);
+                items += lost;
+                n -= lost;
+            }
+        }
+        const uint32_t start = (Policy == QueueFullPolicy::Block) ? monotonicMicros() : 0;
+        while (n > 0) {
+            const size_t room = N - _count;
+            if (room == 0) {
+                if constexpr (Policy == QueueFullPolicy::Block) {
+                    if (waitForRoom(start)) continue;
+                }
+                break;
+            }
+            const size_t take = (n < room) ? n : room;
+            storeRun(items, take);
+            items += take;
+            n -= take;
+            stored += take;
+        }
+        if (n > 0) bump(_dropped, (uint32_t)n);
+        unlock();
+        return stored;
+    }
+
+    /// 가장 오래된 데이터부터 최대 n개를 뮤텍스 왕복 두 번으로 꺼냅니다.
+    ///
+    /// 기록이 끝난(Ready) 슬롯이 연속된 구간까지만 꺼내며, 복사는 잠금 밖에서 최대 두 구간으로 나누어 수행합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// int16_t batch[32];
+    /// size_t got = tsQueue.popN(batch, 32);
+    /// @endcode
+    ///
+    /// @param outItems [OUT] 꺼낸 데이터를 저장할 배열 (최소 n개)
+    /// @param n 꺼낼 최대 개수
+    ///
+    /// @return 실제로 꺼낸 개수 (다른 태스크가 조회 중이면 0)
+    size_t popN(T* outItems, size_t n) {
+        lock();
+        const size_t start = _head;
+        size_t k = 0;
+        while (k < n && k < _count) {
+            const size_t pos = advance(start, k);
+            if (_state[pos] != Ready) break;
+            _state[pos] = Reading;
+            k++;
+        }
+        unlock();
+        if (k == 0) return 0;
+
+        // Reading 상태의 헤드는 다른 태스크가 옮길 수 없으므로 잠금 없이 복사
+        const size_t first = (k < N - start) ? k : N - start;
+        detail::copyRun(outItems, &_data[start], first);
+        detail::copyRun(outItems + first, &_data[0], k - first);
+        releaseBatch(nullptr, k);
+        return k;
+    }
+
+    /// 가장 오래된 데이터부터 배열 끝(순환 지점) 전까지의 완성된 연속 구간을 복사 없이 조회합니다.
+    ///
+    /// 조회한 구간은 releaseN() 전까지 덮어쓰지 않으므로 뮤텍스 없이 DMA/write()에 그대로 넘길 수 있습니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// size_t n;
+    /// if (cms::ThreadSafeQueue<uint8_t, 256>::Slot p = tsQueue.peekContiguous(n)) {
+    ///     uart.write(p, n);
+    ///     tsQueue.releaseN(n);
+    /// }
+    /// @endcode
+    ///
+    /// @param outCount [OUT] 구간의 원소 개수 (없으면 0)
+    ///
+    /// @return 구간의 첫 슬롯, 비어있거나 가장 오래된 슬롯이 기록/조회 중이면 nullptr
+    Slot peekContiguous(size_t& outCount) {
+        lock();
+        const size_t limit = (_count < N - _head) ? _count : N - _head;
+        size_t k = 0;
+        while (k < limit && _state[_head + k] == Ready) {
+            _state[_head + k] = Reading;
+            k++;
+        }
+        Slot first = k ? &_data[_head] : nullptr;
+        unlock();
+        outCount = k;
+        return first;
+    }
+
+    /// peekContiguous()로 조회한 count개를 한 번의 뮤텍스 획득으로 제거합니다.
+    ///
+    /// @param count 제거할 개수 (peekContiguous()가 알려준 개수와 같아야 함)
+    void releaseN(size_t count) { releaseBatch(nullptr, count); }
+
+    /// 뮤텍스 잠금 후 특정 인덱스의 데이터를 안전하게 조회합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// int data;
+    /// if (tsQueue.getAt(0, data)) { ... }
+    /// @endcode
+    ///
+    /// @param index 조회할 상대적 인덱스
+    /// @param outItem [OUT] 조회된 데이터를 저장할 참조 변수
+    ///
+    /// @return true: 조회 성공, false: 범위 초과 또는 기록 중인 슬롯
+    bool getAt(size_t index, T& outItem) const {
+        lock();
+        bool ok = false;
+        if (index < _count) {
+            const size_t pos = advance(_head, index);
+            if (_state[pos] != Writing) {
+                outItem = _data[pos];
+                ok = true;
+            }
+        }
+        unlock();
+        return ok;
+    }
+
+    /// 큐가 비어있는지 스레드 안전하게 확인합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// if (tsQueue.isEmpty()) { ... }
+    /// @endcode
+    bool isEmpty() const { lock(); bool empty = (_count == 0); unlock(); return empty; }
+
+    /// 큐가 가득 찼는지 스레드 안전하게 확인합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// if (tsQueue.isFull()) { ... }
+    /// @endcode
+    bool isFull() const { lock(); bool full = (_count == N); unlock(); return full; }
+
+    /// 현재 데이터 개수를 스레드 안전하게 조회합니다. (기록 중인 슬롯 포함)
     ///
     /// 사용 예:
     /// @code
     /// size_t s = tsQueue.size();
     /// @endcode
-    size_t size() const { lock(); size_t count = _queue.size(); unlock(); return count; }
+    size_t size() const { lock(); size_t count = _count; unlock(); return count; }
+
+    /// 운영 통계를 잠금 없이 조회합니다.
+    ///
+    /// Why: 모니터링 태스크가 조회하느라 생산자/소비자의 잠금 경합을 늘리지 않기 위함입니다.
+    /// How: 카운터는 잠금 안에서만 갱신되는 원자 변수이므로 relaxed 읽기만 수행합니다. (항목 간 시점은 조금 어긋날 수 있음)
+    ///
+    /// 사용 예:
+    /// @code
+    /// cms::QueueStats st = tsQueue.stats();
+    /// printf("hw=%u wait=%uus\n", (unsigned)st.highWater, (unsigned)st.maxLockWaitUs);
+    /// @endcode
+    QueueStats stats() const {
+        QueueStats st;
+        st.enqueued = _enqueued.load(std::memory_order_relaxed);
+        st.overwritten = _overwritten.load(std::memory_order_relaxed);
+        st.dropped = _dropped.load(std::memory_order_relaxed);
+        st.highWater = _highWater.load(std::memory_order_relaxed);
+        st.contended = _contended.load(std::memory_order_relaxed);
+        st.lockWaitUs = _lockWaitUs.load(std::memory_order_relaxed);
+        st.maxLockWaitUs = _maxLockWaitUs.load(std::memory_order_relaxed);
+        return st;
+    }
+
+    /// Block 정책에서 가득 찬 큐에 쓰려는 생산자의 최대 대기 시간을 설정합니다. (다른 정책에서는 무시)
+    ///
+    /// @param timeoutMs 최대 대기 시간 (밀리초, 0: 기다리지 않음, WAIT_FOREVER: 무제한, 기본값: DEFAULT_BLOCK_TIMEOUT_MS)
+    void setBlockTimeout(uint32_t timeoutMs) { lock(); _blockTimeoutMs = timeoutMs; unlock(); }
+
+    /// 운영 통계를 0으로 초기화합니다. (highWater는 현재 개수부터 다시 기록)
+    void resetStats() {
+        lock();
+        _enqueued.store(0, std::memory_order_relaxed);
+        _overwritten.store(0, std::memory_order_relaxed);
+        _dropped.store(0, std::memory_order_relaxed);
+        _highWater.store((uint32_t)_count, std::memory_order_relaxed);
+        _contended.store(0, std::memory_order_relaxed);
+        _lockWaitUs.store(0, std::memory_order_relaxed);
+        _maxLockWaitUs.store(0, std::memory_order_relaxed);
+        unlock();
+    }
 
 private:
+    /// 슬롯별 사용 상태.
+    enum SlotState : uint8_t {
+        Free = 0, ///< 비어 있음
+        Writing,  ///< reserve() 후 생산자가 기록 중
+        Ready,    ///< commit() 완료, 소비 가능
+        Reading   ///< peek() 후 소비자가 사용 중
+    };
+
     /// 뮤텍스를 획득하여 임계 영역에 진입합니다.
     ///
     /// 여러 태스크가 동시에 큐를 수정할 때 발생하는 데이터 오염을 방지합니다.
-    /// ARDUINO 환경에서는 FreeRTOS 세마포어를, 그 외에는 std::mutex를 사용합니다.
+    /// 경합이 없으면 tryLock 한 번으로 끝나고, 기다려야 할 때만 시계를 읽어 대기 시간을 기록합니다.
     void lock() const {
-#ifdef ARDUINO
-        if (_mutex) xSemaphoreTake(_mutex, portMAX_DELAY);
-#else
+        if (_mutex.tryLock()) return;
+        const uint32_t start = monotonicMicros();
         _mutex.lock();
-#endif
+        const uint32_t waited = monotonicMicros() - start;
+        bump(_contended);
+        _lockWaitUs.store(_lockWaitUs.load(std::memory_order_relaxed) + waited, std::memory_order_relaxed);
+        if (waited > _maxLockWaitUs.load(std::memory_order_relaxed)) _maxLockWaitUs.store(waited, std::memory_order_relaxed);
+    }
+
+    /// 잠금 안에서 통계 카운터를 증가시킵니다. (갱신은 잠금이 직렬화하므로 원자적 RMW 불필요)
+    static void bump(std::atomic<uint32_t>& counter, uint32_t by = 1) {
+        counter.store(counter.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+    }
+
+    /// 인덱스 i를 k만큼 순환 전진시킵니다. (N이 2의 거듭제곱이면 마스크 연산)
+    static constexpr size_t advance(size_t i, size_t k) { return detail::ringAdvance<N>(i, k); }
+
+    /// 다음 쓰기 슬롯을 예약합니다. (reserve()/tryReserve() 공통)
+    ///
+    /// @param makeRoom true: 가득 차면 Policy에 따라 공간 확보, false: 가득 차면 바로 nullptr (dropped 미집계)
+    Slot claimSlot(bool makeRoom) {
+        lock();
+        if (!makeRoom && _count == N) {
+            unlock();
+            return nullptr;
+        }
+        const uint32_t start = (Policy == QueueFullPolicy::Block && _count == N) ? monotonicMicros() : 0;
+        while (_count == N) {
+            if constexpr (Policy == QueueFullPolicy::OverwriteOldest) {
+                // 가장 오래된 데이터가 완성된 상태일 때만 밀어내어 공간 확보
+                if (_state[_head] == Ready) {
+                    evictHead();
+                    break;
+                }
+            } else if constexpr (Policy == QueueFullPolicy::Block) {
+                if (waitForRoom(start)) continue;
+            }
+            bump(_dropped);
+            unlock();
+            return nullptr;
+        }
+        const size_t pos = _tail;
+        _state[pos] = Writing;
+        _tail = advance(_tail, 1);
+        _count++;
+        bump(_enqueued);
+        if (_count > _highWater.load(std::memory_order_relaxed)) _highWater.store((uint32_t)_count, std::memory_order_relaxed);
+        // 깨어난 생산자가 자리를 얻은 뒤에도 공간이 남으면 다음 대기자를 이어서 깨움
+        const bool wakeProducer = (_pushWaiters > 0 && _count < N);
+        unlock();
+        if (wakeProducer) _notFull.notify();
+        return &_data[pos];
+    }
+
+    /// 완성된 가장 오래된 데이터를 밀어냅니다. (잠금 안에서 호출)
+    void evictHead() {
+        _state[_head] = Free;
+        _head = advance(_head, 1);
+        _count--;
+        bump(_overwritten);
+    }
+
+    /// Block 정책: 공간이 날 때까지 잠금을 풀고 잠듭니다. (잠금 안에서 호출하고 잠금을 잡은 채 반환)
+    ///
+    /// @param start 대기를 시작한 시각 (monotonicMicros())
+    /// @return true: 깨어남 (공간 여부는 호출자가 다시 확인), false: 제한 시간 초과
+    bool waitForRoom(uint32_t start) {
+        const uint32_t remaining = detail::waitRemaining(start, _blockTimeoutMs);
+        if (remaining == 0) return false;
+        _pushWaiters++;
+        unlock();
+        _notFull.wait(remaining);
+        lock();
+        _pushWaiters--;
+        return true;
+    }
+
+    /// 빈 공간 count칸에 items를 저장합니다. (잠금 안에서 호출, 복사하는 동안만 잠금을 풀고 잠금을 잡은 채 반환)
+    void storeRun(const T* items, size_t count) {
+        const size_t start = _tail;
+        for (size_t i = 0; i < count; ++i) _state[advance(start, i)] = Writing;
+        _tail = advance(_tail, count);
+        _count += count;
+        bump(_enqueued, (uint32_t)count);
+        if (_count > _highWater.load(std::memory_order_relaxed)) _highWater.store((uint32_t)_count, std::memory_order_relaxed);
+        unlock();
+
+        const size_t first = (count < N - start) ? count : N - start;
+        detail::copyRun(&_data[start], items, first);
+        detail::copyRun(&_data[0], items + first, count - first);
+
+        lock();
+        for (size_t i = 0; i < count; ++i) _state[advance(start, i)] = Ready;
+        if (_popWaiters > 0) _notEmpty.notify();
+    }
+
+    /// 슬롯을 비운 뒤 잠금을 풀고, 공간을 기다리는 생산자나 다음 슬롯을 기다리는 소비자를 깨웁니다.
+    void unlockAndWake() {
+        const bool wakeProducer = (_pushWaiters > 0);
+        const bool wakeConsumer = (_popWaiters > 0 && _count > 0 && _state[_head] == Ready);
+        unlock();
+        if (wakeProducer) _notFull.notify();
+        if (wakeConsumer) _notEmpty.notify();
     }
 
     /// 뮤텍스를 해제하여 임계 영역에서 나옵니다.
-    void unlock() const {
-#ifdef ARDUINO
-        if (_mutex) xSemaphoreGive(_mutex);
-#else
-        _mutex.unlock();
-#endif
+    void unlock() const { _mutex.unlock(); }
+
+    /// 인덱스와 슬롯 상태를 보호하는 플랫폼 뮤텍스.
+    mutable Mutex _mutex;
+
+    /// 데이터를 저장하는 고정 크기 정적 배열.
+    T _data[N];
+    /// 각 슬롯의 사용 상태 (SlotState).
+    uint8_t _state[N] = {};
+    /// 가장 오래된 데이터의 인덱스.
+    size_t _head = 0;
+    /// 다음 데이터의 저장 위치 인덱스.
+    size_t _tail = 0;
+    /// 예약된 슬롯을 포함한 현재 데이터 개수 (0 ~ N).
+    size_t _count = 0;
+
+    /// 데이터를 기다리는 소비자에게 보내는 신호 (commit 시 대기자가 있을 때만 울림).
+    Signal _notEmpty;
+    /// 공간을 기다리는 생산자에게 보내는 신호 (Block 정책이 아니면 RTOS 객체를 만들지 않는 빈 타입).
+    typename std::conditional<Policy == QueueFullPolicy::Block, Signal, detail::NullSignal>::type _notFull;
+    /// peekWait()에서 잠든 소비자 수 (잠금 안에서만 접근).
+    uint16_t _popWaiters = 0;
+    /// Block 정책으로 잠든 생산자 수 (잠금 안에서만 접근).
+    uint16_t _pushWaiters = 0;
+    /// Block 정책의 최대 대기 시간 (밀리초).
+    uint32_t _blockTimeoutMs = DEFAULT_BLOCK_TIMEOUT_MS;
+
+    // 운영 통계 (잠금 안에서 갱신, stats()가 잠금 없이 읽음)
+    mutable std::atomic<uint32_t> _enqueued{0};
+    mutable std::atomic<uint32_t> _overwritten{0};
+    mutable std::atomic<uint32_t> _dropped{0};
+    mutable std::atomic<uint32_t> _highWater{0};
+    mutable std::atomic<uint32_t> _contended{0};
+    mutable std::atomic<uint32_t> _lockWaitUs{0};
+    mutable std::atomic<uint32_t> _maxLockWaitUs{0};
+};
+
+/// [BlockingQueue] 가득 차면 생산자가 기다리는 ThreadSafeQueue 별칭
+///
+/// AsyncLogger처럼 `template <typename, size_t> class` 큐 정책 인자에 Block 정책을 넘길 때 사용합니다.
+///
+/// 사용 예:
+/// @code
+/// cms::AsyncLogger<256, 16, cms::BlockingQueue> logger; // 로그를 잃지 않고 생산자를 늦춤
+/// @endcode
+template <typename T, size_t N>
+using BlockingQueue = ThreadSafeQueue<T, N, QueueFullPolicy::Block>;
+
+// ==================================================================================================
+// [SpscQueue] 개요
+// - 왜 존재하는가: 생산자 1개, 소비자 1개인 환경에서 뮤텍스 없이 태스크 간 데이터를 교환하여 우선순위 역전과 지터를 제거합니다.
+// - 어떻게 동작하는가: 생산자만 tail을, 소비자만 head를 갱신하며 std::atomic의 acquire/release 순서로 데이터 가시성을 보장합니다.
+// ==================================================================================================
+
+/// 단일 생산자/단일 소비자(SPSC) 전용 대기 없는(Wait-Free) 원형 큐 클래스 템플릿입니다.
+///
+/// Why: 로그 생산 태스크와 출력 태스크가 각각 하나일 때 ThreadSafeQueue의 뮤텍스 비용과 블로킹을 없애기 위함입니다.
+/// How: 계속 증가하는 head/tail 인덱스를 2의 거듭제곱 마스크로 물리 위치에 매핑하여 나눗셈 없이 순환합니다.
+///
+/// @note 생산자는 head를 수정할 수 없으므로 가득 찬 경우 가장 오래된 데이터를 덮어쓰지 않고 새 데이터를 버립니다.
+/// @note enqueue()/reserve()/commit()은 한 태스크에서만, pop()/peek()/release()/getAt()은 다른 한 태스크에서만 호출해야 합니다.
+///
+/// @tparam T 저장할 데이터 타입
+/// @tparam N 큐의 최대 용량 (2의 거듭제곱이어야 함)
+template <typename T, size_t N>
+class SpscQueue {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "cms::SpscQueue size N must be a power of two (>= 2).");
+
+public:
+    /// 큐의 상태를 초기화합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// cms::SpscQueue<int, 16> q;
+    /// @endcode
+    SpscQueue() : _head(0), _tail(0) {}
+
+    /// 예약/조회된 슬롯을 가리키는 핸들 타입 (큐 내부 데이터에 대한 포인터)
+    using Slot = T*;
+
+    /// 데이터를 큐에 추가합니다. (생산자 전용)
+    ///
+    /// 큐가 가득 찬 경우 블로킹하거나 덮어쓰지 않고 즉시 false를 반환합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// if (!q.enqueue(100)) { /* 가득 참: 데이터 버림 */ }
+    /// @endcode
+    ///
+    /// @param item 추가할 데이터 참조
+    ///
+    /// @return true: 성공, false: 큐가 가득 차 데이터를 버림
+    bool enqueue(const T& item) {
+        Slot slot = reserve();
+        if (!slot) return false;
+        *slot = item;
+        commit(slot);
+        return true;
     }
 
-#ifdef ARDUINO
-    /// FreeRTOS 환경에서 사용하는 뮤텍스 제어 핸들.
-    mutable SemaphoreHandle_t _mutex = nullptr;
-#else
-    /// 표준 C++ 환경에서 사용하는 뮤텍스 객체.
-    mutable std::mutex _mutex;
+    /// 큐에서 가장 오래된 데이터를 꺼내옵니다. (소비자 전용)
+    ///
+    /// 사용 예:
+    /// @code
+    /// int data;
+    /// if (q.pop(data)) { ... }
+    /// @endcode
+    ///
+    /// @param outItem [OUT] 꺼낸 데이터를 저장할 참조 변수
+    ///
+    /// @return true: 성공, false: 큐가 비어있음
+    bool pop(T& outItem) {
+        Slot slot = peek();
+        if (!slot) return false;
+        outItem = *slot;
+        release(slot);
+        return true;
+    }
+
+    /// 다음 쓰기 슬롯을 예약합니다. (생산자 전용)
+    ///
+    /// 예약이 열려 있는 동안 같은 생산자가 다시 reserve()/enqueue()를 호출할 수 있으며,
+    /// 이렇게 중첩된 슬롯들은 가장 바깥 commit() 시점에 한꺼번에 공개됩니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// if (cms::SpscQueue<Packet, 8>::Slot slot = q.reserve()) {
+    ///     fill(*slot);
+    ///     q.commit(slot);
+    /// }
+    /// @endcode
+    ///
+    /// @return 기록할 슬롯 핸들, 가득 찼으면 nullptr
+    Slot reserve() {
+        // 소비자가 갱신한 head를 acquire로 읽어 해당 슬롯의 읽기가 끝났음을 보장
+        if (_reserveTail - _head.load(std::memory_order_acquire) >= N) return nullptr;
+        _openReservations++;
+        return &_data[_reserveTail++ & MASK];
+    }
+
+    /// reserve()로 예약한 슬롯의 기록 완료를 알립니다. (생산자 전용)
+    ///
+    /// @param slot reserve()가 반환한 슬롯 핸들
+    void commit(Slot slot) {
+        (void)slot;
+        // release 저장으로 데이터 기록이 소비자에게 먼저 보이도록 순서 보장
+        if (--_openReservations == 0) _tail.store(_reserveTail, std::memory_order_release);
+    }
+
+    /// reserve()와 같습니다. (SpscQueue는 가득 차도 덮어쓰지 않으므로 공통 큐 인터페이스용)
+    Slot tryReserve() { return reserve(); }
+
+    /// reserve()로 예약한 슬롯을 commit하지 않고 반환합니다. (생산자 전용)
+    ///
+    /// 가장 최근에 예약한 슬롯이면 예약 위치를 되돌립니다. 그 뒤에 중첩된 예약이 있으면 false를 반환하며,
+    /// 이때 슬롯은 예약된 상태 그대로이므로 호출자가 빈 데이터로 표시하여 commit해야 합니다.
+    ///
+    /// @param slot reserve()가 반환한 슬롯 핸들
+    ///
+    /// @return true: 예약 반환, false: 뒤에 다른 예약이 있어 반환하지 못함 (commit 필요)
+    bool cancel(Slot slot) {
+        if (slot != &_data[(_reserveTail - 1) & MASK]) return false;
+        _reserveTail--;
+        if (--_openReservations == 0) _tail.store(_reserveTail, std::memory_order_release);
+        return true;
+    }
+
+    /// 가장 오래된 데이터를 복사하지 않고 제자리에서 조회합니다. (소비자 전용)
+    ///
+    /// @return 가장 오래된 슬롯 핸들, 비어있으면 nullptr
+    Slot peek() {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        if (_tail.load(std::memory_order_acquire) == head) return nullptr;
+        return &_data[head & MASK];
+    }
+
+    /// peek()으로 조회한 슬롯의 사용을 마치고 큐에서 제거합니다. (소비자 전용)
+    ///
+    /// @param slot peek()이 반환한 슬롯 핸들
+    void release(Slot slot) {
+        (void)slot;
+        // 슬롯 사용이 끝난 뒤에 head를 공개하여 생산자가 덮어쓰지 않도록 보장
+        _head.store(_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /// 가장 오래된 슬롯부터 최대 maxCount개를 한 번에 조회합니다. (소비자 전용)
+    ///
+    /// @param outSlots [OUT] 조회된 슬롯 핸들을 저장할 배열 (최소 maxCount개)
+    /// @param maxCount 조회할 최대 개수
+    ///
+    /// @return 실제 조회된 슬롯 개수
+    size_t peekBatch(Slot* outSlots, size_t maxCount) {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        const size_t avail = _tail.load(std::memory_order_acquire) - head;
+        const size_t n = (maxCount < avail) ? maxCount : avail;
+        for (size_t i = 0; i < n; ++i) outSlots[i] = &_data[(head + i) & MASK];
+        return n;
+    }
+
+    /// peekBatch()로 조회한 슬롯들을 한 번의 head 갱신으로 큐에서 제거합니다. (소비자 전용)
+    ///
+    /// @param slots peekBatch()가 채운 슬롯 핸들 배열
+    /// @param count 제거할 개수 (peekBatch()의 반환값 이하)
+    void releaseBatch(const Slot* slots, size_t count) {
+        (void)slots;
+        _head.store(_head.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    /// 특정 인덱스(상대적 위치)의 데이터를 조회합니다. (소비자 전용)
+    ///
+    /// @param index 조회할 상대적 인덱스 (0: 가장 오래된 데이터)
+    /// @param outItem [OUT] 조회된 데이터를 저장할 참조 변수
+    ///
+    /// @return true: 조회 성공, false: 인덱스 범위 초과
+    bool getAt(size_t index, T& outItem) const {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        if (index >= _tail.load(std::memory_order_acquire) - head) return false;
+        outItem = _data[(head + index) & MASK];
+        return true;
+    }
+
+    /// 큐가 비어있는지 확인합니다. (다른 태스크가 동작 중이면 근사값)
+    bool isEmpty() const { return size() == 0; }
+
+    /// 큐가 가득 찼는지 확인합니다. (다른 태스크가 동작 중이면 근사값)
+    bool isFull() const { return size() >= N; }
+
+    /// 현재 저장된 데이터 개수를 반환합니다. (다른 태스크가 동작 중이면 근사값)
+    ///
+    /// @return 현재 데이터 개수 (0 ~ N)
+    size_t size() const {
+        // head를 먼저 읽어야 tail이 더 오래된 값일 수 없음 (반대 순서면 제3의 태스크가 음수 차이의 순환값을 볼 수 있음)
+        const size_t head = _head.load(std::memory_order_acquire);
+        const size_t n = _tail.load(std::memory_order_acquire) - head;
+        return (n > N) ? N : n; // 두 값을 읽는 사이 양쪽이 모두 전진한 경우를 N 이하로 보정
+    }
+
+private:
+    /// 물리적 인덱스 계산용 마스크 (N - 1).
+    static constexpr size_t MASK = N - 1;
+
+    /// 소비자가 다음에 읽을 위치 (계속 증가하며 MASK로 순환).
+    alignas(CMS_CACHE_LINE_SIZE) std::atomic<size_t> _head;
+    /// 소비자에게 공개된 쓰기 완료 위치 (계속 증가하며 MASK로 순환).
+    alignas(CMS_CACHE_LINE_SIZE) std::atomic<size_t> _tail;
+    /// 생산자가 다음에 예약할 위치 (생산자 전용, commit 전까지 _tail보다 앞설 수 있음).
+    size_t _reserveTail = 0;
+    /// 아직 commit되지 않은 예약 개수 (생산자 전용).
+    size_t _openReservations = 0;
+    /// 데이터를 저장하는 고정 크기 정적 배열.
+    alignas(CMS_CACHE_LINE_SIZE) T _data[N];
+};
+
+// ==================================================================================================
+// [MpmcQueue] 개요
+// - 왜 존재하는가: 두 코어와 ISR 지연 콜백 등 여러 생산자/소비자가 하나의 큐를 블로킹 없이 공유하기 위해 존재합니다.
+// - 어떻게 동작하는가: 슬롯마다 시퀀스 번호를 두는 Vyukov 방식으로, CAS로 위치를 선점한 뒤 시퀀스 갱신으로 데이터를 공개합니다.
+// ==================================================================================================
+
+/// 다중 생산자/다중 소비자(MPMC) 락프리 유한 큐 클래스 템플릿입니다.
+///
+/// Why: ThreadSafeQueue의 xSemaphoreTake는 ISR에서 호출할 수 없고, 두 코어를 하나의 뮤텍스로 직렬화하기 때문입니다.
+/// How: 각 슬롯의 시퀀스 값으로 "쓰기 가능/읽기 가능" 상태를 판별하며, 어떤 경로에서도 대기(Spin)하지 않고 즉시 결과를 반환합니다.
+///
+/// @note 다른 생산자가 슬롯을 선점만 하고 아직 기록을 끝내지 않았다면 소비자는 해당 슬롯을 "비어 있음"으로 봅니다.
+///
+/// @tparam T 저장할 데이터 타입
+/// @tparam N 큐의 최대 용량 (2의 거듭제곱이어야 함)
+/// @tparam Policy 가득 찼을 때의 동작 (기본값: DropNewest)
+template <typename T, size_t N, QueueFullPolicy Policy = QueueFullPolicy::DropNewest>
+class MpmcQueue {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "cms::MpmcQueue size N must be a power of two (>= 2).");
+    static_assert(Policy != QueueFullPolicy::Block, "cms::MpmcQueue is lock-free and cannot block; use ThreadSafeQueue.");
+
+public:
+    /// 슬롯별 시퀀스 번호를 초기화합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// cms::MpmcQueue<int, 16> q;
+    /// cms::MpmcQueue<int, 16, cms::QueueFullPolicy::OverwriteOldest> ring;
+    /// @endcode
+    MpmcQueue() : _enqueuePos(0), _dequeuePos(0) {
+        for (size_t i = 0; i < N; ++i) {
+            _seq[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /// 예약/조회된 슬롯을 가리키는 핸들 타입 (큐 내부 데이터에 대한 포인터)
+    using Slot = T*;
+
+    /// 데이터를 블로킹 없이 추가합니다.
+    ///
+    /// 가득 찬 경우 Policy가 OverwriteOldest이면 가장 오래된 데이터를 하나 버리고 재시도하며,
+    /// 그래도 공간을 얻지 못하면 새 데이터를 버립니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// if (!q.tryEnqueue(42)) { /* 데이터 버림 */ }
+    /// @endcode
+    ///
+    /// @param item 추가할 데이터 참조
+    ///
+    /// @return true: 성공, false: 공간이 없어 데이터를 버림
+    bool tryEnqueue(const T& item) {
+        Slot slot = reserve();
+        if (!slot) return false;
+        *slot = item;
+        commit(slot);
+        return true;
+    }
+
+    /// ISR 컨텍스트에서 데이터를 추가합니다.
+    ///
+    /// 내부적으로 tryEnqueue와 동일하며, 뮤텍스나 대기 루프가 없으므로 인터럽트 핸들러에서도 안전합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// void IRAM_ATTR onTimer() { q.enqueueFromISR(sample); }
+    /// @endcode
+    ///
+    /// @param item 추가할 데이터 참조
+    ///
+    /// @return true: 성공, false: 공간이 없어 데이터를 버림
+    bool enqueueFromISR(const T& item) { return tryEnqueue(item); }
+
+    /// 공통 큐 인터페이스용 enqueue (tryEnqueue와 동일)
+    bool enqueue(const T& item) { return tryEnqueue(item); }
+
+    /// 가장 오래된 데이터를 블로킹 없이 꺼내옵니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// int data;
+    /// if (q.tryPop(data)) { ... }
+    /// @endcode
+    ///
+    /// @param outItem [OUT] 꺼낸 데이터를 저장할 참조 변수
+    ///
+    /// @return true: 성공, false: 큐가 비어있음 (또는 가장 오래된 슬롯이 아직 기록 중)
+    bool tryPop(T& outItem) {
+        Slot slot = peek();
+        if (!slot) return false;
+        outItem = *slot;
+        release(slot);
+        return true;
+    }
+
+    /// 공통 큐 인터페이스용 pop (tryPop과 동일)
+    bool pop(T& outItem) { return tryPop(outItem); }
+
+    /// 다음 쓰기 슬롯을 선점합니다. 선점한 슬롯은 commit() 전까지 소비자에게 보이지 않습니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// if (cms::MpmcQueue<Packet, 8>::Slot slot = q.reserve()) {
+    ///     fill(*slot);
+    ///     q.commit(slot);
+    /// }
+    /// @endcode
+    ///
+    /// @return 기록할 슬롯 핸들, 공간이 없으면 nullptr
+    Slot reserve() {
+        size_t pos;
+        if (claim(_enqueuePos, 0, pos)) return &_data[pos & MASK];
+        if (Policy == QueueFullPolicy::OverwriteOldest) {
+            // 가장 오래된 데이터를 복사 없이 폐기하여 공간을 만든 뒤 한 번 더 시도 (다른 생산자와 경쟁 시 실패할 수 있음)
+            size_t oldest;
+            if (claim(_dequeuePos, 1, oldest)) {
+                _seq[oldest & MASK].store(oldest + N, std::memory_order_release);
+                if (claim(_enqueuePos, 0, pos)) return &_data[pos & MASK];
+            }
+        }
+        return nullptr;
+    }
+
+    /// reserve()로 선점한 슬롯의 기록 완료를 알리고 소비자에게 공개합니다.
+    ///
+    /// @param slot reserve()가 반환한 슬롯 핸들
+    void commit(Slot slot) {
+        std::atomic<size_t>& seq = _seq[slot - _data];
+        // seq == pos 상태에서 pos + 1(읽기 가능)로 전환
+        seq.store(seq.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /// 빈 자리가 있을 때만 다음 쓰기 슬롯을 선점합니다. (Policy와 무관하게 가장 오래된 데이터를 폐기하지 않음)
+    ///
+    /// @return 기록할 슬롯 핸들, 공간이 없으면 nullptr
+    Slot tryReserve() {
+        size_t pos;
+        return claim(_enqueuePos, 0, pos) ? &_data[pos & MASK] : nullptr;
+    }
+
+    /// reserve()로 선점한 슬롯을 commit하지 않고 반환합니다.
+    ///
+    /// 이 슬롯 뒤로 아무도 선점하지 않았다면 CAS로 생산 위치를 되돌립니다. (슬롯 시퀀스는 pos 그대로이므로 다시 쓰기 가능)
+    /// 다른 생산자가 이미 다음 슬롯을 선점했다면 false를 반환하며, 이때 슬롯은 선점된 상태 그대로이므로
+    /// 호출자가 빈 데이터로 표시하여 commit해야 합니다.
+    ///
+    /// @param slot reserve()가 반환한 슬롯 핸들
+    ///
+    /// @return true: 선점 반환, false: 뒤에 다른 선점이 있어 반환하지 못함 (commit 필요)
+    bool cancel(Slot slot) {
+        // 선점 중인 슬롯의 시퀀스는 commit 전까지 자신의 위치(pos)와 같음
+        const size_t pos = _seq[slot - _data].load(std::memory_order_relaxed);
+        size_t expected = pos + 1;
+        return _enqueuePos.compare_exchange_strong(expected, pos, std::memory_order_relaxed);
+    }
+
+    /// 가장 오래된 데이터를 선점하여 복사 없이 제자리에서 조회합니다.
+    ///
+    /// @return 가장 오래된 슬롯 핸들, 비어있거나 가장 오래된 슬롯이 아직 기록 중이면 nullptr
+    Slot peek() {
+        size_t pos;
+        if (!claim(_dequeuePos, 1, pos)) return nullptr;
+        return &_data[pos & MASK];
+    }
+
+    /// peek()으로 선점한 슬롯의 사용을 마치고 다음 바퀴의 생산자에게 반환합니다.
+    ///
+    /// @param slot peek()이 반환한 슬롯 핸들
+    void release(Slot slot) {
+        std::atomic<size_t>& seq = _seq[slot - _data];
+        // seq == pos + 1 상태에서 pos + N(다음 바퀴 쓰기 가능)으로 전환
+        seq.store(seq.load(std::memory_order_relaxed) + N - 1, std::memory_order_release);
+    }
+
+    /// 한 번의 CAS로 가장 오래된 슬롯부터 최대 maxCount개를 선점하여 조회합니다.
+    ///
+    /// 기록이 끝난 슬롯이 연속된 구간까지만 선점하며, 다른 소비자와 경쟁하면 구간을 다시 계산합니다.
+    ///
+    /// @param outSlots [OUT] 조회된 슬롯 핸들을 저장할 배열 (최소 maxCount개)
+    /// @param maxCount 조회할 최대 개수
+    ///
+    /// @return 실제 조회된 슬롯 개수
+    size_t peekBatch(Slot* outSlots, size_t maxCount) {
+        if (maxCount > N) maxCount = N;
+        size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            size_t n = 0;
+            while (n < maxCount && _seq[(pos + n) & MASK].load(std::memory_order_acquire) == pos + n + 1) n++;
+            if (n == 0) {
+                const size_t seq = _seq[pos & MASK].load(std::memory_order_acquire);
+                if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1) < 0) return 0; // 비어 있음
+                pos = _dequeuePos.load(std::memory_order_relaxed); // 다른 소비자가 앞서감
+                continue;
+            }
+            if (_dequeuePos.compare_exchange_weak(pos, pos + n, std::memory_order_relaxed)) {
+                for (size_t i = 0; i < n; ++i) outSlots[i] = &_data[(pos + i) & MASK];
+                return n;
+            }
+        }
+    }
+
+    /// peekBatch()로 선점한 슬롯들을 다음 바퀴의 생산자에게 반환합니다.
+    ///
+    /// @param slots peekBatch()가 채운 슬롯 핸들 배열
+    /// @param count 반환할 개수 (peekBatch()의 반환값과 같아야 함)
+    void releaseBatch(const Slot* slots, size_t count) {
+        for (size_t i = 0; i < count; ++i) release(slots[i]);
+    }
+
+    /// 큐가 비어있는지 확인합니다. (동시 접근 중에는 근사값)
+    bool isEmpty() const { return size() == 0; }
+
+    /// 큐가 가득 찼는지 확인합니다. (동시 접근 중에는 근사값)
+    bool isFull() const { return size() >= N; }
+
+    /// 현재 저장된 데이터 개수를 반환합니다. (동시 접근 중에는 근사값)
+    size_t size() const {
+        const size_t deq = _dequeuePos.load(std::memory_order_acquire);
+        const size_t enq = _enqueuePos.load(std::memory_order_acquire);
+        const size_t n = enq - deq;
+        return (n > N) ? N : n; // 읽는 사이의 역전을 N 이하로 보정
+    }
+
+private:
+    /// 물리적 인덱스 계산용 마스크 (N - 1).
+    static constexpr size_t MASK = N - 1;
+
+    /// 커서(생산/소비 위치)가 가리키는 슬롯을 CAS로 선점합니다.
+    ///
+    /// 슬롯의 시퀀스가 pos + readyOffset이면 선점 가능한 상태입니다. (생산자: 0, 소비자: 1)
+    /// 시퀀스가 더 작으면 가득 참/비어 있음으로 판단하여 대기하지 않고 즉시 false를 반환합니다.
+    bool claim(std::atomic<size_t>& cursor, size_t readyOffset, size_t& outPos) {
+        size_t pos = cursor.load(std::memory_order_relaxed);
+        for (;;) {
+            const size_t seq = _seq[pos & MASK].load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + readyOffset);
+            if (diff == 0) {
+                // CAS 실패 시 pos가 최신 값으로 갱신되어 재시도
+                if (cursor.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    outPos = pos;
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // 생산자: 이전 바퀴 데이터가 미소비 / 소비자: 아직 기록되지 않음
+            } else {
+                pos = cursor.load(std::memory_order_relaxed); // 다른 태스크가 앞서감
+            }
+        }
+    }
+
+    /// 생산자들이 다음에 선점할 위치.
+    alignas(CMS_CACHE_LINE_SIZE) std::atomic<size_t> _enqueuePos;
+    /// 소비자들이 다음에 선점할 위치.
+    alignas(CMS_CACHE_LINE_SIZE) std::atomic<size_t> _dequeuePos;
+    /// 슬롯별 시퀀스 번호 (seq == pos: 쓰기 가능, seq == pos + 1: 읽기 가능).
+    alignas(CMS_CACHE_LINE_SIZE) std::atomic<size_t> _seq[N];
+    /// 데이터를 저장하는 고정 크기 정적 배열.
+    T _data[N];
+};
+
+// ==================================================================================================
+// [ByteRing] 개요
+// - 왜 존재하는가: 길이가 제각각인 데이터(로그 줄 등)를 최대 크기 슬롯에 담으면 대부분의 RAM이 낭비되므로,
+//   같은 메모리에 훨씬 많은 레코드를 보관하기 위해 존재합니다.
+// - 어떻게 동작하는가: [헤더(스팬/길이) + 페이로드]로 이루어진 가변 길이 레코드를 바이트 버퍼에 연속으로 채우며,
+//   버퍼 끝에 레코드가 들어가지 않으면 래핑 마커를 남기고 앞부분으로 돌아갑니다.
+// ==================================================================================================
+
+/// 가변 길이 레코드 링 버퍼의 공통 로직을 담당하는 베이스 클래스입니다.
+///
+/// Why: 버퍼 크기(BYTES)별로 링 관리 코드가 중복 생성되지 않도록 비-템플릿으로 분리하기 위함입니다. (Thin Template)
+/// How: 외부에서 주입된 바이트 버퍼를 관리하며, ThreadSafeQueue와 같이 인덱스 조작 구간에서만 뮤텍스를 잡습니다.
+///      기록 중인 레코드와 조회 중인 레코드는 덮어쓰지 않습니다.
+///
+/// @note 레코드는 RECORD_ALIGN(ESP32: 4바이트, 64비트 PC: 8바이트) 경계로 정렬되며, 레코드당 RECORD_ALIGN 크기의 헤더가 추가됩니다.
+class ByteRingBase {
+public:
+    /// 레코드 하나의 최대 페이로드 크기 (바이트)
+    static constexpr size_t MAX_RECORD_SIZE = 0xFFF0;
+    /// 레코드 정렬 단위이자 헤더 크기 (페이로드에 포인터를 포함한 구조체를 직접 둘 수 있도록 포인터 정렬 이상)
+    static constexpr size_t RECORD_ALIGN = (alignof(void*) > 4) ? alignof(void*) : 4;
+
+    /// 최대 maxLen 바이트를 기록할 수 있는 연속 공간을 예약합니다.
+    ///
+    /// 실제 사용한 크기는 commit()에서 전달하며, 예약한 레코드가 마지막 레코드라면 남는 공간은 즉시 반환됩니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// if (uint8_t* p = ring.reserve(64)) {
+    ///     size_t n = encode(p, 64);
+    ///     ring.commit(p, n);
+    /// }
+    /// @endcode
+    ///
+    /// @param maxLen 예약할 최대 페이로드 크기
+    ///
+    /// @return 페이로드 기록 위치, 공간이 없으면 nullptr
+    uint8_t* reserve(size_t maxLen) { return reserveRecord(maxLen, true); }
+
+    /// 빈 공간이 있을 때만 레코드를 예약합니다. (정책과 무관하게 오래된 레코드를 버리지 않음)
+    ///
+    /// @param maxLen 예약할 최대 페이로드 크기
+    ///
+    /// @return 페이로드 기록 위치, 공간이 없으면 nullptr
+    uint8_t* tryReserve(size_t maxLen) { return reserveRecord(maxLen, false); }
+
+    /// reserve()로 예약한 레코드의 기록 완료를 알리고 소비자에게 공개합니다.
+    ///
+    /// @param payload reserve()가 반환한 페이로드 위치
+    /// @param len 실제 기록한 바이트 수 (예약 크기 이하)
+    void commit(uint8_t* payload, size_t len);
+
+    /// reserve()로 예약한 레코드를 공개하지 않고 반환합니다.
+    ///
+    /// 마지막으로 예약된 레코드면 공간을 즉시 되돌립니다. 뒤에 다른 예약이 있으면 false를 반환하며,
+    /// 이때 레코드는 예약된 상태 그대로이므로 호출자가 빈 데이터로 표시하여 commit해야 합니다.
+    ///
+    /// @param payload reserve()가 반환한 페이로드 위치
+    ///
+    /// @return true: 예약 반환, false: 뒤에 다른 예약이 있어 반환하지 못함 (commit 필요)
+    bool cancel(uint8_t* payload);
+
+    /// 가장 오래된 레코드부터 최대 maxCount개를 복사 없이 조회합니다.
+    ///
+    /// @param outPayloads [OUT] 레코드 페이로드 위치를 저장할 배열
+    /// @param outLens [OUT] 레코드 길이를 저장할 배열
+    /// @param maxCount 조회할 최대 개수
+    ///
+    /// @return 실제 조회된 레코드 개수 (다른 태스크가 조회 중이면 0)
+    size_t peekBatch(uint8_t** outPayloads, size_t* outLens, size_t maxCount);
+
+    /// peekBatch()로 조회한 레코드 중 앞에서부터 count개를 제거합니다. 나머지는 다시 조회 가능한 상태가 됩니다.
+    ///
+    /// @param count 제거할 개수
+    void releaseBatch(size_t count);
+
+    /// 데이터를 복사하여 레코드 하나로 추가합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// ring.enqueue("hello", 5);
+    /// @endcode
+    ///
+    /// @return true: 성공, false: 공간이 없어 데이터를 버림
+    bool enqueue(const void* data, size_t len);
+
+    /// 가장 오래된 레코드를 꺼내 복사합니다. (outCapacity보다 긴 레코드는 잘림)
+    ///
+    /// @param out [OUT] 데이터를 복사할 버퍼
+    /// @param outCapacity out 버퍼 크기
+    /// @param outLen [OUT] 복사된 바이트 수
+    ///
+    /// @return true: 성공, false: 비어있음
+    bool pop(void* out, size_t outCapacity, size_t& outLen);
+
+    /// 레코드가 없는지 확인합니다.
+    bool isEmpty() const { return size() == 0; }
+
+    /// 기록 중인 레코드를 포함한 레코드 개수를 반환합니다.
+    size_t size() const;
+
+    /// 헤더와 래핑 마커를 포함하여 사용 중인 바이트 수를 반환합니다.
+    size_t bytesUsed() const;
+
+    /// 링 버퍼의 전체 바이트 용량을 반환합니다.
+    size_t capacity() const { return _capacity; }
+
+    /// 현재 버퍼 사용량을 퍼센트(%) 단위로 계산합니다.
+    ///
+    /// 사용 예:
+    /// @code
+    /// float usage = ring.utilization();
+    /// @endcode
+    ///
+    /// @return 0.0 ~ 100.0 사이의 현재 사용률
+    float utilization() const;
+
+#ifdef CMS_ENABLE_PROFILING
+    /// 생성 이후 도달했던 최대 버퍼 사용량을 퍼센트(%) 단위로 반환합니다.
+    ///
+    /// @return 0.0 ~ 100.0 사이의 최대 사용률 (High Water Mark)
+    float peakUtilization() const;
 #endif
 
-    /// 실제 데이터 저장 및 인덱스 관리를 담당하는 내부 큐 객체.
-    Queue<T, N> _queue;
+protected:
+    /// 내부 생성자입니다. 자식 클래스에서 버퍼 정보를 주입받습니다. (용량은 RECORD_ALIGN 단위로 내림)
+    ByteRingBase(uint8_t* buf, size_t capacity, QueueFullPolicy policy);
+
+private:
+    /// 레코드 헤더 (RECORD_ALIGN 정렬 위치에만 존재).
+    struct RecordHeader {
+        uint16_t span; ///< 헤더와 패딩을 포함한 레코드 전체 크기
+        uint16_t len;  ///< 페이로드 길이 또는 상태 값 (WRITING/WRAP)
+    };
+
+    /// 헤더 len 값: reserve() 후 기록 중
+    static constexpr uint16_t LEN_WRITING = 0xFFFF;
+    /// 헤더 len 값: 버퍼 끝의 남는 공간을 건너뛰는 래핑 마커
+    static constexpr uint16_t LEN_WRAP = 0xFFFE;
+
+    /// 지정 위치의 레코드 헤더를 반환합니다.
+    RecordHeader* headerAt(size_t offset) const { return reinterpret_cast<RecordHeader*>(_buf + offset); }
+    /// 레코드 예약 공통 구현 (makeRoom: 공간이 부족할 때 정책에 따라 오래된 레코드를 버릴지 여부)
+    uint8_t* reserveRecord(size_t maxLen, bool makeRoom);
+    /// head 위치의 래핑 마커를 제거합니다. (잠금 상태에서 호출)
+    void skipWrapMarker();
+    /// 가장 오래된 완성 레코드를 하나 버립니다. (잠금 상태에서 호출)
+    bool evictOldest();
+
+    /// 레코드를 저장하는 외부 주입 바이트 버퍼.
+    uint8_t* const _buf;
+    /// 버퍼의 사용 가능 용량 (RECORD_ALIGN의 배수).
+    const size_t _capacity;
+    /// 가득 찼을 때의 동작 정책.
+    const QueueFullPolicy _policy;
+    /// 가장 오래된 레코드의 위치.
+    size_t _head = 0;
+    /// 다음 레코드를 예약할 위치.
+    size_t _tail = 0;
+    /// 헤더와 래핑 마커를 포함한 사용 바이트 수.
+    size_t _used = 0;
+    /// 기록 중인 것을 포함한 레코드 개수.
+    size_t _count = 0;
+    /// peekBatch()로 조회 중인 레코드 개수.
+    size_t _readCount = 0;
+#ifdef CMS_ENABLE_PROFILING
+    /// 생성 이후 도달했던 최대 사용 바이트 수 (프로파일링용).
+    size_t _peakUsed = 0;
+#endif
+    /// 인덱스와 헤더 상태를 보호하는 플랫폼 뮤텍스.
+    mutable Mutex _mutex;
+};
+
+/// 고정 크기 바이트 버퍼를 소유하는 가변 길이 레코드 링 버퍼입니다.
+///
+/// 사용 예:
+/// @code
+/// cms::ByteRing<1024> ring;                                        // 가득 차면 새 레코드 버림
+/// cms::ByteRing<1024, cms::QueueFullPolicy::OverwriteOldest> log; // 가득 차면 오래된 레코드부터 버림
+/// @endcode
+///
+/// @tparam BYTES 링 버퍼의 바이트 크기 (RECORD_ALIGN의 배수 권장)
+/// @tparam Policy 가득 찼을 때의 동작 (기본값: DropNewest)
+template <size_t BYTES, QueueFullPolicy Policy = QueueFullPolicy::DropNewest>
+class ByteRing : public ByteRingBase {
+    static_assert(BYTES >= 8, "cms::ByteRing size BYTES must be at least 8.");
+    static_assert(Policy != QueueFullPolicy::Block, "cms::ByteRing cannot block; use DropNewest or OverwriteOldest.");
+
+public:
+    ByteRing() : ByteRingBase(_storage, BYTES, Policy) {}
+
+private:
+    /// 레코드 헤더 정렬을 보장하는 정적 버퍼.
+    alignas(RECORD_ALIGN) uint8_t _storage[BYTES];
 };
 
 } // namespace cms
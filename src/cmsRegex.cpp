@@ -0,0 +1,536 @@
+/// @author comser.dev
+/// @brief RegexBase 비-템플릿 클래스의 구현부입니다. (패턴 컴파일러와 Thompson NFA 실행기)
+/// 이 파일은 독립적으로 컴파일되어 프로그램 크기별 코드 비대화를 방지합니다.
+
+#include <cstring>
+#include "cmsRegex.h"
+
+namespace {
+    /// NFA 명령 종류
+    enum Op : uint8_t {
+        OP_CHAR,      // arg와 같은 바이트 하나 소비
+        OP_CHAR_FOLD, // 소문자로 접은 값이 arg와 같은 바이트 하나 소비 (ignoreCase 영문자)
+        OP_ANY,       // 임의의 바이트 하나 소비
+        OP_CLASS,     // arg번 문자 클래스에 속한 바이트 하나 소비
+        OP_SPLIT,     // x와 y로 동시에 분기
+        OP_JMP,       // x로 이동
+        OP_BOL,       // 텍스트 시작 위치에서만 통과
+        OP_EOL,       // 텍스트 끝 위치에서만 통과
+        OP_MATCH      // 일치 성공
+    };
+
+    inline unsigned char foldAscii(unsigned char c) {
+        return (c >= 'A' && c <= 'Z') ? static_cast<unsigned char>(c + ('a' - 'A')) : c;
+    }
+
+    inline bool isAsciiAlpha(unsigned char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+    }
+
+    inline void setBit(uint8_t* bits, unsigned c) { bits[c >> 3] |= static_cast<uint8_t>(1u << (c & 7)); }
+    inline bool testBit(const uint8_t* bits, unsigned c) { return (bits[c >> 3] >> (c & 7)) & 1u; }
+
+    inline void setRange(uint8_t* bits, unsigned lo, unsigned hi) {
+        for (unsigned c = lo; c <= hi; ++c) setBit(bits, c);
+    }
+
+    /// POSIX 이름 클래스([:digit:] 등)와 \d \w \s 단축 클래스의 비트 채우기
+    bool fillNamedClass(uint8_t* bits, const char* name, size_t len) {
+        auto is = [name, len](const char* s) { return strlen(s) == len && memcmp(name, s, len) == 0; };
+        if (is("digit")) { setRange(bits, '0', '9'); }
+        else if (is("alpha")) { setRange(bits, 'a', 'z'); setRange(bits, 'A', 'Z'); }
+        else if (is("alnum")) { setRange(bits, '0', '9'); setRange(bits, 'a', 'z'); setRange(bits, 'A', 'Z'); }
+        else if (is("upper")) { setRange(bits, 'A', 'Z'); }
+        else if (is("lower")) { setRange(bits, 'a', 'z'); }
+        else if (is("xdigit")) { setRange(bits, '0', '9'); setRange(bits, 'a', 'f'); setRange(bits, 'A', 'F'); }
+        else if (is("space")) { setRange(bits, '\t', '\r'); setBit(bits, ' '); }
+        else if (is("blank")) { setBit(bits, '\t'); setBit(bits, ' '); }
+        else if (is("punct")) { setRange(bits, '!', '/'); setRange(bits, ':', '@'); setRange(bits, '[', '`'); setRange(bits, '{', '~'); }
+        else if (is("word")) { setRange(bits, '0', '9'); setRange(bits, 'a', 'z'); setRange(bits, 'A', 'Z'); setBit(bits, '_'); }
+        else return false;
+        return true;
+    }
+}
+
+namespace cms {
+
+    /// [RegexCompiler] 패턴 → 구문 트리 → NFA 프로그램 변환기
+    ///
+    /// 1) 재귀 하강 파서가 패턴을 고정 크기 노드 배열(스택)에 구문 트리로 만듭니다.
+    ///    연결(CAT)과 선택(ALT)은 자식 목록을 next로 잇는 방식이라 재귀 깊이가 괄호 중첩 깊이로 제한됩니다.
+    /// 2) 코드 생성기가 트리를 순회하며 Thompson 구성법으로 명령어를 배치합니다. {m,n}은 자식 코드를 반복 배치하여 펼칩니다.
+    class RegexCompiler {
+    public:
+        RegexCompiler(RegexBase& re, const char* pattern, bool ignoreCase)
+            : _re(re), _p(pattern), _ignoreCase(ignoreCase) {}
+
+        bool compile() {
+            const uint8_t root = parseAlt();
+            if (!_ok || *_p != '\0') return false; // 짝이 없는 ')' 등 남은 입력은 오류
+
+            _re._anchored = startsWithBol(root);
+            emit(root);
+            put(OP_MATCH);
+            return _ok;
+        }
+
+    private:
+        enum NodeType : uint8_t { N_EMPTY, N_LIT, N_ANY, N_CLASS, N_BOL, N_EOL, N_CAT, N_ALT, N_REPEAT };
+
+        /// 구문 트리 노드 (6바이트)
+        struct Node {
+            uint8_t type;
+            uint8_t val;   // 리터럴 바이트 또는 클래스 번호
+            uint8_t child; // CAT/ALT: 첫 자식, REPEAT: 반복 대상
+            uint8_t next;  // 같은 CAT/ALT 안의 다음 형제
+            uint8_t min;
+            uint8_t max;   // INF면 상한 없음
+        };
+
+        static constexpr size_t MAX_NODES = 128;       // 컴파일 시 스택 사용량 768바이트
+        static constexpr uint8_t NONE = 0xFF;
+        static constexpr uint8_t INF = 0xFF;
+        static constexpr uint8_t MAX_DEPTH = 16;       // 괄호 중첩 한도 (스택 보호)
+        static constexpr unsigned MAX_BOUND = 254;     // {m,n} 한도
+
+        RegexBase& _re;
+        const char* _p;
+        const bool _ignoreCase;
+        bool _ok = true;
+        uint8_t _depth = 0;
+        uint8_t _nodeCount = 0;
+        Node _nodes[MAX_NODES];
+
+        uint8_t fail() {
+            _ok = false;
+            return NONE;
+        }
+
+        uint8_t newNode(uint8_t type, uint8_t val = 0) {
+            if (_nodeCount >= MAX_NODES) return fail();
+            _nodes[_nodeCount] = Node{ type, val, NONE, NONE, 0, 0 };
+            return _nodeCount++;
+        }
+
+        // ------------------------------------------------------------------------------------------
+        // 구문 분석
+        // ------------------------------------------------------------------------------------------
+
+        /// alt := cat ('|' cat)*
+        uint8_t parseAlt() {
+            uint8_t first = parseCat();
+            if (!_ok || *_p != '|') return first;
+
+            const uint8_t alt = newNode(N_ALT);
+            if (!_ok) return NONE;
+            _nodes[alt].child = first;
+            uint8_t last = first;
+            while (_ok && *_p == '|') {
+                _p++;
+                const uint8_t next = parseCat();
+                if (!_ok) return NONE;
+                _nodes[last].next = next;
+                last = next;
+            }
+            return alt;
+        }
+
+        /// cat := repeat* (단일 항목이면 CAT 노드 없이 그대로 반환)
+        uint8_t parseCat() {
+            uint8_t first = NONE;
+            uint8_t last = NONE;
+            uint8_t cat = NONE;
+            while (_ok && *_p != '\0' && *_p != '|' && *_p != ')') {
+                const uint8_t item = parseRepeat();
+                if (!_ok) return NONE;
+                if (first == NONE) {
+                    first = item;
+                } else {
+                    if (cat == NONE) {
+                        cat = newNode(N_CAT);
+                        if (!_ok) return NONE;
+                        _nodes[cat].child = first;
+                    }
+                    _nodes[last].next = item;
+                }
+                last = item;
+            }
+            if (first == NONE) return newNode(N_EMPTY);
+            return (cat == NONE) ? first : cat;
+        }
+
+        /// repeat := atom ('*' | '+' | '?' | '{m[,[n]]}')*
+        uint8_t parseRepeat() {
+            uint8_t node = parseAtom();
+            while (_ok) {
+                unsigned mn, mx;
+                if (*_p == '*') { mn = 0; mx = INF; _p++; }
+                else if (*_p == '+') { mn = 1; mx = INF; _p++; }
+                else if (*_p == '?') { mn = 0; mx = 1; _p++; }
+                else if (*_p == '{' && _p[1] >= '0' && _p[1] <= '9') {
+                    _p++;
+                    mn = parseNumber();
+                    mx = mn;
+                    if (*_p == ',') {
+                        _p++;
+                        mx = (*_p == '}') ? INF : parseNumber();
+                    }
+                    if (*_p != '}' || mn > MAX_BOUND || (mx != INF && (mx > MAX_BOUND || mx < mn))) return fail();
+                    _p++;
+                } else {
+                    break;
+                }
+
+                const uint8_t rep = newNode(N_REPEAT);
+                if (!_ok) return NONE;
+                _nodes[rep].child = node;
+                _nodes[rep].min = static_cast<uint8_t>(mn);
+                _nodes[rep].max = static_cast<uint8_t>(mx);
+                node = rep;
+            }
+            return node;
+        }
+
+        unsigned parseNumber() {
+            unsigned v = 0;
+            while (*_p >= '0' && *_p <= '9') {
+                if (v <= MAX_BOUND) v = v * 10 + static_cast<unsigned>(*_p - '0');
+                _p++;
+            }
+            return v;
+        }
+
+        /// atom := '(' alt ')' | '[' class ']' | '.' | '^' | '$' | '\' escape | literal
+        uint8_t parseAtom() {
+            const unsigned char c = static_cast<unsigned char>(*_p++);
+            switch (c) {
+                case '(': {
+                    if (++_depth > MAX_DEPTH) return fail();
+                    if (_p[0] == '?') {
+                        if (_p[1] != ':') return fail(); // 전후방 탐색 등은 지원하지 않음
+                        _p += 2;
+                    }
+                    const uint8_t inner = parseAlt();
+                    if (!_ok || *_p != ')') return fail();
+                    _p++;
+                    _depth--;
+                    return inner;
+                }
+                case '[': {
+                    uint8_t bits[RegexBase::CLASS_BYTES];
+                    if (!parseClass(bits)) return fail();
+                    return classNode(bits);
+                }
+                case '.': return newNode(N_ANY);
+                case '^': return newNode(N_BOL);
+                case '$': return newNode(N_EOL);
+                case '\\': return parseEscape();
+                case '*': case '+': case '?': return fail(); // 반복할 대상이 없음
+                default: return literal(c);
+            }
+        }
+
+        uint8_t literal(unsigned char c) {
+            return newNode(N_LIT, c);
+        }
+
+        /// 괄호 밖의 이스케이프 (\d 등은 클래스, 나머지는 리터럴)
+        uint8_t parseEscape() {
+            const char e = *_p;
+            if (e == '\0') return fail();
+            _p++;
+            uint8_t bits[RegexBase::CLASS_BYTES];
+            memset(bits, 0, sizeof(bits));
+            if (shorthandClass(e, bits)) return classNode(bits);
+            if (e >= '1' && e <= '9') return fail(); // 역참조는 지원하지 않음
+            return literal(escapedChar(e));
+        }
+
+        /// \d \D \w \W \s \S 단축 클래스를 bits에 더합니다. (해당하지 않으면 false)
+        static bool shorthandClass(char e, uint8_t* bits) {
+            uint8_t tmp[RegexBase::CLASS_BYTES];
+            memset(tmp, 0, sizeof(tmp));
+            switch (e) {
+                case 'd': case 'D': fillNamedClass(tmp, "digit", 5); break;
+                case 'w': case 'W': fillNamedClass(tmp, "word", 4); break;
+                case 's': case 'S': fillNamedClass(tmp, "space", 5); break;
+                default: return false;
+            }
+            const bool negate = (e == 'D' || e == 'W' || e == 'S');
+            for (size_t i = 0; i < RegexBase::CLASS_BYTES; ++i) bits[i] |= negate ? static_cast<uint8_t>(~tmp[i]) : tmp[i];
+            return true;
+        }
+
+        static unsigned char escapedChar(char e) {
+            switch (e) {
+                case 'n': return '\n';
+                case 'r': return '\r';
+                case 't': return '\t';
+                case 'f': return '\f';
+                case 'v': return '\v';
+                default: return static_cast<unsigned char>(e);
+            }
+        }
+
+        /// '[' 다음부터 ']'까지의 문자 클래스를 비트맵으로 만듭니다.
+        bool parseClass(uint8_t* bits) {
+            memset(bits, 0, RegexBase::CLASS_BYTES);
+            const bool negate = (*_p == '^');
+            if (negate) _p++;
+
+            bool first = true;
+            while (*_p != '\0' && (*_p != ']' || first)) {
+                first = false;
+
+                // [:name:] POSIX 이름 클래스
+                if (_p[0] == '[' && _p[1] == ':') {
+                    const char* name = _p + 2;
+                    const char* end = strstr(name, ":]");
+                    if (!end || !fillNamedClass(bits, name, end - name)) return false;
+                    _p = end + 2;
+                    continue;
+                }
+
+                unsigned lo;
+                if (*_p == '\\') {
+                    const char e = _p[1];
+                    if (e == '\0') return false;
+                    _p += 2;
+                    if (shorthandClass(e, bits)) continue;
+                    lo = escapedChar(e);
+                } else {
+                    lo = static_cast<unsigned char>(*_p++);
+                }
+
+                unsigned hi = lo;
+                if (_p[0] == '-' && _p[1] != '\0' && _p[1] != ']') {
+                    _p++;
+                    if (*_p == '\\') {
+                        if (_p[1] == '\0') return false;
+                        hi = escapedChar(_p[1]);
+                        _p += 2;
+                    } else {
+                        hi = static_cast<unsigned char>(*_p++);
+                    }
+                    if (hi < lo) return false;
+                }
+                setRange(bits, lo, hi);
+            }
+            if (*_p != ']') return false;
+            _p++;
+
+            if (_ignoreCase) {
+                for (unsigned c = 'a'; c <= 'z'; ++c) {
+                    const unsigned u = c - ('a' - 'A');
+                    if (testBit(bits, c) || testBit(bits, u)) { setBit(bits, c); setBit(bits, u); }
+                }
+            }
+            if (negate) {
+                for (size_t i = 0; i < RegexBase::CLASS_BYTES; ++i) bits[i] = static_cast<uint8_t>(~bits[i]);
+            }
+            return true;
+        }
+
+        /// 비트맵을 클래스 테이블에 등록(동일한 클래스는 재사용)하고 노드를 만듭니다.
+        uint8_t classNode(const uint8_t* bits) {
+            uint8_t idx = 0;
+            while (idx < _re._classCount && memcmp(_re._classes[idx], bits, RegexBase::CLASS_BYTES) != 0) idx++;
+            if (idx == _re._classCount) {
+                if (_re._classCount >= _re._maxClasses) return fail();
+                memcpy(_re._classes[idx], bits, RegexBase::CLASS_BYTES);
+                _re._classCount++;
+            }
+            return newNode(N_CLASS, idx);
+        }
+
+        /// 패턴의 맨 앞이 '^'이면 0번 위치에서만 시작하면 됩니다.
+        bool startsWithBol(uint8_t n) const {
+            while (n != NONE && _nodes[n].type == N_CAT) n = _nodes[n].child;
+            return n != NONE && _nodes[n].type == N_BOL;
+        }
+
+        // ------------------------------------------------------------------------------------------
+        // 코드 생성
+        // ------------------------------------------------------------------------------------------
+
+        uint8_t pc() const { return _re._size; }
+
+        /// 명령어 하나를 추가하고 위치를 반환합니다. (용량 초과 시 실패 처리)
+        uint8_t put(uint8_t op, uint8_t arg = 0, uint8_t x = 0, uint8_t y = 0) {
+            if (!_ok || _re._size >= _re._maxInst) return fail();
+            _re._program[_re._size] = RegexBase::Inst{ op, arg, x, y };
+            return _re._size++;
+        }
+
+        void emit(uint8_t n) {
+            if (!_ok || n == NONE) return;
+            const Node& node = _nodes[n];
+            switch (node.type) {
+                case N_EMPTY:
+                    break;
+                case N_LIT:
+                    if (_ignoreCase && isAsciiAlpha(node.val)) put(OP_CHAR_FOLD, foldAscii(node.val));
+                    else put(OP_CHAR, node.val);
+                    break;
+                case N_ANY:   put(OP_ANY); break;
+                case N_CLASS: put(OP_CLASS, node.val); break;
+                case N_BOL:   put(OP_BOL); break;
+                case N_EOL:   put(OP_EOL); break;
+                case N_CAT:
+                    for (uint8_t c = node.child; c != NONE && _ok; c = _nodes[c].next) emit(c);
+                    break;
+                case N_ALT: {
+                    // SPLIT L1, L2 / L1: e1 / JMP end / L2: e2 ... 끝으로 가는 JMP들은 x 필드로 연결해 두었다가 한 번에 채움
+                    uint8_t pendingJmp = NONE;
+                    for (uint8_t c = node.child; c != NONE && _ok; c = _nodes[c].next) {
+                        if (_nodes[c].next == NONE) {
+                            emit(c);
+                            break;
+                        }
+                        const uint8_t split = put(OP_SPLIT);
+                        if (!_ok) return;
+                        _re._program[split].x = pc();
+                        emit(c);
+                        const uint8_t jmp = put(OP_JMP, 0, pendingJmp);
+                        if (!_ok) return;
+                        pendingJmp = jmp;
+                        _re._program[split].y = pc();
+                    }
+                    while (_ok && pendingJmp != NONE) {
+                        const uint8_t prev = _re._program[pendingJmp].x;
+                        _re._program[pendingJmp].x = pc();
+                        pendingJmp = prev;
+                    }
+                    break;
+                }
+                case N_REPEAT:
+                    emitRepeat(node);
+                    break;
+            }
+        }
+
+        void emitRepeat(const Node& node) {
+            const unsigned mn = node.min;
+            if (node.max == INF) {
+                if (mn > 0) {
+                    // x{m,}: x를 m-1번 배치한 뒤 마지막 복사본으로 되돌아가는 SPLIT (L: x / SPLIT L, next)
+                    for (unsigned i = 0; i + 1 < mn && _ok; ++i) emit(node.child);
+                    const uint8_t loop = pc();
+                    emit(node.child);
+                    put(OP_SPLIT, 0, loop, static_cast<uint8_t>(pc() + 1));
+                } else {
+                    // x*: L1: SPLIT L2, L3 / L2: x / JMP L1 / L3:
+                    const uint8_t split = put(OP_SPLIT);
+                    if (!_ok) return;
+                    _re._program[split].x = pc();
+                    emit(node.child);
+                    put(OP_JMP, 0, split);
+                    if (_ok) _re._program[split].y = pc();
+                }
+                return;
+            }
+
+            // x{m,n}: x를 m번 배치한 뒤 (n - m)개의 x?를 이어 붙임
+            for (unsigned i = 0; i < mn && _ok; ++i) emit(node.child);
+            for (unsigned i = mn; i < node.max && _ok; ++i) {
+                const uint8_t split = put(OP_SPLIT);
+                if (!_ok) return;
+                _re._program[split].x = pc();
+                emit(node.child);
+                if (_ok) _re._program[split].y = pc();
+            }
+        }
+    };
+
+    /// [RegexBase] 생성자 구현
+    RegexBase::RegexBase(Inst* program, size_t maxInst, uint8_t (*classes)[CLASS_BYTES], size_t maxClasses) noexcept
+        : _program(program), _classes(classes),
+          _maxInst(static_cast<uint8_t>(maxInst)), _maxClasses(static_cast<uint8_t>(maxClasses)),
+          _size(0), _classCount(0), _anchored(false) {}
+
+    /// [compile] 패턴 컴파일 구현
+    ///
+    /// 실패하면 프로그램을 비워(_size = 0) 이후 matches()가 항상 false를 반환하도록 합니다.
+    void RegexBase::compile(const char* pattern, bool ignoreCase) noexcept {
+        _size = 0;
+        _classCount = 0;
+        _anchored = false;
+        if (!pattern) return;
+
+        RegexCompiler compiler(*this, pattern, ignoreCase);
+        if (!compiler.compile()) _size = 0;
+    }
+
+    /// [run] Thompson NFA 시뮬레이션 구현
+    ///
+    /// 1) 현재 위치에서 살아 있는 소비 명령(CHAR/ANY/CLASS) 목록을 유지합니다.
+    /// 2) 바이트 하나를 읽을 때마다 통과한 명령의 다음 위치에서 엡실론 폐포(SPLIT/JMP/BOL/EOL)를 따라 다음 목록을 만듭니다.
+    ///    방문 비트맵으로 같은 위치의 상태를 한 번만 추가하므로 단계마다 O(명령어 수), 전체 O(텍스트 길이 × 명령어 수)입니다.
+    /// 3) 고정되지 않은 패턴은 매 위치에서 시작 상태를 새로 투입하여 부분 일치(검색)를 처리합니다.
+    bool RegexBase::run(const char* text, size_t len, uint8_t* scratch) const noexcept {
+        if (_size == 0 || (!text && len > 0)) return false;
+
+        uint8_t* clist = scratch;
+        uint8_t* nlist = scratch + _maxInst;
+        uint8_t* const stack = scratch + _maxInst * 2;
+        uint8_t* const mark = scratch + _maxInst * 3;
+        const size_t markBytes = (static_cast<size_t>(_size) + 7) / 8;
+
+        // 폐포 탐색: MATCH에 도달하면 즉시 true
+        auto addThread = [&](uint8_t* list, size_t& count, uint8_t start, size_t pos) -> bool {
+            size_t sp = 0;
+            auto push = [&](uint8_t t) {
+                if (!testBit(mark, t)) {
+                    setBit(mark, t);
+                    stack[sp++] = t;
+                }
+            };
+            push(start);
+            while (sp > 0) {
+                const uint8_t at = stack[--sp];
+                const Inst& in = _program[at];
+                switch (in.op) {
+                    case OP_MATCH: return true;
+                    case OP_JMP:   push(in.x); break;
+                    case OP_SPLIT: push(in.y); push(in.x); break;
+                    case OP_BOL:   if (pos == 0) push(static_cast<uint8_t>(at + 1)); break;
+                    case OP_EOL:   if (pos == len) push(static_cast<uint8_t>(at + 1)); break;
+                    default:       list[count++] = at; break;
+                }
+            }
+            return false;
+        };
+
+        size_t cn = 0;
+        memset(mark, 0, markBytes);
+        if (addThread(clist, cn, 0, 0)) return true;
+
+        for (size_t pos = 0; pos < len; ++pos) {
+            if (cn == 0 && _anchored) return false;
+
+            const unsigned char c = static_cast<unsigned char>(text[pos]);
+            size_t nn = 0;
+            memset(mark, 0, markBytes);
+            for (size_t i = 0; i < cn; ++i) {
+                const Inst& in = _program[clist[i]];
+                bool pass;
+                switch (in.op) {
+                    case OP_CHAR:      pass = (c == in.arg); break;
+                    case OP_CHAR_FOLD: pass = (foldAscii(c) == in.arg); break;
+                    case OP_ANY:       pass = true; break;
+                    case OP_CLASS:     pass = testBit(_classes[in.arg], c); break;
+                    default:           pass = false; break;
+                }
+                if (pass && addThread(nlist, nn, static_cast<uint8_t>(clist[i] + 1), pos + 1)) return true;
+            }
+            if (!_anchored && addThread(nlist, nn, 0, pos + 1)) return true;
+
+            uint8_t* tmp = clist;
+            clist = nlist;
+            nlist = tmp;
+            cn = nn;
+        }
+        return false;
+    }
+
+} // namespace cms
@@ -0,0 +1,144 @@
+/// @author comser.dev
+///
+/// 한 번 컴파일하여 고정 크기 정적 버퍼에 보관하는 백트래킹 없는 정규표현식 엔진입니다.
+/// Thompson NFA 시뮬레이션으로 입력 길이에 선형으로 동작하며, Native와 ARDUINO에서 동일하게 동작합니다.
+
+#pragma once // 중복 포함 방지
+
+#include <stddef.h> // size_t 정의
+#include <stdint.h> // uint8_t 정의
+#include <cstring>  // strlen
+
+namespace cms {
+
+// ==================================================================================================
+// [Regex] 개요
+// - 왜 존재하는가: POSIX regcomp는 호출마다 힙을 할당하며 Native 빌드에서는 사용할 수 없으므로,
+//   입력 명령 검증처럼 같은 패턴을 반복 사용하는 경로에서 컴파일 비용과 힙 사용을 없애기 위해 존재합니다.
+// - 어떻게 동작하는가: 생성 시 패턴을 구문 트리로 분석한 뒤 NFA 명령어 프로그램으로 변환하여 객체 내부 배열에 저장하고,
+//   검사 시에는 가능한 모든 상태를 동시에 진행시키는 Thompson 시뮬레이션으로 바이트마다 한 번씩만 전진합니다.
+// ==================================================================================================
+
+/// 정규표현식 프로그램의 공통 로직(컴파일/실행)을 담당하는 베이스 클래스입니다.
+///
+/// Why: 프로그램 크기(MAX_INST)별로 컴파일러와 실행기 코드가 중복 생성되지 않도록 비-템플릿으로 분리하기 위함입니다. (Thin Template)
+/// How: 외부에서 주입된 명령어/문자 클래스 배열에 컴파일 결과를 기록하고, 실행 시 호출자가 제공한 작업 메모리를 사용합니다.
+///
+/// 지원 문법 (POSIX ERE 부분집합, 바이트 단위):
+/// - 리터럴, `.`, `^`, `$`, `|`, `( )`, `(?: )`
+/// - 수량자 `*`, `+`, `?`, `{m}`, `{m,}`, `{m,n}` (m, n ≤ 254)
+/// - 문자 클래스 `[abc]`, `[^a-z]`, `[[:digit:]]` 등 POSIX 이름 클래스
+/// - 이스케이프 `\d \D \w \W \s \S \n \r \t` 및 메타 문자(`\.` 등)
+///
+/// @note 역참조와 전후방 탐색은 선형 시간 보장을 위해 지원하지 않습니다. (컴파일 실패로 처리)
+/// @note 컴파일이 끝난 객체는 읽기 전용이므로 여러 태스크가 동시에 matches()를 호출해도 안전합니다.
+class RegexBase {
+public:
+    /// 프로그램 명령어 수의 상한 (명령어 위치를 1바이트로 표현)
+    static constexpr size_t MAX_PROGRAM = 255;
+    /// 문자 클래스 하나의 비트맵 크기 (256비트)
+    static constexpr size_t CLASS_BYTES = 32;
+
+    /// NFA 명령어 한 개 (4바이트)
+    struct Inst {
+        uint8_t op;   // 명령 종류
+        uint8_t arg;  // 비교 문자 또는 문자 클래스 번호
+        uint8_t x;    // 분기 대상 1
+        uint8_t y;    // 분기 대상 2 (SPLIT 전용)
+    };
+
+    /// 패턴이 정상적으로 컴파일되었는지 확인합니다.
+    ///
+    /// @return true: 사용 가능, false: 문법 오류 또는 용량(명령어/클래스) 초과
+    [[nodiscard]] bool isValid() const noexcept { return _size > 0; }
+
+    /// 컴파일된 프로그램의 명령어 수를 반환합니다. (MAX_INST 크기 산정용)
+    [[nodiscard]] size_t programSize() const noexcept { return _size; }
+
+    /// 문자 클래스 사용 개수를 반환합니다. (MAX_CLASSES 크기 산정용)
+    [[nodiscard]] size_t classCount() const noexcept { return _classCount; }
+
+protected:
+    /// 내부 생성자입니다. 자식 클래스에서 프로그램/클래스 저장 공간을 주입받습니다.
+    RegexBase(Inst* program, size_t maxInst, uint8_t (*classes)[CLASS_BYTES], size_t maxClasses) noexcept;
+    ~RegexBase() = default;
+
+    /// 패턴을 컴파일하여 주입된 버퍼에 기록합니다. 실패하면 isValid()가 false가 됩니다.
+    void compile(const char* pattern, bool ignoreCase) noexcept;
+
+    /// 텍스트 어딘가에 패턴과 일치하는 구간이 있는지 검사합니다. (scratch: scratchBytes(maxInst) 바이트)
+    bool run(const char* text, size_t len, uint8_t* scratch) const noexcept;
+
+    /// 실행에 필요한 작업 메모리 크기 (현재/다음 상태 목록, 탐색 스택, 방문 비트맵)
+    static constexpr size_t scratchBytes(size_t maxInst) { return maxInst * 3 + (maxInst + 7) / 8; }
+
+private:
+    /// [Compiler] 구문 분석과 코드 생성 (cmsRegex.cpp 내부 전용)
+    friend class RegexCompiler;
+
+    Inst* const _program;
+    uint8_t (* const _classes)[CLASS_BYTES];
+    const uint8_t _maxInst;
+    const uint8_t _maxClasses;
+    /// 사용 중인 명령어 수 (0이면 컴파일 실패).
+    uint8_t _size;
+    /// 사용 중인 문자 클래스 수.
+    uint8_t _classCount;
+    /// 패턴이 '^'로 고정되어 있어 0번 위치에서만 시작하면 되는지 여부.
+    bool _anchored;
+};
+
+/// 고정 크기 정적 버퍼에 컴파일 결과를 보관하는 정규표현식 객체입니다.
+///
+/// 사용 예:
+/// @code
+/// static const cms::Regex<> ipv4("^[0-9]{1,3}(\\.[0-9]{1,3}){3}$");
+/// if (ipv4.matches(payload)) { ... }
+/// if (cmd.matches(ipv4)) { ... }                 // StringBase / Token 오버로드
+/// @endcode
+///
+/// @tparam MAX_INST 최대 명령어 수 (RAM 4바이트/개, 실행 시 스택 약 3.1바이트/개)
+/// @tparam MAX_CLASSES 최대 문자 클래스 수 (RAM 32바이트/개, 동일한 클래스는 공유)
+template<size_t MAX_INST = 64, size_t MAX_CLASSES = 8>
+class Regex : public RegexBase {
+    static_assert(MAX_INST >= 2 && MAX_INST <= RegexBase::MAX_PROGRAM, "cms::Regex MAX_INST must be in [2, 255].");
+    static_assert(MAX_CLASSES >= 1 && MAX_CLASSES <= 255, "cms::Regex MAX_CLASSES must be in [1, 255].");
+
+public:
+    /// 패턴을 컴파일합니다.
+    ///
+    /// @param pattern 정규표현식 패턴
+    /// @param ignoreCase true일 경우 ASCII 대소문자를 구분하지 않음
+    explicit Regex(const char* pattern, bool ignoreCase = false) noexcept
+        : RegexBase(_program, MAX_INST, _classes, MAX_CLASSES) {
+        compile(pattern, ignoreCase);
+    }
+
+    /// 내부 버퍼를 가리키는 베이스 포인터가 복사되지 않도록 복사를 금지합니다.
+    Regex(const Regex&) = delete;
+    Regex& operator=(const Regex&) = delete;
+
+    /// 텍스트 어딘가에 일치하는 구간이 있는지 검사합니다. (POSIX regexec와 같은 검색 의미, 전체 일치는 ^...$ 사용)
+    ///
+    /// @param text 검사 대상
+    /// @param len 검사 대상의 바이트 길이
+    ///
+    /// @return true: 일치, false: 불일치 또는 컴파일 실패
+    bool matches(const char* text, size_t len) const noexcept {
+        uint8_t scratch[scratchBytes(MAX_INST)];
+        return run(text, len, scratch);
+    }
+
+    /// 널 종료 문자열을 검사합니다.
+    bool matches(const char* text) const noexcept {
+        return text && matches(text, strlen(text));
+    }
+
+private:
+    /// 컴파일된 NFA 프로그램.
+    Inst _program[MAX_INST];
+    /// 문자 클래스 비트맵.
+    uint8_t _classes[MAX_CLASSES][CLASS_BYTES];
+};
+
+} // namespace cms
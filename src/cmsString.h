@@ -10,6 +10,8 @@
 #include <cstring>   // strlen, memcpy, memmove
 #include "cmsStringUtil.h" // cms::string helpers (UTF-8, regex, etc.)
 #include "cmsStringBase.h" // StringBase API
+#include "cmsRegex.h"      // cms::Regex (StringBase::matches 오버로드)
+#include "cmsStringTable.h" // cms::StringTable (문자열 인터닝)
 
 namespace cms {
 
@@ -79,10 +81,27 @@ namespace cms {
             updatePeak();
         }
 
+        /// 컴파일 타임 고정 문자열로부터 객체를 생성합니다.
+        ///
+        /// Why: 상수 접두사/태그로 시작하는 메시지를 strlen 없이 만들기 위함입니다.
+        /// How: 크기를 컴파일 타임에 검사하고, 길이가 상수인 memcpy 한 번으로 복사합니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// static constexpr cms::FixedString kPrefix{"[RETRY-SYSTEM] "};
+        /// cms::String<128> msg = kPrefix;
+        /// @endcode
+        template<size_t M>
+        String(const FixedString<M>& src) : StringBase(_data, N, M - 1) {
+            static_assert(M <= N, "FixedString exceeds cms::String buffer capacity.");
+            memcpy(_data, src.c_str(), M); // 널 종료 문자 포함 복사
+            updatePeak();
+        }
+
         /// C 스타일 문자열 포인터로부터 객체를 생성합니다.
         ///
         /// Why: 외부에서 전달된 문자열 포인터를 기반으로 객체를 생성하기 위함입니다.
-        /// How: 대입 연산자를 호출하여 안전하게 데이터를 복사합니다.
+        /// How: 빈 상태로 초기화한 뒤 대입 연산자를 호출하여 안전하게 데이터를 복사합니다.
         ///
         /// 사용 예:
         /// @code
@@ -90,15 +109,40 @@ namespace cms {
         /// @endcode
         ///
         /// @param src 복사할 원본 문자열 포인터
-        String(const char* src) : StringBase(_data, N) {
+        String(const char* src) : StringBase(_data, N, 0) {
+            // 초기화되지 않은 _data에 strlen을 돌리지 않도록 길이 0으로 시작
+            _data[0] = '\0';
             *this = src;
         }
 
+        /// 같은 크기의 String 객체로부터 복사 생성합니다.
+        ///
+        /// Why: 암시적 복사 생성자는 부모의 _buf 포인터까지 복사하여, 사본이 원본의 버퍼를 가리키게 되기 때문입니다.
+        ///      (operator+, substring 등 값 반환 경로에서 원본이 함께 바뀌거나 소멸한 버퍼를 가리킴)
+        /// How: 자신의 _data를 버퍼로 주입한 뒤 내용만 복사합니다.
+        String(const String& other) : StringBase(_data, N, 0) {
+            _data[0] = '\0';
+            StringBase::operator=(other);
+        }
+
+        /// 다른 크기(M)의 String 객체로부터 생성합니다. (용량을 넘는 부분은 잘림)
+        template<size_t M>
+        String(const String<M>& other) : StringBase(_data, N, 0) {
+            _data[0] = '\0';
+            StringBase::operator=(other);
+        }
+
         /// Token 객체로부터 객체를 생성합니다.
         String(const cms::string::Token& token) : StringBase(_data, N, 0) {
             *this = token;
         }
 
+        /// 뷰가 가리키는 내용을 복사하여 생성합니다. (용량을 넘는 부분은 잘림)
+        String(StringView src) : StringBase(_data, N, 0) {
+            _data[0] = '\0';
+            append(src.data(), src.length());
+        }
+
         // --------------------------------------------------------------------------------------------------
         // [operator=] C 문자열을 대입합니다.
         //
@@ -144,6 +188,32 @@ namespace cms {
             return *this;
         }
 
+        // --------------------------------------------------------------------------------------------------
+        // [operator=] 뷰 또는 다른 StringBase의 내용을 대입합니다.
+        //
+        // Usage: s = line.view(4);
+        // --------------------------------------------------------------------------------------------------
+        String& operator=(StringView src) {
+            StringBase::operator=(src);
+            return *this;
+        }
+        String& operator=(const StringBase& other) {
+            StringBase::operator=(other);
+            return *this;
+        }
+
+        // --------------------------------------------------------------------------------------------------
+        // [operator=] 컴파일 타임 고정 문자열을 대입합니다.
+        //
+        // Usage: s = kPrefix;
+        // --------------------------------------------------------------------------------------------------
+        template<size_t M>
+        String& operator=(const FixedString<M>& src) {
+            clear();
+            append(src.c_str(), M - 1);
+            return *this;
+        }
+
         // --------------------------------------------------------------------------------------------------
         // [operator+=] C 문자열을 덧붙입니다.
         //
@@ -183,6 +253,18 @@ namespace cms {
             return *this;
         }
 
+        // --------------------------------------------------------------------------------------------------
+        // [operator+=] 뷰 또는 다른 StringBase를 덧붙입니다.
+        // --------------------------------------------------------------------------------------------------
+        String& operator+=(StringView src) {
+            StringBase::operator+=(src);
+            return *this;
+        }
+        String& operator+=(const StringBase& other) {
+            StringBase::operator+=(other);
+            return *this;
+        }
+
         // --------------------------------------------------------------------------------------------------
         // [operator+] C 문자열을 결합해 새 객체를 반환합니다.
         //
@@ -248,14 +330,31 @@ namespace cms {
             return *this;
         }
 
+        /// 컴파일 타임 고정 문자열 스트림/결합 연산자 (반환 타입 유지용)
+        template<size_t M>
+        String<N>& operator<<(const FixedString<M>& s) {
+            StringBase::operator<<(s);
+            return *this;
+        }
+
+        template<size_t M>
+        String<N>& operator+=(const FixedString<M>& s) {
+            StringBase::operator+=(s);
+            return *this;
+        }
+
         String<N>& operator<<(char c) { StringBase::operator<<(c); return *this; }
         String<N>& operator<<(int v) { StringBase::operator<<(v); return *this; }
         String<N>& operator<<(long v) { StringBase::operator<<(v); return *this; }
+        String<N>& operator<<(unsigned int v) { StringBase::operator<<(v); return *this; }
         String<N>& operator<<(unsigned long v) { StringBase::operator<<(v); return *this; }
+        String<N>& operator<<(long long v) { StringBase::operator<<(v); return *this; }
+        String<N>& operator<<(unsigned long long v) { StringBase::operator<<(v); return *this; }
         String<N>& operator<<(float v) { StringBase::operator<<(v); return *this; }
         String<N>& operator<<(double v) { StringBase::operator<<(v); return *this; }
         String<N>& operator<<(const StringBase& other) { StringBase::operator<<(other); return *this; }
         String<N>& operator<<(const cms::string::Token& token) { StringBase::operator<<(token); return *this; }
+        String<N>& operator<<(StringView view) { StringBase::operator<<(view); return *this; }
 
         using StringBase::substring;
         using StringBase::byteSubstring;
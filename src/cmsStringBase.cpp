@@ -29,7 +29,7 @@ namespace cms {
     /// @param b 문자열 데이터를 저장할 외부 char 배열 포인터
     /// @param c 버퍼의 전체 물리적 용량 (단위: bytes, 널 종료 문자 포함)
     StringBase::StringBase(char* b, size_t c)
-        : _buf(b), _capacity(static_cast<uint16_t>(c)), _len(0) {
+        : _buf(b), _capacity(static_cast<uint16_t>(c)), _len(0), _charCount(CHAR_COUNT_UNKNOWN) {
 #ifdef CMS_ENABLE_PROFILING
         _maxLenSeen = 0;
 #endif
@@ -40,7 +40,8 @@ namespace cms {
     }
 
     StringBase::StringBase(char* b, size_t c, size_t l)
-        : _buf(b), _capacity(static_cast<uint16_t>(c)), _len(static_cast<uint16_t>(l)) {
+        : _buf(b), _capacity(static_cast<uint16_t>(c)), _len(static_cast<uint16_t>(l)),
+          _charCount(l == 0 ? 0 : CHAR_COUNT_UNKNOWN) {
 #ifdef CMS_ENABLE_PROFILING
         _maxLenSeen = _len;
 #endif
@@ -83,9 +84,20 @@ namespace cms {
         if (_capacity > 0) {
             _buf[0] = '\0';
             _len = 0;
+            _charCount = 0;
         }
     }
 
+    /// 직접 수정한 버퍼의 길이를 반영합니다.
+    void StringBase::setLength(size_t len) {
+        if (_capacity == 0) return;
+        if (len >= _capacity) len = _capacity - 1u;
+        _len = static_cast<uint16_t>(len);
+        _buf[_len] = '\0';
+        _charCount = CHAR_COUNT_UNKNOWN; // 버퍼를 직접 가공했으므로 내용은 알 수 없음
+        updatePeak();
+    }
+
     /// C 스타일 문자열을 대입합니다.
     ///
     /// Why: 기존 내용을 버리고 새로운 문자열로 교체하기 위함입니다.
@@ -132,6 +144,23 @@ namespace cms {
         return *this;
     }
 
+    /// 뷰 대입 (s = s.view(2)처럼 자기 버퍼를 가리키면 앞으로 당겨 이동)
+    StringBase& StringBase::operator=(StringView src) {
+        const uintptr_t p = reinterpret_cast<uintptr_t>(src.data());
+        const uintptr_t b = reinterpret_cast<uintptr_t>(_buf);
+        if (p >= b && p <= b + _len) {
+            const size_t n = src.length();
+            memmove(_buf, src.data(), n);
+            _len = static_cast<uint16_t>(n);
+            _buf[n] = '\0';
+            _charCount = CHAR_COUNT_UNKNOWN;
+            return *this;
+        }
+        clear();
+        append(src.data(), src.length());
+        return *this;
+    }
+
     /// 기존 문자열 뒤에 문자열을 결합합니다.
     /// @param src 추가할 문자열 포인터
     /// @return 자기 자신의 참조
@@ -182,6 +211,10 @@ namespace cms {
 
         if (toCopy > 0) {
             memcpy(_buf + _len, s, toCopy);
+            if (_charCount != CHAR_COUNT_UNKNOWN) {
+                // 방금 복사한 구간만 세어 캐시를 유지 (캐시에 올라온 데이터이므로 추가 비용이 작음)
+                _charCount = static_cast<uint16_t>(_charCount + cms::string::utf8_strlen(s, toCopy));
+            }
             _len += toCopy;
             _buf[_len] = '\0';
             updatePeak();
@@ -197,7 +230,10 @@ namespace cms {
     /// Why: 사용자 입력이나 통신 데이터의 불필요한 여백을 정리하기 위함입니다.
     /// How: memmove를 사용하여 데이터를 재배치하는 In-place 수정 방식입니다.
     void StringBase::trim() {
+        const uint16_t before = _len;
         _len = cms::string::trim(_buf);
+        // 제거되는 공백/제어 문자는 모두 1바이트 글자이므로 바이트 감소분이 곧 글자 감소분
+        if (_charCount != CHAR_COUNT_UNKNOWN) _charCount = static_cast<uint16_t>(_charCount - (before - _len));
         updatePeak();
     }
 
@@ -220,13 +256,23 @@ namespace cms {
     /// @return 글자 단위 인덱스 (없으면 -1)
     int StringBase::find(const char* target, size_t startChar, bool ignoreCase) const {
         if (!target) return -1;
-        return cms::string::find(_buf, _len, target, strlen(target), startChar, ignoreCase);
+        return findImpl(target, strlen(target), startChar, ignoreCase);
+    }
+
+    /// find/indexOf 공통 구현입니다.
+    ///
+    /// How: ASCII 문자열이면 글자 인덱스가 곧 바이트 오프셋이므로 변환 스캔 없이 바이트 탐색만 수행합니다.
+    int StringBase::findImpl(const char* target, size_t targetLen, size_t startChar, bool ignoreCase) const {
+        if (charsAreBytes()) {
+            return cms::string::findBytes(_buf, _len, target, targetLen, startChar, ignoreCase);
+        }
+        return cms::string::find(_buf, _len, target, targetLen, startChar, ignoreCase);
     }
 
     /// 특정 문자의 논리적 위치를 찾습니다.
     int StringBase::indexOf(char c, size_t startChar, bool ignoreCase) const {
         char tmp[2] = {c, '\0'};
-        return cms::string::find(_buf, _len, tmp, 1, startChar, ignoreCase);
+        return findImpl(tmp, 1, startChar, ignoreCase);
     }
 
     /// 특정 문자열의 논리적 위치를 찾습니다.
@@ -237,13 +283,21 @@ namespace cms {
     /// 마지막으로 나타나는 문자열의 위치를 찾습니다.
     int StringBase::lastIndexOf(const char* target, bool ignoreCase) const {
         if (!target) return -1;
-        return cms::string::lastIndexOf(_buf, _len, target, strlen(target), ignoreCase);
+        return lastIndexOfImpl(target, strlen(target), ignoreCase);
+    }
+
+    /// lastIndexOf 공통 구현입니다. (ASCII 문자열은 바이트 오프셋을 그대로 반환)
+    int StringBase::lastIndexOfImpl(const char* target, size_t targetLen, bool ignoreCase) const {
+        if (charsAreBytes()) {
+            return cms::string::findLastBytes(_buf, _len, target, targetLen, ignoreCase);
+        }
+        return cms::string::lastIndexOf(_buf, _len, target, targetLen, ignoreCase);
     }
 
     /// 마지막으로 나타나는 문자의 위치를 찾습니다.
     int StringBase::lastIndexOf(char c, bool ignoreCase) const {
         char tmp[2] = {c, '\0'};
-        return cms::string::lastIndexOf(_buf, _len, tmp, 1, ignoreCase);
+        return lastIndexOfImpl(tmp, 1, ignoreCase);
     }
 
     /// 특정 문자열 포함 여부를 확인합니다.
@@ -272,13 +326,27 @@ namespace cms {
     /// How: 치환 후 길이가 변할 경우 데이터를 재배치하며 버퍼 크기를 초과하면 중단됩니다.
     void StringBase::replace(const char* from, const char* to, bool ignoreCase) {
         _len = cms::string::replace(_buf, _capacity, _len, from, to, ignoreCase);
+        _charCount = CHAR_COUNT_UNKNOWN;
         updatePeak();
     }
 
+    /// 치환 결과를 다른 객체에 작성합니다.
+    ///
+    /// How: 자기 자신이 대상이면 제자리 replace로 처리하고, 그 외에는 원본을 읽기 전용으로 두고 대상 버퍼에만 씁니다.
+    void StringBase::replaceInto(StringBase& dest, const char* from, const char* to, bool ignoreCase) const {
+        if (&dest == this) {
+            dest.replace(from, to, ignoreCase);
+            return;
+        }
+        dest._len = static_cast<uint16_t>(cms::string::replaceInto(_buf, _len, dest._buf, dest._capacity, from, to, ignoreCase));
+        dest._charCount = CHAR_COUNT_UNKNOWN;
+        dest.updatePeak();
+    }
+
     /// 정수 데이터를 텍스트로 변환하여 덧붙입니다.
     ///
     /// Why: printf의 무거운 오버헤드 없이 고속으로 숫자를 직렬화하기 위함입니다.
-    /// How: 숫자를 역순으로 추출한 뒤 뒤집는 전용 알고리즘을 사용합니다.
+    /// How: 자릿수를 먼저 계산한 뒤 최종 위치에 2자리씩 역순으로 기록하여 뒤집기 과정이 없습니다.
     ///
     /// @param val 추가할 정수 값
     /// @param width 최소 출력 너비
@@ -286,8 +354,21 @@ namespace cms {
     void StringBase::appendInt(long val, int width, char padChar) {
         size_t curLen = _len;
         cms::string::appendInt(_buf, _capacity, curLen, val, width, padChar);
-        _len = static_cast<uint16_t>(curLen);
-        updatePeak();
+        commitAscii(curLen); // 숫자는 모두 ASCII
+    }
+
+    /// 부호 없는 정수 값을 문자열로 변환하여 추가합니다.
+    void StringBase::appendUInt(unsigned long val, int width, char padChar) {
+        size_t curLen = _len;
+        cms::string::appendUInt(_buf, _capacity, curLen, val, width, padChar);
+        commitAscii(curLen);
+    }
+
+    /// 부호 없는 정수 값을 16진수 문자열로 변환하여 추가합니다.
+    void StringBase::appendHex(unsigned long val, int width, char padChar, bool uppercase) {
+        size_t curLen = _len;
+        cms::string::appendHex(_buf, _capacity, curLen, val, width, padChar, uppercase);
+        commitAscii(curLen);
     }
 
     /// 실수 데이터를 텍스트로 변환하여 덧붙입니다.
@@ -296,8 +377,21 @@ namespace cms {
     void StringBase::appendFloat(float val, int decimalPlaces) {
         size_t curLen = _len;
         cms::string::appendFloat(_buf, _capacity, curLen, val, decimalPlaces);
-        _len = static_cast<uint16_t>(curLen);
-        updatePeak();
+        commitAscii(curLen);
+    }
+
+    /// 실수 값을 최단 왕복 표기로 추가합니다. (float 정밀도 기준)
+    void StringBase::appendShortest(float val) {
+        size_t curLen = _len;
+        cms::string::appendShortest(_buf, _capacity, curLen, val);
+        commitAscii(curLen);
+    }
+
+    /// 실수 값을 최단 왕복 표기로 추가합니다. (double 정밀도 기준)
+    void StringBase::appendShortest(double val) {
+        size_t curLen = _len;
+        cms::string::appendShortest(_buf, _capacity, curLen, val);
+        commitAscii(curLen);
     }
 
     /// 기존 내용을 지우고 정수 값을 설정합니다.
@@ -315,10 +409,10 @@ namespace cms {
     ///
     /// @return 포맷팅 후 최종 문자열의 전체 바이트 길이
     int StringBase::appendPrintf(const char* format, va_list args) {
+        const size_t before = _len;
         size_t curLen = _len;
         int ret = cms::string::appendPrintf(_buf, _capacity, curLen, format, args);
-        _len = static_cast<uint16_t>(curLen);
-        updatePeak();
+        commitAppend(before, curLen);
         return ret;
     }
 
@@ -330,6 +424,14 @@ namespace cms {
         return ret;
     }
 
+    int StringBase::appendPacked(const char* format, const uint8_t* packed, size_t packedLen) {
+        const size_t before = _len;
+        size_t curLen = _len;
+        int ret = cms::string::appendPacked(_buf, _capacity, curLen, format, packed, packedLen);
+        commitAppend(before, curLen);
+        return ret;
+    }
+
     /// printf 스타일로 문자열을 조립합니다. 기존 내용은 삭제됩니다.
     ///
     /// 사용 예:
@@ -378,21 +480,43 @@ namespace cms {
         return *this;
     }
 
+    /// 스트림 스타일로 unsigned int 정수를 결합합니다.
+    StringBase& StringBase::operator<<(unsigned int v) {
+        appendUInt(v);
+        return *this;
+    }
+
     /// 스트림 스타일로 unsigned long 정수를 결합합니다.
     StringBase& StringBase::operator<<(unsigned long v) {
-        appendInt((long)v);
+        appendUInt(v);
+        return *this;
+    }
+
+    /// 스트림 스타일로 64비트 정수를 결합합니다.
+    StringBase& StringBase::operator<<(long long v) {
+        size_t curLen = _len;
+        cms::string::appendInt64(_buf, _capacity, curLen, v);
+        commitAscii(curLen);
+        return *this;
+    }
+
+    /// 스트림 스타일로 64비트 부호 없는 정수를 결합합니다.
+    StringBase& StringBase::operator<<(unsigned long long v) {
+        size_t curLen = _len;
+        cms::string::appendUInt64(_buf, _capacity, curLen, v);
+        commitAscii(curLen);
         return *this;
     }
 
-    /// 스트림 스타일로 실수를 결합합니다.
+    /// 스트림 스타일로 실수를 결합합니다. (최단 왕복 표기)
     StringBase& StringBase::operator<<(float v) {
-        appendFloat(v);
+        appendShortest(v);
         return *this;
     }
 
-    /// 스트림 스타일로 double 실수를 결합합니다.
+    /// 스트림 스타일로 double 실수를 결합합니다. (최단 왕복 표기)
     StringBase& StringBase::operator<<(double v) {
-        appendFloat((float)v);
+        appendShortest(v);
         return *this;
     }
 
@@ -414,7 +538,13 @@ namespace cms {
     /// @param src 삽입할 문자열 포인터
     void StringBase::insert(size_t charIdx, const char* src) {
         if (!src || *src == '\0') return;
-        _len = cms::string::insert(_buf, _capacity, _len, charIdx, src);
+        const size_t byteOffset = byteOffsetOf(charIdx);
+        const size_t srcLen = strlen(src);
+        const uint16_t before = _len;
+        _len = static_cast<uint16_t>(cms::string::insertBytes(_buf, _capacity, _len, byteOffset, src, srcLen));
+        if (_charCount != CHAR_COUNT_UNKNOWN) {
+            _charCount = static_cast<uint16_t>(_charCount + cms::string::utf8_strlen(src, _len - before));
+        }
         updatePeak();
         // 삽입 후 버퍼가 가득 찼다면 끝부분의 UTF-8 문자가 잘렸을 가능성이 있으므로 정제 수행
         if (_len >= _capacity - 1) sanitize();
@@ -432,7 +562,19 @@ namespace cms {
     /// @param charCount 삭제할 글자 수
     void StringBase::remove(size_t charIdx, size_t charCount) {
         if (charCount == 0) return;
-        _len = cms::string::remove(_buf, _len, charIdx, charCount);
+        const size_t startByte = byteOffsetOf(charIdx);
+        if (startByte >= _len) return;
+
+        size_t endByte;
+        if (charsAreBytes()) {
+            endByte = (charCount < _len - startByte) ? startByte + charCount : _len;
+        } else {
+            endByte = startByte + cms::string::utf8ByteOffset(_buf + startByte, _len - startByte, charCount);
+        }
+        if (_charCount != CHAR_COUNT_UNKNOWN) {
+            _charCount = static_cast<uint16_t>(_charCount - cms::string::utf8_strlen(_buf + startByte, endByte - startByte));
+        }
+        _len = static_cast<uint16_t>(cms::string::removeBytes(_buf, _len, startByte, endByte));
     }
 
     /// 문자열을 정수로 변환합니다.
@@ -481,7 +623,20 @@ namespace cms {
     void StringBase::toLowerCase() { cms::string::toLowerCase(_buf); }
 
     /// 논리적 글자 수를 반환합니다. (UTF-8 인식)
-    size_t StringBase::count() const { return cms::string::utf8_strlen(_buf); }
+    ///
+    /// How: 캐시가 유효하면 O(1)로 반환하고, 그렇지 않으면 한 번 센 뒤 캐시에 보관합니다.
+    size_t StringBase::count() const {
+        if (_charCount == CHAR_COUNT_UNKNOWN) {
+            _charCount = static_cast<uint16_t>(cms::string::utf8_strlen(_buf, _len));
+        }
+        return _charCount;
+    }
+
+    /// 글자 인덱스를 바이트 오프셋으로 변환합니다.
+    size_t StringBase::byteOffsetOf(size_t charIdx) const {
+        if (charsAreBytes()) return (charIdx < _len) ? charIdx : _len;
+        return cms::string::utf8ByteOffset(_buf, _len, charIdx);
+    }
 
     /// 지정된 글자 범위를 추출하여 대상 객체에 저장합니다.
     ///
@@ -490,9 +645,19 @@ namespace cms {
     /// @param left 시작 글자 인덱스
     /// @param right 종료 글자 인덱스
     void StringBase::substring(StringBase& dest, size_t left, size_t right) const {
+        if (!charsAreBytes()) {
+            dest.clear();
+            dest._len = cms::string::substring(_buf, _len, dest._buf, dest._capacity, left, right);
+            dest._charCount = CHAR_COUNT_UNKNOWN;
+            dest.updatePeak();
+            return;
+        }
+
+        // [최적화] ASCII 문자열은 글자 인덱스가 곧 바이트 오프셋이므로 경계 스캔 없이 바로 복사
         dest.clear();
-        dest._len = cms::string::substring(_buf, dest._buf, dest._capacity, left, right);
-        dest.updatePeak();
+        if (left >= _len || (right != 0 && right <= left)) return;
+        const size_t end = (right == 0 || right > _len) ? _len : right;
+        dest.append(_buf + left, end - left);
     }
     /// 물리적 바이트 오프셋 기준으로 부분 문자열을 추출합니다.
     void StringBase::byteSubstring(StringBase& dest, size_t startByte, size_t endByte) const {
@@ -507,13 +672,14 @@ namespace cms {
     }
 
     /// 유효한 UTF-8 인코딩인지 확인합니다.
-    bool StringBase::isValid() const { return cms::string::validateUtf8(_buf); }
+    bool StringBase::isValid() const { return cms::string::validateUtf8(_buf, _len); }
 
     /// 버퍼 끝에서 잘린 멀티바이트 문자를 정제합니다.
     ///
     /// Why: 통신이나 치환 과정에서 한글 바이트가 잘려 깨진 기호가 출력되는 것을 방지합니다.
     void StringBase::sanitize() {
         _len = cms::string::sanitizeUtf8(_buf, _capacity);
+        _charCount = CHAR_COUNT_UNKNOWN;
         updatePeak();
     }
 
@@ -554,6 +720,7 @@ namespace cms {
         } else {
             _len = 0;
         }
+        _charCount = CHAR_COUNT_UNKNOWN;
     }
 
     /// 외부 문자열과 객체의 비교 연산자입니다.
@@ -11,6 +11,9 @@
 #include <cstring>  // strlen, strcpy 등 표준 함수
 #include <cstdint>  // uint16_t 정의
 #include "cmsStringUtil.h"
+#include "cmsFormat.h" // 컴파일 타임 포맷 (format / appendFormat)
+#include "cmsFixedString.h" // cms::FixedString (컴파일 타임 상수 문자열)
+#include "cmsStringView.h"  // cms::StringView (소유하지 않는 읽기 전용 뷰)
 
 // 컴파일러별 printf 포맷 체크 속성
 #if defined(__GNUC__) || defined(__clang__)
@@ -92,8 +95,17 @@ namespace cms {
         /// How: 첫 바이트에 '\0'을 써서 논리적으로 초기화합니다.
         void clear();
 
+        /// 버퍼를 직접 수정한 뒤 문자열 길이를 다시 지정합니다.
+        ///
+        /// Why: operator[]로 버퍼를 제자리 가공(스타일링 등)한 결과를 객체 상태에 반영하기 위함입니다.
+        /// How: 길이를 용량 - 1로 제한하고 종료 문자('\0')를 기록합니다.
+        ///
+        /// @param len 새 바이트 길이
+        void setLength(size_t len);
+
         /// 특정 인덱스의 문자에 접근합니다.
-        char& operator[](size_t index) { return _buf[index]; }
+        /// @note 쓰기 가능한 참조를 내주므로 캐시된 글자 수를 무효화합니다.
+        char& operator[](size_t index) { _charCount = CHAR_COUNT_UNKNOWN; return _buf[index]; }
         /// 특정 인덱스의 문자에 접근합니다 (읽기 전용).
         const char& operator[](size_t index) const { return _buf[index]; }
 
@@ -110,6 +122,10 @@ namespace cms {
         StringBase& operator=(const StringBase& other);
         /// Token 객체의 내용을 대입합니다.
         StringBase& operator=(const cms::string::Token& token);
+        /// 뷰의 내용을 대입합니다. (자기 자신의 일부를 가리키는 뷰도 안전)
+        StringBase& operator=(StringView src);
+        /// 뷰의 내용을 뒤에 결합합니다.
+        StringBase& operator+=(StringView src) { append(src.data(), src.length()); return *this; }
         /// 문자열을 뒤에 결합합니다.
         StringBase& operator+=(const char* src);
         /// 단일 문자를 뒤에 결합합니다.
@@ -131,6 +147,13 @@ namespace cms {
         void append(const char* s, size_t len);
         /// Token 객체의 데이터를 덧붙입니다.
         void append(const cms::string::Token& token);
+        /// 뷰의 데이터를 덧붙입니다.
+        void append(StringView src) { append(src.data(), src.length()); }
+
+        /// [view] 현재 내용 전체를 가리키는 뷰 (복사 없음, 이후 수정하면 무효)
+        StringView view() const noexcept { return StringView(_buf, _len); }
+        /// [view] 글자 단위 [left, right) 구간의 뷰 (substring과 같은 규칙, 복사 없음)
+        StringView view(size_t left, size_t right = 0) const { return view().substring(left, right); }
 
         /// 문자열 양 끝의 공백 및 제어 문자를 제거합니다.
         ///
@@ -153,6 +176,9 @@ namespace cms {
             if (M - 1 > _len) return false;
             return cms::string::startsWith(_buf, prefix, M - 1, ignoreCase);
         }
+        /// 뷰/객체 접두사 확인 (길이를 알고 있어 strlen 없음)
+        bool startsWith(StringView prefix, bool ignoreCase = false) const { return view().startsWith(prefix, ignoreCase); }
+        bool startsWith(const StringBase& prefix, bool ignoreCase = false) const { return startsWith(prefix.view(), ignoreCase); }
 
         /// 특정 문자열이 시작되는 논리적 글자 위치를 찾습니다.
         ///
@@ -165,6 +191,13 @@ namespace cms {
         ///
         /// @return 0부터 시작하는 글자 단위 인덱스 (찾지 못하면 -1)
         int find(const char* target, size_t startChar = 0, bool ignoreCase = false) const;
+        /// 뷰/객체 검색 (길이를 알고 있어 strlen 없음)
+        int find(StringView target, size_t startChar = 0, bool ignoreCase = false) const {
+            return findImpl(target.data(), target.length(), startChar, ignoreCase);
+        }
+        int find(const StringBase& target, size_t startChar = 0, bool ignoreCase = false) const {
+            return findImpl(target._buf, target._len, startChar, ignoreCase);
+        }
 
         /// 특정 문자가 처음 나타나는 논리적 위치를 찾습니다.
         int indexOf(char c, size_t startChar = 0, bool ignoreCase = false) const;
@@ -173,15 +206,23 @@ namespace cms {
         /// 문자열 리터럴 전용 indexOf (최적화)
         template<size_t M>
         int indexOf(const char (&str)[M], size_t startChar = 0, bool ignoreCase = false) const {
-            return cms::string::find(_buf, _len, str, M - 1, startChar, ignoreCase);
+            return findImpl(str, M - 1, startChar, ignoreCase);
         }
+        int indexOf(StringView str, size_t startChar = 0, bool ignoreCase = false) const { return find(str, startChar, ignoreCase); }
+        int indexOf(const StringBase& str, size_t startChar = 0, bool ignoreCase = false) const { return find(str, startChar, ignoreCase); }
 
         /// 특정 문자열이 마지막으로 나타나는 위치를 찾습니다.
         int lastIndexOf(const char* target, bool ignoreCase = false) const;
         /// 문자열 리터럴 전용 lastIndexOf (최적화)
         template<size_t M>
         int lastIndexOf(const char (&target)[M], bool ignoreCase = false) const {
-            return cms::string::lastIndexOf(_buf, _len, target, M - 1, ignoreCase);
+            return lastIndexOfImpl(target, M - 1, ignoreCase);
+        }
+        int lastIndexOf(StringView target, bool ignoreCase = false) const {
+            return lastIndexOfImpl(target.data(), target.length(), ignoreCase);
+        }
+        int lastIndexOf(const StringBase& target, bool ignoreCase = false) const {
+            return lastIndexOfImpl(target._buf, target._len, ignoreCase);
         }
         /// 특정 문자가 마지막으로 나타나는 위치를 찾습니다.
         int lastIndexOf(char c, bool ignoreCase = false) const;
@@ -193,10 +234,30 @@ namespace cms {
         bool contains(const char (&target)[M], bool ignoreCase = false) const {
             return cms::string::contains(_buf, _len, target, M - 1, ignoreCase);
         }
+        bool contains(StringView target, bool ignoreCase = false) const {
+            return cms::string::contains(_buf, _len, target.data(), target.length(), ignoreCase);
+        }
+        bool contains(const StringBase& target, bool ignoreCase = false) const { return contains(target.view(), ignoreCase); }
 
-        /// POSIX 정규표현식 패턴과 일치하는지 검사합니다.
+        /// 정규표현식 패턴과 일치하는지 검사합니다. (호출마다 패턴을 컴파일)
         bool matches(const char* pattern) const;
 
+        /// 미리 컴파일된 정규표현식과 일치하는지 검사합니다.
+        ///
+        /// Why: 입력 명령 검증처럼 같은 패턴을 반복 사용할 때 컴파일 비용을 한 번만 치르기 위함입니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// static const cms::Regex<> topic("^sensor/[^/]+/temp$");
+        /// if (s.matches(topic)) { ... }
+        /// @endcode
+        ///
+        /// @note cmsRegex.h를 포함해야 합니다.
+        template<size_t MAX_INST, size_t MAX_CLASSES>
+        bool matches(const cms::Regex<MAX_INST, MAX_CLASSES>& regex) const {
+            return regex.matches(_buf, _len);
+        }
+
         /// 문자열이 특정 접미사로 끝나는지 확인합니다.
         bool endsWith(const char* suffix, bool ignoreCase = false) const;
 
@@ -207,13 +268,31 @@ namespace cms {
             if (M - 1 > _len) return false;
             return cms::string::endsWith(_buf, _len, suffix, M - 1, ignoreCase);
         }
+        bool endsWith(StringView suffix, bool ignoreCase = false) const { return view().endsWith(suffix, ignoreCase); }
+        bool endsWith(const StringBase& suffix, bool ignoreCase = false) const { return endsWith(suffix.view(), ignoreCase); }
 
         /// 문자열 내의 특정 패턴을 찾아 다른 문자열로 모두 치환합니다.
         ///
         /// Why: 텍스트 가공 및 템플릿 치환 기능을 제공하기 위함입니다.
-        /// How: 치환 후 길이가 변할 경우 데이터를 재배치하며 버퍼 크기를 초과하면 중단됩니다.
+        /// How: 일치 개수로 최종 길이를 먼저 계산한 뒤 한 번의 패스로 재작성하며, 버퍼 크기를 초과하는 치환은 앞쪽부터 들어가는 만큼만 수행합니다.
         void replace(const char* from, const char* to, bool ignoreCase = false);
 
+        /// 치환 결과를 다른 객체에 작성합니다. (원본 유지)
+        ///
+        /// Why: 템플릿 문자열(예: MQTT 토픽 "dev/{id}/state")을 보존한 채 메시지마다 치환 결과만 만들기 위함입니다.
+        /// How: 일치 사이 구간과 치환 문자열을 대상 버퍼에 차례로 복사하므로 제자리 데이터 이동이 없습니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// topicTemplate.replaceInto(topic, "{id}", deviceId);
+        /// @endcode
+        ///
+        /// @param dest 결과를 담을 객체 (대상이 부족하면 UTF-8 글자 경계에서 잘림)
+        /// @param from 찾을 패턴
+        /// @param to 바꿀 내용
+        /// @param ignoreCase 대소문자 무시 여부
+        void replaceInto(StringBase& dest, const char* from, const char* to, bool ignoreCase = false) const;
+
         /// 정수 값을 문자열로 변환하여 기존 내용 뒤에 덧붙입니다.
         ///
         /// Why: printf 계열보다 가볍고 빠른 전용 직렬화 로직을 사용하기 위함입니다.
@@ -222,8 +301,18 @@ namespace cms {
         /// @param width 최소 출력 너비 (단위: chars)
         /// @param padChar 채움 문자 (예: '0', ' ')
         void appendInt(long val, int width = 0, char padChar = ' ');
-        /// 실수 값을 문자열로 변환하여 기존 내용 뒤에 덧붙입니다.
+        /// 부호 없는 정수 값을 문자열로 변환하여 기존 내용 뒤에 덧붙입니다.
+        void appendUInt(unsigned long val, int width = 0, char padChar = ' ');
+        /// 부호 없는 정수 값을 16진수 문자열로 변환하여 기존 내용 뒤에 덧붙입니다. (예: appendHex(reg, 8) → "0000BEEF")
+        void appendHex(unsigned long val, int width = 0, char padChar = '0', bool uppercase = true);
+        /// 실수 값을 고정 소수점 자리수로 변환하여 기존 내용 뒤에 덧붙입니다.
         void appendFloat(float val, int decimalPlaces = 2);
+        /// 실수 값을 다시 읽으면 같은 값이 되는 가장 짧은 표기로 덧붙입니다. (예: 23.1f → "23.1", 1e-7f → "1e-07")
+        ///
+        /// Why: 고정 자릿수로 인한 정보 손실(0.001 → "0.00")과 불필요한 0 없이 센서 값을 그대로 전달하기 위함입니다.
+        /// How: float는 float 정밀도 기준으로 자릿수를 구하므로 double 승격 오차 자릿수가 출력되지 않습니다.
+        void appendShortest(float val);
+        void appendShortest(double val);
 
         /// 기존 내용을 모두 지우고 정수 값을 문자열로 설정합니다.
         void fromInt(long val);
@@ -245,6 +334,53 @@ namespace cms {
         /// @return 추가된 문자열의 바이트 길이
         int appendPrintf(const char* format, ...) CMS_PRINTF_CHECK(2, 3);
 
+        /// packPrintfArgs로 직렬화된 인자를 사용하여 포맷팅된 문자열을 기존 내용 뒤에 추가합니다.
+        ///
+        /// Why: 지연 포맷팅 로그처럼 인자를 미리 바이트로 보관해 둔 경우, 나중에 같은 엔진으로 출력하기 위함입니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// s.appendPacked(format, packed, packedLen);
+        /// @endcode
+        ///
+        /// @param format 직렬화에 사용한 포맷 문자열
+        /// @param packed 직렬화된 인자 바이트
+        /// @param packedLen 직렬화된 인자 바이트 수
+        ///
+        /// @return 포맷팅 후 최종 문자열의 전체 바이트 길이
+        int appendPacked(const char* format, const uint8_t* packed, size_t packedLen);
+
+        /// 컴파일 타임에 해석된 포맷으로 기존 내용 뒤에 추가합니다.
+        ///
+        /// Why: 고빈도 경로에서 포맷 해석과 va_list 비용을 없애고, 지정자와 맞지 않는 인자를 빌드 단계에서 잡기 위함입니다.
+        /// How: cms::string::format이 지정자별 직렬화 호출을 펼쳐서 생성합니다. (지정자 규칙은 appendPrintf와 동일)
+        ///
+        /// 사용 예:
+        /// @code
+        /// static constexpr char kFmt[] = ",\"t\":%.1f";
+        /// s.appendFormat<kFmt>(temp);
+        /// CMS_APPEND_FORMAT(s, ",\"h\":%d", hum);   // 리터럴 포맷용 매크로
+        /// @endcode
+        ///
+        /// @tparam FMT 정적 constexpr char 배열로 된 포맷 문자열
+        ///
+        /// @return 포맷팅 후 최종 문자열의 전체 바이트 길이
+        template<const char* FMT, typename... Args>
+        int appendFormat(const Args&... args) {
+            const size_t before = _len;
+            size_t curLen = _len;
+            cms::string::format<FMT>(_buf, _capacity, curLen, args...);
+            commitAppend(before, curLen);
+            return static_cast<int>(_len);
+        }
+
+        /// 컴파일 타임에 해석된 포맷으로 버퍼에 씁니다. (기존 내용 삭제)
+        template<const char* FMT, typename... Args>
+        int format(const Args&... args) {
+            clear();
+            return appendFormat<FMT>(args...);
+        }
+
         /// 가변 인자 리스트를 사용하여 포맷팅된 문자열을 버퍼에 씁니다. (기존 내용 삭제)
         /// @param format printf 스타일 포맷 문자열
         /// @param args 가변 인자 리스트
@@ -280,17 +416,41 @@ namespace cms {
             return *this;
         }
 
+        /// 컴파일 타임 고정 문자열 결합 연산자입니다.
+        /// Why: 길이가 타입에 들어 있어 strlen 없이 상수 길이 복사 한 번으로 끝납니다.
+        template<size_t M>
+        StringBase& operator<<(const FixedString<M>& s) {
+            append(s.c_str(), M - 1);
+            return *this;
+        }
+
+        /// 컴파일 타임 고정 문자열 결합 연산자입니다.
+        template<size_t M>
+        StringBase& operator+=(const FixedString<M>& s) {
+            append(s.c_str(), M - 1);
+            return *this;
+        }
+
+        /// 스트림 스타일로 뷰를 결합합니다.
+        StringBase& operator<<(StringView s) { append(s.data(), s.length()); return *this; }
+
         /// 스트림 스타일로 문자를 결합합니다.
         StringBase& operator<<(char c);
         /// 스트림 스타일로 정수를 결합합니다.
         StringBase& operator<<(int v);
         /// 스트림 스타일로 long 정수를 결합합니다.
         StringBase& operator<<(long v);
+        /// 스트림 스타일로 unsigned int 정수를 결합합니다.
+        StringBase& operator<<(unsigned int v);
         /// 스트림 스타일로 unsigned long 정수를 결합합니다.
         StringBase& operator<<(unsigned long v);
-        /// 스트림 스타일로 실수를 결합합니다.
+        /// 스트림 스타일로 64비트 정수를 결합합니다.
+        StringBase& operator<<(long long v);
+        /// 스트림 스타일로 64비트 부호 없는 정수를 결합합니다.
+        StringBase& operator<<(unsigned long long v);
+        /// 스트림 스타일로 실수를 결합합니다. (최단 왕복 표기, 고정 자리수는 appendFloat 사용)
         StringBase& operator<<(float v);
-        /// 스트림 스타일로 double 실수를 결합합니다.
+        /// 스트림 스타일로 double 실수를 결합합니다. (최단 왕복 표기)
         StringBase& operator<<(double v);
         /// 스트림 스타일로 다른 객체의 내용을 결합합니다.
         StringBase& operator<<(const StringBase& other);
@@ -337,6 +497,25 @@ namespace cms {
         /// @return true: 숫자 형식임, false: 아님
         bool isNumeric() const;
 
+        /// 문자열 전체를 검증하며 숫자로 변환합니다. (앞뒤 공백 허용)
+        ///
+        /// Why: toInt/toFloat는 실패와 0을 구분할 수 없고 범위 초과를 감지하지 못하므로,
+        ///      설정값이나 명령 인자처럼 잘못된 입력을 거부해야 하는 경로를 위해 존재합니다.
+        ///
+        /// 사용 예:
+        /// @code
+        /// uint16_t port;
+        /// if (!arg.parse(port)) { logger.error("bad port"); }
+        /// @endcode
+        ///
+        /// @param out [OUT] 변환 결과 (실패 시 변경되지 않음)
+        /// @param base 정수 진법 (2~36, 실수에서는 무시)
+        /// @return 결과 코드와 소비 위치 (cms::string::parse 참고)
+        template<typename T>
+        cms::string::ParseResult parse(T& out, int base = 10) const {
+            return cms::string::parse(cms::string::Token{_buf, _len}, out, base);
+        }
+
         /// 구분자를 기준으로 문자열을 여러 토큰으로 분리합니다.
         ///
         /// Why: 프로토콜 패킷이나 CSV 데이터를 파싱하기 위함입니다.
@@ -351,6 +530,20 @@ namespace cms {
 
         /// 원본을 보존하며 문자열을 분리합니다. (비파괴적)
         size_t split(char delimiter, cms::string::Token* tokens, size_t maxTokens) const;
+        /// 비파괴 분할: 결과를 원본을 가리키는 뷰로 받습니다. (복사 없음)
+        size_t split(char delimiter, StringView* out, size_t maxTokens) const { return view().split(delimiter, out, maxTokens); }
+
+        /// 출력 배열 없이 토큰을 하나씩 꺼내는 분할기를 만듭니다. (비파괴적, 여러 구분 문자 지원)
+        ///
+        /// 사용 예:
+        /// @code
+        /// for (auto field : line.tokenize(",;", '"')) { ... }
+        /// @endcode
+        ///
+        /// @note 분할기는 내부 버퍼를 가리키므로 순회 중에는 문자열을 수정하지 마십시오.
+        cms::string::Tokenizer tokenize(const char* delimiters, char quote = '\0', char escape = '\0') const noexcept {
+            return cms::string::Tokenizer(_buf, _len, delimiters, quote, escape);
+        }
 
         /// 모든 영문을 대문자로 변환합니다.
         void toUpperCase();
@@ -358,6 +551,12 @@ namespace cms {
         void toLowerCase();
 
         /// 문자열의 논리적 글자 수를 반환합니다.
+        ///
+        /// Why: 글자 인덱스 API(find, insert, substring 등)가 매번 버퍼 전체를 다시 세지 않도록 하기 위함입니다.
+        /// How: 한 번 센 값을 _charCount에 보관하고 append/printf 계열에서 추가분만 더해 갱신합니다.
+        ///
+        /// @note 캐시는 const 호출에서도 기록되므로(mutable), 같은 객체를 여러 스레드에서 동시에 읽으려면 외부 동기화가 필요합니다.
+        ///
         /// @return 논리적 글자 수 (UTF-8 인식)
         size_t count() const;
 
@@ -393,6 +592,22 @@ namespace cms {
         bool equals(const char (&other)[M], bool ignoreCase = false) const {
             return cms::string::equals(_buf, _len, other, M - 1, ignoreCase);
         }
+        bool equals(StringView other, bool ignoreCase = false) const {
+            return cms::string::equals(_buf, _len, other.data(), other.length(), ignoreCase);
+        }
+        bool equals(const StringBase& other, bool ignoreCase = false) const { return equals(other.view(), ignoreCase); }
+
+        /// 문자열 내용의 DJB2 해시를 계산합니다. (O(길이), 명령어 분기용)
+        ///
+        /// 사용 예:
+        /// @code
+        /// using namespace cms::string::literals;
+        /// switch (cmd.hash(true)) { case "REBOOT"_ihash: ...; }
+        /// @endcode
+        ///
+        /// @note operator[]로 제자리 수정이 가능한 버퍼라 값을 보관하지 않고 매번 계산합니다.
+        ///       같은 문자열을 반복 비교한다면 cms::StringTable에 등록해 ID로 비교하십시오.
+        uint32_t hash(bool ignoreCase = false) const noexcept { return cms::string::djb2(_buf, _len, ignoreCase); }
 
         /// 문자열 비교 연산자입니다.
         bool operator==(const char* other) const {
@@ -410,6 +625,9 @@ namespace cms {
         bool operator!=(const char (&other)[M]) const {
             return !equals(other, false);
         }
+        /// 뷰 비교 연산자입니다.
+        bool operator==(StringView other) const { return equals(other); }
+        bool operator!=(StringView other) const { return !equals(other); }
         /// 객체 간 비교 연산자입니다.
         bool operator==(const StringBase& other) const {
             return cms::string::equals(_buf, _len, other._buf, other._len, false);
@@ -441,10 +659,14 @@ namespace cms {
         /// 문자열 비교 함수
         int compare(const char* other) const;
         int compare(const StringBase& other) const;
+        int compare(StringView other) const { return cms::string::compare(_buf, _len, other.data(), other.length()); }
 
         /// 대소문자를 무시한 문자열 비교 함수
         int compareIgnoreCase(const char* other) const;
         int compareIgnoreCase(const StringBase& other) const;
+        int compareIgnoreCase(StringView other) const {
+            return cms::string::compareIgnoreCase(_buf, _len, other.data(), other.length());
+        }
         template<size_t M>
         int compareIgnoreCase(const char (&other)[M]) const {
             return cms::string::compareIgnoreCase(_buf, _len, other, M - 1);
@@ -472,17 +694,51 @@ namespace cms {
         const uint16_t _capacity; // size_t 대신 uint16_t 사용 시 RAM 절약 가능
         /// 현재 버퍼에 저장된 문자열의 바이트 길이 (널 종료 문자 제외).
         uint16_t _len;
+        /// 캐시된 논리적 글자 수 (CHAR_COUNT_UNKNOWN이면 다음 count() 호출 때 다시 셉니다).
+        mutable uint16_t _charCount;
 #ifdef CMS_ENABLE_PROFILING
         /// 객체 생성 이후 도달했던 최대 바이트 길이 (프로파일링용).
         uint16_t _maxLenSeen;
 #endif
 
+        /// 글자 수를 아직 모른다는 표시 (_len은 최대 65534이므로 실제 글자 수와 겹치지 않음).
+        static constexpr uint16_t CHAR_COUNT_UNKNOWN = 0xFFFF;
+
         /// 내부 생성자입니다. 자식 클래스에서 버퍼 정보를 주입받습니다.
         StringBase(char* b, size_t c);
         /// 길이를 명시적으로 지정하는 내부 생성자입니다. (최적화)
         StringBase(char* b, size_t c, size_t l);
         /// 현재 버퍼의 실제 문자열 길이를 측정하여 _len과 최대 사용량을 동기화합니다.
         void updateLength();
+        /// 모든 바이트가 1바이트 글자(ASCII)라서 글자 인덱스와 바이트 오프셋이 같은지 확인합니다.
+        bool charsAreBytes() const noexcept {
+            if (_charCount == CHAR_COUNT_UNKNOWN) count();
+            return _charCount == _len;
+        }
+        /// 글자 인덱스를 바이트 오프셋으로 변환합니다. (ASCII 문자열은 O(1), 범위 초과 시 _len)
+        size_t byteOffsetOf(size_t charIdx) const;
+        /// 바이트 [from, _len) 구간으로 늘어난 글자 수를 캐시에 더합니다.
+        void addCharCount(size_t from) {
+            if (_charCount != CHAR_COUNT_UNKNOWN) {
+                _charCount = static_cast<uint16_t>(_charCount + cms::string::utf8_strlen(_buf + from, _len - from));
+            }
+        }
+        /// ASCII만 덧붙인 뒤(숫자 직렬화 등) 길이와 글자 수 캐시를 함께 갱신합니다.
+        void commitAscii(size_t curLen) {
+            if (_charCount != CHAR_COUNT_UNKNOWN) _charCount = static_cast<uint16_t>(_charCount + (curLen - _len));
+            _len = static_cast<uint16_t>(curLen);
+            updatePeak();
+        }
+        /// 임의의 내용을 덧붙인 뒤 길이와 글자 수 캐시를 갱신합니다. (before: 덧붙이기 전 길이)
+        void commitAppend(size_t before, size_t curLen) {
+            _len = static_cast<uint16_t>(curLen);
+            addCharCount(before);
+            updatePeak();
+        }
+        /// 길이 기반 find/indexOf 공통 구현입니다.
+        int findImpl(const char* target, size_t targetLen, size_t startChar, bool ignoreCase) const;
+        /// 길이 기반 lastIndexOf 공통 구현입니다.
+        int lastIndexOfImpl(const char* target, size_t targetLen, bool ignoreCase) const;
         /// 최대 사용량 지표를 갱신합니다.
         inline void updatePeak() {
 #ifdef CMS_ENABLE_PROFILING
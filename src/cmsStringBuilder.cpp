@@ -0,0 +1,195 @@
+/// @author comser.dev
+/// @brief ChunkPoolBase / StringBuilder 비-템플릿 구현부입니다. (자유 목록 관리와 조각 단위 이어 쓰기)
+/// 이 파일은 독립적으로 컴파일되어 풀 크기별 코드 비대화를 방지합니다.
+
+#include <cstring>
+#include "cmsStringBuilder.h"
+
+namespace cms {
+
+    ChunkPoolBase::ChunkPoolBase(StringBase** chunks, uint16_t* next, size_t count) noexcept
+        : _chunks(chunks), _next(next), _count(static_cast<uint16_t>(count)), _freeHead(0), _freeCount(static_cast<uint16_t>(count)) {
+        // 모든 조각을 번호 순서대로 자유 목록에 연결
+        for (size_t i = 0; i < count; ++i) _next[i] = static_cast<uint16_t>(i + 1);
+        _next[count - 1] = NO_CHUNK;
+    }
+
+    /// [acquire] 자유 목록의 머리 조각을 떼어 비운 뒤 반환
+    uint16_t ChunkPoolBase::acquire() noexcept {
+        const uint16_t index = _freeHead;
+        if (index == NO_CHUNK) return NO_CHUNK;
+        _freeHead = _next[index];
+        _next[index] = NO_CHUNK;
+        _freeCount--;
+        _chunks[index]->clear();
+        return index;
+    }
+
+    /// [releaseChain] 목록 끝까지 센 뒤 자유 목록 앞에 통째로 이어 붙임 (O(조각 수))
+    void ChunkPoolBase::releaseChain(uint16_t head) noexcept {
+        if (head == NO_CHUNK) return;
+        uint16_t last = head;
+        uint16_t released = 1;
+        while (_next[last] != NO_CHUNK) {
+            last = _next[last];
+            released++;
+        }
+        _next[last] = _freeHead;
+        _freeHead = head;
+        _freeCount = static_cast<uint16_t>(_freeCount + released);
+    }
+
+    void StringBuilder::clear() noexcept {
+        _pool.releaseChain(_head);
+        _head = ChunkPoolBase::NO_CHUNK;
+        _tail = ChunkPoolBase::NO_CHUNK;
+        _length = 0;
+        _segments = 0;
+        _overflowed = false;
+    }
+
+    bool StringBuilder::grow() noexcept {
+        const uint16_t index = _pool.acquire();
+        if (index == ChunkPoolBase::NO_CHUNK) {
+            _overflowed = true;
+            return false;
+        }
+        if (_head == ChunkPoolBase::NO_CHUNK) _head = index;
+        else _pool.link(_tail, index);
+        _tail = index;
+        _segments++;
+        return true;
+    }
+
+    /// [append] 꼬리 조각의 남은 공간부터 채우고 넘치는 부분은 새 조각으로 이어 씀
+    bool StringBuilder::append(const char* s, size_t len) noexcept {
+        if (!s) return true;
+        while (len > 0) {
+            if (_tail == ChunkPoolBase::NO_CHUNK || _pool.chunk(_tail).length() + 1 >= _pool.chunk(_tail).capacity()) {
+                if (!grow()) return false;
+            }
+            StringBase& c = _pool.chunk(_tail);
+            const size_t space = c.capacity() - 1 - c.length();
+            const size_t n = (len < space) ? len : space;
+            c.append(s, n);
+            s += n;
+            len -= n;
+            _length += n;
+        }
+        return true;
+    }
+
+    int StringBuilder::appendPrintf(const char* format, ...) {
+        va_list args;
+        va_start(args, format);
+        int ret = appendPrintf(format, args);
+        va_end(args);
+        return ret;
+    }
+
+    /// [appendPrintf] 예비 조각에 먼저 포맷하여 조각 경계에서 결과가 잘리지 않도록 함
+    ///
+    /// 1) 풀에서 빈 조각을 빌려 조각 전체 용량으로 포맷하고,
+    /// 2) 결과가 꼬리 조각의 남은 공간에 들어가면 옮겨 담은 뒤 예비 조각을 돌려주고,
+    /// 3) 들어가지 않으면 예비 조각을 그대로 새 꼬리로 연결합니다. (복사 없음)
+    /// 예비 조각을 가득 채운 결과나 예비 조각을 빌리지 못한 경우는 잘렸을 수 있으므로 overflowed를 표시합니다.
+    int StringBuilder::appendPrintf(const char* format, va_list args) {
+        if (!format) return static_cast<int>(_length);
+
+        const uint16_t spare = _pool.acquire();
+        if (spare == ChunkPoolBase::NO_CHUNK) {
+            _overflowed = true;
+            if (_tail != ChunkPoolBase::NO_CHUNK) { // 남은 공간에 최선을 다해 기록
+                StringBase& c = _pool.chunk(_tail);
+                const size_t before = c.length();
+                c.appendPrintf(format, args);
+                _length += c.length() - before;
+            }
+            return static_cast<int>(_length);
+        }
+
+        StringBase& out = _pool.chunk(spare);
+        out.appendPrintf(format, args);
+        const size_t n = out.length();
+        if (n + 1 >= out.capacity()) _overflowed = true;
+
+        if (_tail != ChunkPoolBase::NO_CHUNK && _pool.chunk(_tail).length() + n + 1 <= _pool.chunk(_tail).capacity()) {
+            _pool.chunk(_tail).append(out.c_str(), n);
+            _pool.releaseChain(spare);
+        } else if (n == 0) {
+            _pool.releaseChain(spare);
+        } else {
+            if (_head == ChunkPoolBase::NO_CHUNK) _head = spare;
+            else _pool.link(_tail, spare);
+            _tail = spare;
+            _segments++;
+        }
+        _length += n;
+        return static_cast<int>(_length);
+    }
+
+    StringBuilder& StringBuilder::operator<<(long long v) {
+        char digits[24];
+        size_t n = 0;
+        cms::string::appendInt64(digits, sizeof(digits), n, v);
+        append(digits, n);
+        return *this;
+    }
+
+    StringBuilder& StringBuilder::operator<<(unsigned long long v) {
+        char digits[24];
+        size_t n = 0;
+        cms::string::appendUInt64(digits, sizeof(digits), n, v);
+        append(digits, n);
+        return *this;
+    }
+
+    StringBuilder& StringBuilder::operator<<(float v) {
+        char digits[32];
+        size_t n = 0;
+        cms::string::appendShortest(digits, sizeof(digits), n, v);
+        append(digits, n);
+        return *this;
+    }
+
+    StringBuilder& StringBuilder::operator<<(double v) {
+        char digits[32];
+        size_t n = 0;
+        cms::string::appendShortest(digits, sizeof(digits), n, v);
+        append(digits, n);
+        return *this;
+    }
+
+    size_t StringBuilder::exportSegments(cms::string::Token* out, size_t maxSegments) const noexcept {
+        if (!out) return 0;
+        size_t count = 0;
+        for (uint16_t i = _head; i != ChunkPoolBase::NO_CHUNK && count < maxSegments; i = _pool.next(i)) {
+            const StringBase& c = _pool.chunk(i);
+            if (c.length() == 0) continue;
+            out[count].ptr = c.c_str();
+            out[count].len = c.length();
+            count++;
+        }
+        return count;
+    }
+
+    /// [copyTo] 앞쪽 조각은 길이만 보고 건너뛴 뒤 필요한 구간만 복사
+    size_t StringBuilder::copyTo(char* dest, size_t maxLen, size_t offset) const noexcept {
+        if (!dest || maxLen == 0) return 0;
+        size_t copied = 0;
+        for (uint16_t i = _head; i != ChunkPoolBase::NO_CHUNK && copied < maxLen; i = _pool.next(i)) {
+            const StringBase& c = _pool.chunk(i);
+            if (offset >= c.length()) {
+                offset -= c.length();
+                continue;
+            }
+            size_t n = c.length() - offset;
+            if (n > maxLen - copied) n = maxLen - copied;
+            memcpy(dest + copied, c.c_str() + offset, n);
+            copied += n;
+            offset = 0;
+        }
+        return copied;
+    }
+
+} // namespace cms
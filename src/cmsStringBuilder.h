@@ -0,0 +1,215 @@
+/// @author comser.dev
+///
+/// String<N>의 MAX_SAFE_SIZE(1024바이트)를 넘는 응답(HTTP/JSON 등)을 힙과 큰 스택 배열 없이 조립하기 위한
+/// 조각(Chunk) 연결형 문자열 빌더입니다. 정적 풀에서 고정 크기 조각을 빌려 이어 쓰고,
+/// 출력 시에는 조각을 하나로 합치지 않고 순서대로 넘기는 분산-수집(Scatter-Gather) 방식을 사용합니다.
+
+#pragma once // 중복 포함 방지
+
+#include <stddef.h> // size_t 정의
+#include <stdint.h> // uint16_t 정의
+#include <stdarg.h> // va_list 정의
+#include <cstring>  // strlen
+#include "cmsString.h"
+
+namespace cms {
+
+// ==================================================================================================
+// [StringBuilder] 개요
+// - 왜 존재하는가: 4~16KB 응답을 String<N> 하나로 만들면 스택 한계를 넘고, 한 버퍼로 합치면 같은 크기의 RAM이
+//   한 번 더 필요하므로, 작은 조각을 이어 붙이고 조각 단위로 바로 전송하기 위해 존재합니다.
+// - 어떻게 동작하는가: ChunkPool은 String<CHUNK_BYTES> 배열과 다음 조각 번호 배열을 정적으로 소유하며,
+//   빈 조각은 같은 번호 배열로 연결한 자유 목록(Free List)에 보관합니다. StringBuilder는 머리/꼬리 조각 번호만 들고
+//   꼬리 조각이 차면 풀에서 새 조각을 빌려 이어 쓰고, 소멸(clear) 시 모든 조각을 풀에 돌려줍니다.
+// ==================================================================================================
+
+/// 조각 풀의 공통 로직(자유 목록 관리)을 담당하는 베이스 클래스입니다.
+///
+/// Why: 조각 크기/개수별로 할당·반환 코드가 중복 생성되지 않도록 비-템플릿으로 분리하기 위함입니다. (Thin Template)
+/// How: 외부에서 주입된 조각 포인터 표와 다음 조각 번호 배열을 사용합니다.
+///
+/// @note 할당/반환은 스레드 안전하지 않습니다. 태스크마다 별도의 풀을 두거나 풀을 쓰는 빌더를 한 태스크에서만 사용하십시오.
+class ChunkPoolBase {
+public:
+    /// 조각이 없음을 나타내는 번호 (목록 끝 표시 겸용)
+    static constexpr uint16_t NO_CHUNK = 0xFFFF;
+
+    /// 빈 조각 하나를 빌립니다. (내용은 비워진 상태)
+    ///
+    /// @return 조각 번호 (풀이 비었으면 NO_CHUNK)
+    uint16_t acquire() noexcept;
+
+    /// 조각 번호부터 next로 이어진 목록 전체를 풀에 돌려줍니다.
+    void releaseChain(uint16_t head) noexcept;
+
+    /// 조각 번호에 해당하는 문자열 객체를 반환합니다.
+    StringBase& chunk(uint16_t index) noexcept { return *_chunks[index]; }
+    const StringBase& chunk(uint16_t index) const noexcept { return *_chunks[index]; }
+
+    /// 목록에서 다음 조각 번호를 반환합니다. (마지막이면 NO_CHUNK)
+    uint16_t next(uint16_t index) const noexcept { return _next[index]; }
+    /// 목록에서 다음 조각을 연결합니다.
+    void link(uint16_t index, uint16_t nextIndex) noexcept { _next[index] = nextIndex; }
+
+    /// 남은 빈 조각 수를 반환합니다.
+    [[nodiscard]] size_t available() const noexcept { return _freeCount; }
+    /// 전체 조각 수를 반환합니다.
+    [[nodiscard]] size_t chunkCount() const noexcept { return _count; }
+    /// 조각 하나에 담을 수 있는 최대 바이트 수를 반환합니다. (NUL 제외)
+    [[nodiscard]] size_t chunkPayload() const noexcept { return _count ? _chunks[0]->capacity() - 1 : 0; }
+
+protected:
+    /// 내부 생성자입니다. 자식 클래스에서 저장 공간을 주입받습니다.
+    ChunkPoolBase(StringBase** chunks, uint16_t* next, size_t count) noexcept;
+    ~ChunkPoolBase() = default;
+
+private:
+    StringBase** const _chunks;
+    uint16_t* const _next;   // 사용 중: 빌더 목록의 다음 조각, 비어 있음: 자유 목록의 다음 조각
+    const uint16_t _count;
+    uint16_t _freeHead;
+    uint16_t _freeCount;
+};
+
+/// 고정 크기 조각을 정적으로 소유하는 풀입니다.
+///
+/// 사용 예:
+/// @code
+/// static cms::ChunkPool<512, 32> responsePool;      // 16KB (전역/정적 배치, 스택 사용 없음)
+/// @endcode
+///
+/// @tparam CHUNK_BYTES 조각 하나의 버퍼 크기 (NUL 포함, String<N> 제한 이하)
+/// @tparam CHUNK_COUNT 조각 수
+template<size_t CHUNK_BYTES = 256, size_t CHUNK_COUNT = 16>
+class ChunkPool : public ChunkPoolBase {
+    static_assert(CHUNK_BYTES >= 2, "cms::ChunkPool CHUNK_BYTES must hold at least one byte and the terminator.");
+    static_assert(CHUNK_COUNT >= 1 && CHUNK_COUNT < ChunkPoolBase::NO_CHUNK, "cms::ChunkPool CHUNK_COUNT must be in [1, 65534].");
+
+public:
+    ChunkPool() noexcept : ChunkPoolBase(_table, _nextTable, CHUNK_COUNT) {
+        // 조각이 모두 생성된 뒤에 베이스 포인터 표를 채움
+        for (size_t i = 0; i < CHUNK_COUNT; ++i) _table[i] = &_storage[i];
+    }
+
+    /// 조각을 가리키는 포인터 표가 복사되지 않도록 복사를 금지합니다.
+    ChunkPool(const ChunkPool&) = delete;
+    ChunkPool& operator=(const ChunkPool&) = delete;
+
+private:
+    /// 조각 객체를 가리키는 베이스 포인터 표.
+    StringBase* _table[CHUNK_COUNT];
+    /// 조각별 다음 조각 번호 (빌더 목록 / 자유 목록 공용).
+    uint16_t _nextTable[CHUNK_COUNT];
+    /// 조각 본체.
+    String<CHUNK_BYTES> _storage[CHUNK_COUNT];
+};
+
+/// 조각 풀 위에 긴 문자열을 이어 붙이는 빌더입니다.
+///
+/// Why: 큰 응답을 연속 버퍼 없이 조립하고, 조각을 그대로 전송 함수에 넘기기 위함입니다.
+/// How: 꼬리 조각의 남은 공간에 먼저 쓰고, 넘치는 부분은 새 조각을 빌려 이어 씁니다. 포맷 출력은 조각 경계에서 잘리지 않도록
+///      예비 조각에 먼저 포맷한 뒤 꼬리에 옮겨 담거나 예비 조각을 그대로 연결합니다.
+///
+/// 사용 예:
+/// @code
+/// cms::StringBuilder json(responsePool);
+/// json << "{\"items\":[";
+/// for (size_t i = 0; i < n; ++i) json.appendPrintf("%s{\"id\":%d,\"v\":%f}", i ? "," : "", ids[i], values[i]);
+/// json << "]}";
+/// json.forEachSegment([&](const char* p, size_t len) { client.write(p, len); });
+/// @endcode
+///
+/// @note 풀이 바닥나면 그 뒤의 내용은 버려지고 overflowed()가 true가 됩니다.
+/// @note 조각은 소멸자 또는 clear()에서 풀로 돌아갑니다.
+class StringBuilder {
+public:
+    /// 빈 빌더를 만듭니다. (조각은 첫 append 때 빌림)
+    explicit StringBuilder(ChunkPoolBase& pool) noexcept
+        : _pool(pool), _head(ChunkPoolBase::NO_CHUNK), _tail(ChunkPoolBase::NO_CHUNK),
+          _length(0), _segments(0), _overflowed(false) {}
+
+    /// 빌린 조각을 모두 풀에 돌려줍니다.
+    ~StringBuilder() { clear(); }
+
+    /// 조각 목록이 두 빌더에 공유되지 않도록 복사를 금지합니다.
+    StringBuilder(const StringBuilder&) = delete;
+    StringBuilder& operator=(const StringBuilder&) = delete;
+
+    /// 내용을 비우고 조각을 풀에 돌려줍니다.
+    void clear() noexcept;
+
+    /// 데이터를 덧붙입니다. 조각 경계에서 나뉘어 저장될 수 있습니다.
+    ///
+    /// @return true: 전부 저장, false: 풀 부족으로 일부 또는 전부 누락
+    bool append(const char* s, size_t len) noexcept;
+    bool append(const char* s) noexcept { return s ? append(s, strlen(s)) : true; }
+    bool append(const cms::string::Token& token) noexcept { return append(token.ptr, token.len); }
+    bool append(const StringBase& s) noexcept { return append(s.c_str(), s.length()); }
+
+    /// printf 스타일 포맷 결과를 덧붙입니다. (포맷 1회 결과는 조각 하나를 넘지 않아야 온전히 저장됨)
+    ///
+    /// @note 포맷하는 동안 예비 조각 하나가 필요하며, 빌리지 못하면 overflowed()가 true가 됩니다.
+    ///
+    /// @return 포맷팅 후 빌더 전체 바이트 길이
+    int appendPrintf(const char* format, ...) CMS_PRINTF_CHECK(2, 3);
+    int appendPrintf(const char* format, va_list args);
+
+    StringBuilder& operator<<(const char* s) { append(s); return *this; }
+    StringBuilder& operator<<(char c) { append(&c, 1); return *this; }
+    StringBuilder& operator<<(const StringBase& s) { append(s); return *this; }
+    StringBuilder& operator<<(const cms::string::Token& token) { append(token); return *this; }
+    StringBuilder& operator<<(int v) { return *this << static_cast<long long>(v); }
+    StringBuilder& operator<<(long v) { return *this << static_cast<long long>(v); }
+    StringBuilder& operator<<(unsigned int v) { return *this << static_cast<unsigned long long>(v); }
+    StringBuilder& operator<<(unsigned long v) { return *this << static_cast<unsigned long long>(v); }
+    StringBuilder& operator<<(long long v);
+    StringBuilder& operator<<(unsigned long long v);
+    /// 실수는 StringBase와 같이 최단 왕복 표기로 결합합니다.
+    StringBuilder& operator<<(float v);
+    StringBuilder& operator<<(double v);
+
+    /// 전체 바이트 길이를 반환합니다.
+    [[nodiscard]] size_t length() const noexcept { return _length; }
+    /// 비어 있는지 확인합니다.
+    [[nodiscard]] bool isEmpty() const noexcept { return _length == 0; }
+    /// 사용 중인 조각(세그먼트) 수를 반환합니다.
+    [[nodiscard]] size_t segmentCount() const noexcept { return _segments; }
+    /// 풀 부족으로 내용이 누락된 적이 있는지 확인합니다. (clear()로 초기화)
+    [[nodiscard]] bool overflowed() const noexcept { return _overflowed; }
+
+    /// 조각을 순서대로 콜백에 넘깁니다. (분산-수집 출력, 합치기 복사 없음)
+    ///
+    /// @param fn void(const char* data, size_t len) 형태의 호출 가능 객체 (빈 조각은 건너뜀)
+    template<typename Fn>
+    void forEachSegment(Fn&& fn) const {
+        for (uint16_t i = _head; i != ChunkPoolBase::NO_CHUNK; i = _pool.next(i)) {
+            const StringBase& c = _pool.chunk(i);
+            if (c.length() > 0) fn(c.c_str(), c.length());
+        }
+    }
+
+    /// 조각을 Token 배열로 내보냅니다. (writev의 iovec, lwIP의 pbuf 체인 등으로 옮겨 담기 위함)
+    ///
+    /// @param out 세그먼트를 받을 배열
+    /// @param maxSegments 배열 크기
+    /// @return 기록한 세그먼트 수 (segmentCount()보다 작으면 배열이 부족한 것)
+    size_t exportSegments(cms::string::Token* out, size_t maxSegments) const noexcept;
+
+    /// 논리적 위치 offset부터 최대 maxLen 바이트를 연속 버퍼로 복사합니다. (MTU 단위 전송 등)
+    ///
+    /// @return 복사한 바이트 수 (NUL 종료하지 않음)
+    size_t copyTo(char* dest, size_t maxLen, size_t offset = 0) const noexcept;
+
+private:
+    /// 새 조각을 빌려 꼬리에 연결합니다. (실패 시 overflowed 표시)
+    bool grow() noexcept;
+
+    ChunkPoolBase& _pool;
+    uint16_t _head;
+    uint16_t _tail;
+    size_t _length;
+    uint16_t _segments;
+    bool _overflowed;
+};
+
+} // namespace cms
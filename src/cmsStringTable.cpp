@@ -0,0 +1,84 @@
+/// @author comser.dev
+/// @brief StringTableBase 비-템플릿 클래스의 구현부입니다. (해시 색인 탐사와 아레나 등록)
+/// 이 파일은 독립적으로 컴파일되어 테이블 크기별 코드 비대화를 방지합니다.
+
+#include <cstring>
+#include "cmsStringTable.h"
+
+namespace cms {
+
+    StringTableBase::StringTableBase(Entry* entries, size_t maxEntries, uint16_t* slots, size_t slotCount,
+                                     char* arena, size_t arenaBytes, bool ignoreCase) noexcept
+        : _entries(entries), _slots(slots), _arena(arena),
+          _maxEntries(static_cast<uint16_t>(maxEntries)), _slotMask(static_cast<uint16_t>(slotCount - 1)),
+          _arenaBytes(static_cast<uint16_t>(arenaBytes)), _count(0), _used(0), _ignoreCase(ignoreCase) {
+        memset(_slots, 0, slotCount * sizeof(uint16_t));
+    }
+
+    /// [lookup] 선형 탐사
+    ///
+    /// 해시가 같을 때만 길이와 본문을 비교하므로 불일치 항목은 대부분 정수 비교 한 번으로 넘어갑니다.
+    /// 적재율이 50% 이하라 빈 슬롯이 반드시 존재하여 탐사는 항상 종료됩니다.
+    int StringTableBase::lookup(const char* str, size_t len, uint32_t hash, size_t& slot) const noexcept {
+        size_t i = hash & _slotMask;
+        while (_slots[i] != 0) {
+            const int id = _slots[i] - 1;
+            const Entry& e = _entries[id];
+            if (e.hash == hash && e.len == len && cms::string::equals(_arena + e.offset, e.len, str, len, _ignoreCase)) {
+                return id;
+            }
+            i = (i + 1) & _slotMask;
+        }
+        slot = i;
+        return NOT_FOUND;
+    }
+
+    /// [intern] 등록 (이미 있으면 기존 ID)
+    int StringTableBase::intern(const char* str, size_t len) noexcept {
+        if (!str) return NOT_FOUND;
+        const uint32_t hash = cms::string::djb2(str, len, _ignoreCase);
+        size_t slot = 0;
+        const int found = lookup(str, len, hash, slot);
+        if (found != NOT_FOUND) return found;
+
+        // 1. 용량 확인 (항목 수, 아레나 NUL 포함)
+        if (_count >= _maxEntries || len + 1 > static_cast<size_t>(_arenaBytes - _used)) return NOT_FOUND;
+
+        // 2. 본문 복사 후 색인 등록
+        char* dst = _arena + _used;
+        memcpy(dst, str, len);
+        dst[len] = '\0';
+        _entries[_count] = {hash, _used, static_cast<uint16_t>(len)};
+        _slots[slot] = static_cast<uint16_t>(_count + 1);
+        _used = static_cast<uint16_t>(_used + len + 1);
+        return _count++;
+    }
+
+    int StringTableBase::find(const char* str, size_t len) const noexcept {
+        if (!str) return NOT_FOUND;
+        size_t slot = 0;
+        return lookup(str, len, cms::string::djb2(str, len, _ignoreCase), slot);
+    }
+
+    const char* StringTableBase::str(int id) const noexcept {
+        if (id < 0 || id >= _count) return nullptr;
+        return _arena + _entries[id].offset;
+    }
+
+    size_t StringTableBase::length(int id) const noexcept {
+        if (id < 0 || id >= _count) return 0;
+        return _entries[id].len;
+    }
+
+    uint32_t StringTableBase::hashOf(int id) const noexcept {
+        if (id < 0 || id >= _count) return 0;
+        return _entries[id].hash;
+    }
+
+    void StringTableBase::clear() noexcept {
+        memset(_slots, 0, (static_cast<size_t>(_slotMask) + 1) * sizeof(uint16_t));
+        _count = 0;
+        _used = 0;
+    }
+
+} // namespace cms
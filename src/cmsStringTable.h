@@ -0,0 +1,148 @@
+/// @author comser.dev
+///
+/// 자주 비교하는 문자열(명령어 이름, 태그 등)을 고정 크기 정적 아레나에 한 번만 저장하고
+/// 작은 정수 ID로 바꿔 주는 문자열 인터닝(Interning) 테이블입니다.
+
+#pragma once // 중복 포함 방지
+
+#include <stddef.h> // size_t 정의
+#include <stdint.h> // uint16_t, uint32_t 정의
+#include <cstring>  // strlen
+#include "cmsStringBase.h"
+
+namespace cms {
+
+// ==================================================================================================
+// [StringTable] 개요
+// - 왜 존재하는가: 같은 명령어/태그 문자열을 매번 equals(..., ignoreCase)나 compareIgnoreCase로 훑는 대신,
+//   한 번 등록해 둔 ID끼리 정수 비교만으로 분기하기 위해 존재합니다.
+// - 어떻게 동작하는가: 문자열 본문은 NUL 종료 형태로 아레나에 이어 붙이고, DJB2 해시를 키로 하는
+//   개방 주소법(선형 탐사) 색인으로 찾습니다. 색인은 항목 수의 2배 이상인 2의 거듭제곱 크기라 탐사가 짧습니다.
+// ==================================================================================================
+
+/// 인터닝 테이블의 공통 로직(해시 색인/아레나 관리)을 담당하는 베이스 클래스입니다.
+///
+/// Why: 용량(CAPACITY, BYTES)별로 탐색/등록 코드가 중복 생성되지 않도록 비-템플릿으로 분리하기 위함입니다. (Thin Template)
+/// How: 외부에서 주입된 항목/색인/아레나 배열을 사용하며, ID는 등록 순서대로 0부터 부여됩니다.
+///
+/// @note 등록(intern/clear)은 스레드 안전하지 않습니다. 초기화 단계에서 등록을 마친 뒤에는
+///       여러 태스크가 동시에 find()/str()을 호출해도 안전합니다.
+class StringTableBase {
+public:
+    /// 찾지 못했거나 등록할 공간이 없을 때 반환되는 ID
+    static constexpr int NOT_FOUND = -1;
+
+    /// 문자열을 등록하고 ID를 반환합니다. 이미 등록된 문자열이면 기존 ID를 돌려줍니다.
+    ///
+    /// @param str 등록할 문자열 (NUL 종료 불필요, 내용은 아레나로 복사됨)
+    /// @param len 바이트 길이
+    ///
+    /// @return 0부터 시작하는 ID (항목 수 또는 아레나 용량 초과 시 NOT_FOUND)
+    int intern(const char* str, size_t len) noexcept;
+    int intern(const char* str) noexcept { return str ? intern(str, strlen(str)) : NOT_FOUND; }
+    int intern(const cms::string::Token& token) noexcept { return intern(token.ptr, token.len); }
+    int intern(const StringBase& s) noexcept { return intern(s.c_str(), s.length()); }
+
+    /// 등록된 문자열의 ID를 찾습니다. (등록하지 않음)
+    ///
+    /// @return ID (등록되지 않았으면 NOT_FOUND)
+    int find(const char* str, size_t len) const noexcept;
+    int find(const char* str) const noexcept { return str ? find(str, strlen(str)) : NOT_FOUND; }
+    int find(const cms::string::Token& token) const noexcept { return find(token.ptr, token.len); }
+    int find(const StringBase& s) const noexcept { return find(s.c_str(), s.length()); }
+
+    /// ID에 해당하는 NUL 종료 문자열을 반환합니다. (잘못된 ID면 nullptr)
+    const char* str(int id) const noexcept;
+    /// ID에 해당하는 문자열의 바이트 길이를 반환합니다. (잘못된 ID면 0)
+    size_t length(int id) const noexcept;
+    /// ID에 해당하는 문자열의 캐시된 해시를 반환합니다. (ignoreCase 테이블은 대소문자를 접은 해시)
+    uint32_t hashOf(int id) const noexcept;
+
+    /// 등록된 문자열 수를 반환합니다.
+    [[nodiscard]] size_t size() const noexcept { return _count; }
+    /// 아레나 사용량(NUL 포함 바이트)을 반환합니다. (BYTES 크기 산정용)
+    [[nodiscard]] size_t bytesUsed() const noexcept { return _used; }
+    /// 대소문자를 무시하는 테이블인지 확인합니다.
+    [[nodiscard]] bool ignoresCase() const noexcept { return _ignoreCase; }
+
+    /// 모든 등록을 지웁니다. (이전에 받은 ID와 str() 포인터는 무효화됨)
+    void clear() noexcept;
+
+protected:
+    /// 등록된 문자열 한 개의 메타데이터 (8바이트)
+    struct Entry {
+        uint32_t hash;    // DJB2 (ignoreCase면 대문자로 접은 값)
+        uint16_t offset;  // 아레나 내 시작 위치
+        uint16_t len;     // 바이트 길이 (NUL 제외)
+    };
+
+    /// 내부 생성자입니다. 자식 클래스에서 저장 공간을 주입받습니다.
+    ///
+    /// @param slotCount 색인 크기 (2의 거듭제곱, maxEntries보다 커야 함)
+    StringTableBase(Entry* entries, size_t maxEntries, uint16_t* slots, size_t slotCount,
+                    char* arena, size_t arenaBytes, bool ignoreCase) noexcept;
+    ~StringTableBase() = default;
+
+private:
+    /// 해시로 색인을 탐사하여 일치하는 항목의 ID 또는 처음 만난 빈 슬롯 위치를 구합니다.
+    int lookup(const char* str, size_t len, uint32_t hash, size_t& slot) const noexcept;
+
+    Entry* const _entries;
+    uint16_t* const _slots;   // 항목 ID + 1 (0이면 빈 슬롯)
+    char* const _arena;
+    const uint16_t _maxEntries;
+    const uint16_t _slotMask;
+    const uint16_t _arenaBytes;
+    uint16_t _count;
+    uint16_t _used;
+    const bool _ignoreCase;
+};
+
+/// 고정 크기 정적 버퍼에 문자열을 인터닝하는 심볼 테이블입니다.
+///
+/// 사용 예:
+/// @code
+/// static cms::StringTable<16, 256> commands(true);   // 대소문자 무시
+/// const int CMD_REBOOT = commands.intern("reboot");
+/// const int CMD_STATUS = commands.intern("status");
+///
+/// const int id = commands.find(tokens[0]);           // 수신 프레임의 첫 토큰
+/// if (id == CMD_REBOOT) { ... }                      // 이후 분기는 정수 비교
+/// @endcode
+///
+/// @tparam CAPACITY 최대 등록 문자열 수 (RAM 약 12바이트/개: 항목 8바이트 + 색인 2바이트 × 2배)
+/// @tparam BYTES 문자열 본문을 저장할 아레나 크기 (문자열마다 NUL 1바이트 포함)
+template<size_t CAPACITY = 32, size_t BYTES = 512>
+class StringTable : public StringTableBase {
+    static_assert(CAPACITY >= 1 && CAPACITY <= 16384, "cms::StringTable CAPACITY must be in [1, 16384].");
+    static_assert(BYTES >= 2 && BYTES <= 65535, "cms::StringTable BYTES must be in [2, 65535].");
+
+    /// 항목 수의 2배 이상인 가장 작은 2의 거듭제곱 (적재율 50% 이하로 탐사 길이 유지)
+    static constexpr size_t slotCountFor(size_t n) {
+        size_t slots = 2;
+        while (slots < n * 2) slots <<= 1;
+        return slots;
+    }
+    static constexpr size_t SLOTS = slotCountFor(CAPACITY);
+
+public:
+    /// 빈 테이블을 만듭니다.
+    ///
+    /// @param ignoreCase true일 경우 ASCII 대소문자를 구분하지 않음 (처음 등록한 표기를 보관)
+    explicit StringTable(bool ignoreCase = false) noexcept
+        : StringTableBase(_entries, CAPACITY, _slots, SLOTS, _arena, BYTES, ignoreCase) {}
+
+    /// 내부 버퍼를 가리키는 베이스 포인터가 복사되지 않도록 복사를 금지합니다.
+    StringTable(const StringTable&) = delete;
+    StringTable& operator=(const StringTable&) = delete;
+
+private:
+    /// 등록 순서대로 저장된 항목 메타데이터.
+    Entry _entries[CAPACITY];
+    /// 해시 색인 (개방 주소법).
+    uint16_t _slots[SLOTS];
+    /// 문자열 본문 아레나.
+    char _arena[BYTES];
+};
+
+} // namespace cms
@@ -8,16 +8,21 @@
 
 #include <cstring>     // strlen, strstr, memcpy, memmove
 #include <cstdlib>     // strtol
-#include <sys/types.h> // regex_t 타입
 #include <cstdint>     // uint64_t
 
-#ifdef ARDUINO
-// Arduino는 기본 환경에 정규식이 없으므로 POSIX regex를 명시적으로 포함합니다.
-#include <regex.h>     // regcomp, regexec, regfree
+
+// UTF-8 스캔 커널 선택: Native 빌드에서는 SSE2/NEON 16바이트 블록, 그 외에는 워드 단위(SWAR)만 사용합니다.
+#if !defined(ARDUINO) && defined(__SSE2__)
+#include <emmintrin.h> // _mm_loadu_si128, _mm_movemask_epi8
+#define CMS_UTF8_SSE2 1
+#elif !defined(ARDUINO) && defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>  // vld1q_s8, vaddvq_u8
+#define CMS_UTF8_NEON 1
 #endif
 
 
 #include "cmsStringUtil.h"   // cms::string 선언
+#include "cmsRegex.h"        // cms::Regex (matches)
 
 // ==================================================================================================
 // [cms::string] 개요
@@ -36,96 +41,119 @@ namespace {
         0.5, 0.05, 0.005, 0.0005, 0.00005, 0.000005, 0.0000005, 0.00000005, 0.000000005, 0.0000000005
     };
 
-    /// [appendUIntInternal] 부호 없는 정수를 문자열로 변환하여 추가
+    // 2글자 단위 룩업 테이블 (나눗셈 횟수 50% 절감)
+    static const char digitsTable[] =
+        "0001020304050607080910111213141516171819"
+        "2021222324252627282930313233343536373839"
+        "4041424344454647484950515253545556575859"
+        "6061626364656667686970717273747576777879"
+        "8081828384858687888990919293949596979899";
+
+    /// [countDigits] 10진수 자릿수 계산
+    ///
+    /// 32비트 범위는 비교 체인만으로 결정하고, 그보다 큰 값만 64비트 거듭제곱과 비교합니다.
+    int countDigits(uint64_t v) {
+        if (v <= 0xFFFFFFFFull) {
+            const uint32_t w = static_cast<uint32_t>(v);
+            if (w < 10) return 1;
+            if (w < 100) return 2;
+            if (w < 1000) return 3;
+            if (w < 10000) return 4;
+            if (w < 100000) return 5;
+            if (w < 1000000) return 6;
+            if (w < 10000000) return 7;
+            if (w < 100000000) return 8;
+            if (w < 1000000000) return 9;
+            return 10;
+        }
+        int n = 10;
+        uint64_t p = 10000000000ull;
+        while (v >= p) {
+            if (++n == 20) break; // 10^19 초과 값은 20자리
+            p *= 10;
+        }
+        return n;
+    }
+
+    /// [writeDecimal] 부호 없는 정수를 end 바로 앞부터 역순으로 기록하고 시작 위치를 반환
+    ///
+    /// 2글자 단위 룩업으로 나눗셈을 절반으로 줄이며, 32비트에 들어가는 구간은 32비트 나눗셈만 사용합니다.
+    /// (ESP32에서 64비트 나눗셈은 소프트웨어 연산이므로 필요한 동안에만 수행)
+    char* writeDecimal(char* end, uint64_t v) {
+        while (v > 0xFFFFFFFFull) {
+            const unsigned int i = static_cast<unsigned int>(v % 100) << 1;
+            v /= 100;
+            *--end = digitsTable[i + 1];
+            *--end = digitsTable[i];
+        }
+        uint32_t w = static_cast<uint32_t>(v);
+        // 2자리씩 처리
+        while (w >= 100) {
+            const unsigned int i = (w % 100) << 1;
+            w /= 100;
+            *--end = digitsTable[i + 1];
+            *--end = digitsTable[i];
+        }
+        // 남은 1~2자리 처리
+        if (w >= 10) {
+            const unsigned int i = w << 1;
+            *--end = digitsTable[i + 1];
+            *--end = digitsTable[i];
+        } else {
+            *--end = static_cast<char>(w + '0');
+        }
+        return end;
+    }
+
+    /// [appendDecimal] 정수를 문자열로 변환하여 추가 (appendInt/appendUInt/%d/%u 공통 구현)
     ///
     /// printf의 무거운 로직 없이 정수를 텍스트로 고속 직렬화하기 위해 사용합니다.
-    /// 2글자 단위 룩업 테이블을 사용하여 나눗셈 연산을 절반으로 줄이고 성능을 최적화합니다.
+    /// 자릿수를 먼저 계산하여 최종 위치에 역순으로 바로 기록하므로 뒤집기나 임시 버퍼가 없습니다.
+    /// 공간이 부족하면 숫자가 잘려 보이지 않도록 아무것도 기록하지 않습니다.
     ///
     /// @param buffer 결과 저장 버퍼
     /// @param maxLen 버퍼 최대 크기
     /// @param curLen [IN/OUT] 현재 길이
-    /// @param uval 변환할 값
-    /// @param width 최소 출력 너비
-    /// @param padChar 채움 문자
-    void appendUIntInternal(char* buffer, size_t maxLen, size_t& curLen, unsigned long uval, int width, char padChar) {
-        // 1. 숫자 자릿수 계산 (분기 예측 최적화)
-        int digitsCount;
-        if (uval < 10) digitsCount = 1;
-        else if (uval < 100) digitsCount = 2;
-        else if (uval < 1000) digitsCount = 3;
-        else if (uval < 10000) digitsCount = 4;
-        else if (uval < 100000) digitsCount = 5;
-        else if (uval < 1000000) digitsCount = 6;
-        else if (uval < 10000000) digitsCount = 7;
-        else if (uval < 100000000) digitsCount = 8;
-        else if (uval < 1000000000) digitsCount = 9;
-        else digitsCount = 10;
-
-        // 2. 전체 출력 길이 결정 (Padding 포함)
-        int totalLen = (digitsCount > width) ? digitsCount : width;
-
-        // 3. 버퍼 공간 확인
+    /// @param uval 변환할 값의 절댓값
+    /// @param negative '-' 부호 출력 여부
+    /// @param width 최소 출력 너비 (부호 포함)
+    /// @param padChar 채움 문자 ('0'이면 부호 뒤, 그 외에는 부호 앞을 채움)
+    void appendDecimal(char* buffer, size_t maxLen, size_t& curLen, uint64_t uval, bool negative, int width, char padChar) {
+        const size_t digitsCount = static_cast<size_t>(countDigits(uval));
+        const size_t bodyLen = digitsCount + (negative ? 1 : 0);
+        const size_t totalLen = (width > 0 && static_cast<size_t>(width) > bodyLen) ? static_cast<size_t>(width) : bodyLen;
         if (curLen + totalLen >= maxLen) return;
 
-        // 4. 끝 지점부터 역순으로 채우기 (Reverse 과정 생략)
-        size_t startIdx = curLen;
-        size_t writeIdx = curLen + totalLen;
-        curLen = writeIdx;
-        buffer[writeIdx] = '\0';
-
-        unsigned long v = uval;
-        // 2글자 단위 룩업 테이블 (나눗셈 횟수 50% 절감)
-        static const char digitsTable[] =
-            "0001020304050607080910111213141516171819"
-            "2021222324252627282930313233343536373839"
-            "4041424344454647484950515253545556575859"
-            "6061626364656667686970717273747576777879"
-            "8081828384858687888990919293949596979899";
-
-        // 2자리씩 처리
-        while (v >= 100) {
-            unsigned int i = (v % 100) << 1;
-            v /= 100;
-            buffer[--writeIdx] = digitsTable[i + 1];
-            buffer[--writeIdx] = digitsTable[i];
-        }
-        // 남은 1~2자리 처리
-        if (v >= 10) {
-            unsigned int i = v << 1;
-            buffer[--writeIdx] = digitsTable[i + 1];
-            buffer[--writeIdx] = digitsTable[i];
+        char* out = buffer + curLen;
+        const size_t padLen = totalLen - bodyLen;
+        if (padChar == '0') {
+            if (negative) *out++ = '-';
+            memset(out, '0', padLen);
         } else {
-            buffer[--writeIdx] = (char)(v + '0');
-        }
-        while (writeIdx > startIdx) {
-            buffer[--writeIdx] = padChar;
-        }
+            memset(out, padChar, padLen);
+            if (negative) out[padLen] = '-';
         }
+        curLen += totalLen;
+        buffer[curLen] = '\0';
+        writeDecimal(buffer + curLen, uval);
+    }
 
-        /// [computeLPS] KMP 알고리즘용 부분 일치 테이블(LPS) 생성
-        ///
-        /// 대소문자 무시 검색 시 반복적인 비교를 피하기 위해 패턴의 접두사와 접미사 일치 정보를 계산합니다.
-        /// @param pat 검색 패턴
-        /// @param m 패턴 길이
-        /// @param lps [OUT] 계산된 테이블 저장 배열
-        void computeLPS(const char* pat, size_t m, int16_t* lps) {
-            size_t len = 0;
-            lps[0] = 0;
-            size_t i = 1;
-            while (i < m) {
-                if (cms::string::toLower((unsigned char)pat[i]) == cms::string::toLower((unsigned char)pat[len])) {
-                    len++;
-                    lps[i] = (int16_t)len;
-                    i++;
-                } else {
-                    if (len != 0) {
-                        len = lps[len - 1];
-                    } else {
-                        lps[i] = 0;
-                        i++;
-                    }
-                }
+    /// [FoldTable] ignoreCase 검색용 ASCII 대소문자 폴딩 테이블 (컴파일 타임 생성, 플래시 배치)
+    ///
+    /// 비교 루프마다 범위 검사 대신 256바이트 조회 한 번으로 대문자를 소문자로 접습니다.
+    struct FoldTable {
+        unsigned char map[256];
+        constexpr FoldTable() : map() {
+            for (int c = 0; c < 256; ++c) {
+                map[c] = static_cast<unsigned char>((c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c);
             }
+        }
+    };
+    constexpr FoldTable FOLD{};
+
+    template<bool ICASE>
+    inline unsigned char foldByte(char c) {
+        return ICASE ? FOLD.map[static_cast<unsigned char>(c)] : static_cast<unsigned char>(c);
     }
 
     /// [appendHexInternal] 부호 없는 정수를 16진수 문자열로 변환
@@ -167,32 +195,881 @@ namespace {
         }
     }
 
-    /// [findUtf8CharStart] UTF-8 논리적 인덱스의 물리적 주소 탐색
+    // ----------------------------------------------------------------------------------------------
+    // [Grisu2] 최단 왕복(Shortest Round-Trip) 실수 → 10진 변환
+    // 다시 읽었을 때 같은 float/double로 돌아오는 가장 짧은 숫자열을 64비트 정수 연산만으로 구합니다.
+    // (F. Loitsch, "Printing Floating-Point Numbers Quickly and Accurately with Integers", 2010)
+    // 테이블은 10^-300 ~ 10^324를 8단계 간격으로 캐시한 79개 항목(약 1KB, 플래시 배치)뿐입니다.
+    // ----------------------------------------------------------------------------------------------
+
+    /// 64비트 가수와 2진 지수로 표현한 부동소수점 값 (f × 2^e)
+    struct DiyFp {
+        uint64_t f;
+        int e;
+    };
+
+    /// 두 값의 곱에서 상위 64비트를 반올림하여 반환합니다. (64×64 → 128 곱셈의 32비트 분해)
+    DiyFp diyMul(const DiyFp& x, const DiyFp& y) {
+        const uint64_t uLo = x.f & 0xFFFFFFFFu, uHi = x.f >> 32;
+        const uint64_t vLo = y.f & 0xFFFFFFFFu, vHi = y.f >> 32;
+        const uint64_t p0 = uLo * vLo, p1 = uLo * vHi, p2 = uHi * vLo, p3 = uHi * vHi;
+        uint64_t q = (p0 >> 32) + (p1 & 0xFFFFFFFFu) + (p2 & 0xFFFFFFFFu);
+        q += uint64_t(1) << 31; // 반올림
+        return {p3 + (p1 >> 32) + (p2 >> 32) + (q >> 32), x.e + y.e + 64};
+    }
+
+    /// 최상위 비트가 1이 되도록 정규화합니다. (f != 0)
+    DiyFp diyNormalize(DiyFp x) {
+        const int shift = __builtin_clzll(x.f);
+        return {x.f << shift, x.e - shift};
+    }
+
+    /// 값 v와 반올림 경계(m-, m+)를 같은 지수로 정규화하여 담은 구조체
+    struct Boundaries {
+        DiyFp w;
+        DiyFp minus;
+        DiyFp plus;
+    };
+
+    /// 부호를 뗀 비트 표현에서 값과 경계를 계산합니다.
+    /// @param precision 가수 비트 수 (숨은 비트 포함: double 53, float 24)
+    /// @param bias 지수 바이어스 + (precision - 1) (double 1075, float 150)
+    Boundaries computeBoundaries(uint64_t bits, int precision, int bias) {
+        const uint64_t hiddenBit = uint64_t(1) << (precision - 1);
+        const uint64_t fraction = bits & (hiddenBit - 1);
+        const int exponent = static_cast<int>(bits >> (precision - 1));
+
+        const DiyFp v = (exponent == 0) ? DiyFp{fraction, 1 - bias}                    // 비정규수
+                                        : DiyFp{fraction + hiddenBit, exponent - bias};
+
+        // 가수가 2의 거듭제곱이면 아래쪽 이웃이 절반 간격으로 더 가깝습니다.
+        const bool lowerCloser = (fraction == 0 && exponent > 1);
+        const DiyFp mPlus = diyNormalize(DiyFp{2 * v.f + 1, v.e - 1});
+        const DiyFp mMinus = lowerCloser ? DiyFp{4 * v.f - 1, v.e - 2} : DiyFp{2 * v.f - 1, v.e - 1};
+        return {diyNormalize(v), DiyFp{mMinus.f << (mMinus.e - mPlus.e), mPlus.e}, mPlus};
+    }
+
+    /// 캐시된 10의 거듭제곱 c_k = f × 2^e ≈ 10^k
+    struct CachedPower {
+        uint64_t f;
+        int16_t e;
+        int16_t k;
+    };
+
+    constexpr int GRISU_ALPHA = -60; // 곱셈 결과 지수의 허용 하한
+    constexpr int GRISU_GAMMA = -32; // 곱셈 결과 지수의 허용 상한
+    constexpr int CACHED_POWERS_MIN_K = -300;
+    constexpr int CACHED_POWERS_STEP = 8;
+
+    static const CachedPower cachedPowers[] = {
+        {0xAB70FE17C79AC6CAULL, -1060, -300},
+        {0xFF77B1FCBEBCDC4FULL, -1034, -292},
+        {0xBE5691EF416BD60CULL, -1007, -284},
+        {0x8DD01FAD907FFC3CULL,  -980, -276},
+        {0xD3515C2831559A83ULL,  -954, -268},
+        {0x9D71AC8FADA6C9B5ULL,  -927, -260},
+        {0xEA9C227723EE8BCBULL,  -901, -252},
+        {0xAECC49914078536DULL,  -874, -244},
+        {0x823C12795DB6CE57ULL,  -847, -236},
+        {0xC21094364DFB5637ULL,  -821, -228},
+        {0x9096EA6F3848984FULL,  -794, -220},
+        {0xD77485CB25823AC7ULL,  -768, -212},
+        {0xA086CFCD97BF97F4ULL,  -741, -204},
+        {0xEF340A98172AACE5ULL,  -715, -196},
+        {0xB23867FB2A35B28EULL,  -688, -188},
+        {0x84C8D4DFD2C63F3BULL,  -661, -180},
+        {0xC5DD44271AD3CDBAULL,  -635, -172},
+        {0x936B9FCEBB25C996ULL,  -608, -164},
+        {0xDBAC6C247D62A584ULL,  -582, -156},
+        {0xA3AB66580D5FDAF6ULL,  -555, -148},
+        {0xF3E2F893DEC3F126ULL,  -529, -140},
+        {0xB5B5ADA8AAFF80B8ULL,  -502, -132},
+        {0x87625F056C7C4A8BULL,  -475, -124},
+        {0xC9BCFF6034C13053ULL,  -449, -116},
+        {0x964E858C91BA2655ULL,  -422, -108},
+        {0xDFF9772470297EBDULL,  -396, -100},
+        {0xA6DFBD9FB8E5B88FULL,  -369,  -92},
+        {0xF8A95FCF88747D94ULL,  -343,  -84},
+        {0xB94470938FA89BCFULL,  -316,  -76},
+        {0x8A08F0F8BF0F156BULL,  -289,  -68},
+        {0xCDB02555653131B6ULL,  -263,  -60},
+        {0x993FE2C6D07B7FACULL,  -236,  -52},
+        {0xE45C10C42A2B3B06ULL,  -210,  -44},
+        {0xAA242499697392D3ULL,  -183,  -36},
+        {0xFD87B5F28300CA0EULL,  -157,  -28},
+        {0xBCE5086492111AEBULL,  -130,  -20},
+        {0x8CBCCC096F5088CCULL,  -103,  -12},
+        {0xD1B71758E219652CULL,   -77,   -4},
+        {0x9C40000000000000ULL,   -50,    4},
+        {0xE8D4A51000000000ULL,   -24,   12},
+        {0xAD78EBC5AC620000ULL,     3,   20},
+        {0x813F3978F8940984ULL,    30,   28},
+        {0xC097CE7BC90715B3ULL,    56,   36},
+        {0x8F7E32CE7BEA5C70ULL,    83,   44},
+        {0xD5D238A4ABE98068ULL,   109,   52},
+        {0x9F4F2726179A2245ULL,   136,   60},
+        {0xED63A231D4C4FB27ULL,   162,   68},
+        {0xB0DE65388CC8ADA8ULL,   189,   76},
+        {0x83C7088E1AAB65DBULL,   216,   84},
+        {0xC45D1DF942711D9AULL,   242,   92},
+        {0x924D692CA61BE758ULL,   269,  100},
+        {0xDA01EE641A708DEAULL,   295,  108},
+        {0xA26DA3999AEF774AULL,   322,  116},
+        {0xF209787BB47D6B85ULL,   348,  124},
+        {0xB454E4A179DD1877ULL,   375,  132},
+        {0x865B86925B9BC5C2ULL,   402,  140},
+        {0xC83553C5C8965D3DULL,   428,  148},
+        {0x952AB45CFA97A0B3ULL,   455,  156},
+        {0xDE469FBD99A05FE3ULL,   481,  164},
+        {0xA59BC234DB398C25ULL,   508,  172},
+        {0xF6C69A72A3989F5CULL,   534,  180},
+        {0xB7DCBF5354E9BECEULL,   561,  188},
+        {0x88FCF317F22241E2ULL,   588,  196},
+        {0xCC20CE9BD35C78A5ULL,   614,  204},
+        {0x98165AF37B2153DFULL,   641,  212},
+        {0xE2A0B5DC971F303AULL,   667,  220},
+        {0xA8D9D1535CE3B396ULL,   694,  228},
+        {0xFB9B7CD9A4A7443CULL,   720,  236},
+        {0xBB764C4CA7A44410ULL,   747,  244},
+        {0x8BAB8EEFB6409C1AULL,   774,  252},
+        {0xD01FEF10A657842CULL,   800,  260},
+        {0x9B10A4E5E9913129ULL,   827,  268},
+        {0xE7109BFBA19C0C9DULL,   853,  276},
+        {0xAC2820D9623BF429ULL,   880,  284},
+        {0x80444B5E7AA7CF85ULL,   907,  292},
+        {0xBF21E44003ACDD2DULL,   933,  300},
+        {0x8E679C2F5E44FF8FULL,   960,  308},
+        {0xD433179D9C8CB841ULL,   986,  316},
+        {0x9E19DB92B4E31BA9ULL,  1013,  324},    };
+
+    /// 2진 지수 e인 값에 곱했을 때 결과 지수가 [ALPHA, GAMMA]에 들어오는 캐시 항목을 찾습니다.
+    const CachedPower& cachedPowerFor(int e) {
+        // k = ceil((ALPHA - e - 1) * log10(2)), 78913 / 2^18 ≈ log10(2)
+        const int f = GRISU_ALPHA - e - 1;
+        const int k = (f * 78913) / (1 << 18) + (f > 0);
+        const int index = (-CACHED_POWERS_MIN_K + k + (CACHED_POWERS_STEP - 1)) / CACHED_POWERS_STEP;
+        return cachedPowers[index];
+    }
+
+    /// n 이하의 가장 큰 10의 거듭제곱과 그 자릿수를 구합니다.
+    int largestPow10(uint32_t n, uint32_t& pow10) {
+        static const uint32_t powers[] = {1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u, 1000000000u};
+        int digits = 10;
+        while (digits > 1 && n < powers[digits - 1]) --digits;
+        pow10 = powers[digits - 1];
+        return digits;
+    }
+
+    /// 생성된 마지막 자릿수를 실제 값(w)에 더 가깝도록 내립니다.
+    void grisuRound(char* buf, int len, uint64_t dist, uint64_t delta, uint64_t rest, uint64_t tenK) {
+        while (rest < dist && delta - rest >= tenK &&
+               (rest + tenK < dist || dist - rest > rest + tenK - dist)) {
+            buf[len - 1]--;
+            rest += tenK;
+        }
+    }
+
+    /// 경계 [m-, m+] 안에 들어오는 가장 짧은 자릿수를 생성합니다.
     ///
-    /// 멀티바이트 환경에서 'n번째 글자'가 실제 메모리의 어디에 위치하는지 정확히 찾기 위해 필요합니다.
-    /// UTF-8의 후속 바이트 비트 패턴(10xxxxxx)을 건너뛰며 논리적 글자 수를 카운트합니다.
+    /// @param buf [OUT] 자릿수 ('0'~'9', 최대 17개)
+    /// @param len [OUT] 자릿수 개수
+    /// @param decimalExponent [IN/OUT] 값 = buf × 10^decimalExponent
+    void grisuDigits(char* buf, int& len, int& decimalExponent, DiyFp mMinus, DiyFp w, DiyFp mPlus) {
+        uint64_t delta = mPlus.f - mMinus.f;
+        uint64_t dist = mPlus.f - w.f;
+
+        const int shift = -mPlus.e; // 32 ~ 60
+        const uint64_t one = uint64_t(1) << shift;
+        uint32_t p1 = static_cast<uint32_t>(mPlus.f >> shift); // 정수부 (32비트에 들어감)
+        uint64_t p2 = mPlus.f & (one - 1);                      // 소수부
+
+        // 1. 정수부 자릿수 생성
+        uint32_t pow10 = 0;
+        int n = largestPow10(p1, pow10);
+        len = 0;
+        while (n > 0) {
+            buf[len++] = static_cast<char>('0' + p1 / pow10);
+            p1 %= pow10;
+            n--;
+            const uint64_t rest = (static_cast<uint64_t>(p1) << shift) + p2;
+            if (rest <= delta) {
+                decimalExponent += n;
+                grisuRound(buf, len, dist, delta, rest, static_cast<uint64_t>(pow10) << shift);
+                return;
+            }
+            pow10 /= 10;
+        }
+
+        // 2. 소수부 자릿수 생성 (경계 안에 들어올 때까지)
+        int m = 0;
+        for (;;) {
+            p2 *= 10;
+            buf[len++] = static_cast<char>('0' + (p2 >> shift));
+            p2 &= one - 1;
+            m++;
+            delta *= 10;
+            dist *= 10;
+            if (p2 <= delta) break;
+        }
+        decimalExponent -= m;
+        grisuRound(buf, len, dist, delta, p2, one);
+    }
+
+    /// 자릿수와 10진 지수를 사람이 읽는 형태로 배치합니다. (printf %g와 같은 기준으로 고정/지수 표기 선택)
     ///
-    /// @param str 검색할 UTF-8 문자열
-    /// @param charIdx 찾고자 하는 글자의 논리적 위치 (0부터 시작)
-    /// @return 해당 글자가 시작되는 메모리 주소
-    const char* findUtf8CharStart(const char* str, size_t charIdx) {
-        // 1. 입력 문자열이 유효하지 않으면 즉시 종료합니다.
-        if (!str) return nullptr;
+    /// 1234.5 → "1234.5", 0.00012 → "0.00012", 1e+16, 1.5e-05
+    char* layoutDigits(char* out, const char* digits, int n, int decimalExponent) {
+        const int k = n + decimalExponent; // 소수점 앞 자릿수
+        if (n <= k && k <= 15) {           // 정수: 뒤에 0 추가
+            memcpy(out, digits, n);
+            memset(out + n, '0', k - n);
+            return out + k;
+        }
+        if (0 < k && k <= 15) {            // 소수점이 자릿수 사이
+            memcpy(out, digits, k);
+            out[k] = '.';
+            memcpy(out + k + 1, digits + k, n - k);
+            return out + n + 1;
+        }
+        if (-4 < k && k <= 0) {            // 0.000ddd
+            out[0] = '0';
+            out[1] = '.';
+            memset(out + 2, '0', -k);
+            memcpy(out + 2 - k, digits, n);
+            return out + 2 - k + n;
+        }
+        // 지수 표기: d.ddde±XX
+        *out++ = digits[0];
+        if (n > 1) {
+            *out++ = '.';
+            memcpy(out, digits + 1, n - 1);
+            out += n - 1;
+        }
+        int e = k - 1;
+        *out++ = 'e';
+        *out++ = (e < 0) ? '-' : '+';
+        if (e < 0) e = -e;
+        if (e >= 100) *out++ = static_cast<char>('0' + e / 100);
+        *out++ = static_cast<char>('0' + (e / 10) % 10);
+        *out++ = static_cast<char>('0' + e % 10);
+        return out;
+    }
+
+    /// [appendShortestBits] IEEE-754 비트 표현을 최단 왕복 문자열로 변환하여 추가 (공간이 부족하면 기록하지 않음)
+    ///
+    /// @param bits 부호 포함 원시 비트
+    /// @param precision 가수 비트 수 (숨은 비트 포함)
+    /// @param exponentBits 지수 비트 수
+    void appendShortestBits(char* buffer, size_t maxLen, size_t& curLen, uint64_t bits, int precision, int exponentBits) {
+        const int fractionBits = precision - 1;
+        const int signShift = fractionBits + exponentBits;
+        const bool negative = ((bits >> signShift) & 1u) != 0;
+        const uint64_t absBits = bits & ((uint64_t(1) << signShift) - 1);
+        const int exponentMax = (1 << exponentBits) - 1;
+
+        char tmp[32]; // 부호 1 + 자릿수 17 + "0." 및 0 3개 또는 지수부 5 → 최대 25바이트
+        char* p = tmp;
+        if (static_cast<int>(absBits >> fractionBits) == exponentMax) {
+            const bool isNan = (absBits & ((uint64_t(1) << fractionBits) - 1)) != 0;
+            const char* text = isNan ? "nan" : (negative ? "-inf" : "inf");
+            const size_t textLen = strlen(text);
+            memcpy(p, text, textLen);
+            p += textLen;
+        } else {
+            if (negative) *p++ = '-';
+            if (absBits == 0) {
+                *p++ = '0';
+            } else {
+                const Boundaries b = computeBoundaries(absBits, precision, (exponentMax >> 1) + fractionBits);
+                const CachedPower& c = cachedPowerFor(b.plus.e);
+                const DiyFp ck{c.f, c.e};
+                const DiyFp w = diyMul(b.w, ck);
+                const DiyFp wMinus = diyMul(b.minus, ck);
+                const DiyFp wPlus = diyMul(b.plus, ck);
+
+                // 곱셈 오차(±1 ulp)를 고려하여 경계를 안쪽으로 좁힙니다. (항상 왕복 보장)
+                char digits[18];
+                int len = 0;
+                int decimalExponent = -c.k;
+                grisuDigits(digits, len, decimalExponent, DiyFp{wMinus.f + 1, wMinus.e}, w, DiyFp{wPlus.f - 1, wPlus.e});
+                p = layoutDigits(p, digits, len, decimalExponent);
+            }
+        }
+
+        const size_t len = static_cast<size_t>(p - tmp);
+        if (curLen + len >= maxLen) return;
+        memcpy(buffer + curLen, tmp, len);
+        curLen += len;
+        buffer[curLen] = '\0';
+    }
+
+    // ----------------------------------------------------------------------------------------------
+    // [숫자 파싱] from_chars 스타일 단일 패스 정수/실수 변환 코어
+    // 정수는 한 번의 스캔으로 검증·누적·오버플로우 검사를 함께 수행합니다.
+    // 실수는 Clinger 고속 경로(가수와 10의 거듭제곱이 모두 정확히 표현되는 경우 곱셈/나눗셈 1회)로 처리하고,
+    // 그 외에는 Grisu 캐시 거듭제곱으로 64비트 근사 곱셈을 하고, 오차 범위 안에 반올림 경계가 걸린 드문 경우에만
+    // 10진 자릿수 배열을 2의 거듭제곱 단위로 이동시키는 정수 전용 변환(Simple Decimal Conversion)을 사용합니다.
+    // ----------------------------------------------------------------------------------------------
+
+    /// 문자를 base 진법 숫자 값으로 변환합니다. (숫자가 아니면 base 이상의 값 반환)
+    inline unsigned int digitValue(unsigned char c) {
+        if (c >= '0' && c <= '9') return c - '0';
+        c = static_cast<unsigned char>(c | 0x20); // ASCII 소문자화
+        if (c >= 'a' && c <= 'z') return c - 'a' + 10;
+        return 36;
+    }
 
-        const char* p = str;
+    /// [parseIntegerCore] 부호와 절댓값을 분리하여 파싱 (U: 누적 타입, 32비트 대상은 32비트 연산만 사용)
+    ///
+    /// @param maxPositive 양수 절댓값 상한
+    /// @param maxNegative 음수 절댓값 상한 (0이면 '-' 불허)
+    template<typename U>
+    cms::string::ParseResult parseIntegerCore(const char* first, const char* last, int base, U maxPositive, U maxNegative,
+                                              U& magnitude, bool& negative) {
+        using cms::string::ParseErrc;
+        const char* p = first;
+        negative = false;
+        if (base < 2 || base > 36 || p >= last) return {first, ParseErrc::InvalidArgument};
+
+        // 1. 부호 (+는 toInt와의 호환을 위해 허용)
+        if (*p == '-' || *p == '+') {
+            negative = (*p == '-');
+            if (negative && maxNegative == 0) return {first, ParseErrc::InvalidArgument};
+            ++p;
+        }
+        // 2. 16진수 접두사 "0x" / "0X" (뒤에 16진수 숫자가 있을 때만 접두사로 취급)
+        if (base == 16 && last - p >= 3 && p[0] == '0' && (p[1] | 0x20) == 'x' && digitValue((unsigned char)p[2]) < 16) {
+            p += 2;
+        }
+
+        // 3. 숫자 누적 + 오버플로우 검사 (나눗셈은 호출당 한 번)
+        const U limit = negative ? maxNegative : maxPositive;
+        const U ub = static_cast<U>(base);
+        const U limitDiv = limit / ub;
+        const unsigned int limitMod = static_cast<unsigned int>(limit % ub);
+        const char* const digitsBegin = p;
+        U value = 0;
+        bool overflow = false;
+        while (p < last) {
+            const unsigned int d = digitValue((unsigned char)*p);
+            if (d >= static_cast<unsigned int>(base)) break;
+            if (value > limitDiv || (value == limitDiv && d > limitMod)) overflow = true; // 남은 숫자는 끝까지 소비
+            else value = static_cast<U>(value * ub + d);
+            ++p;
+        }
+        if (p == digitsBegin) return {first, ParseErrc::InvalidArgument};
+        if (overflow) return {p, ParseErrc::OutOfRange};
+        magnitude = value;
+        return {p, ParseErrc::Ok};
+    }
+
+    /// [DecimalDigits] 정확한 10진 → 2진 변환용 고정 크기 10진수 (값 = 0.d1d2d3... × 10^decimalPoint)
+    ///
+    /// 버퍼를 넘는 자릿수는 버리고 truncated로 표시합니다. (반올림 동점 판정에만 영향)
+    struct DecimalDigits {
+        static constexpr int MAX_DIGITS = 128;
+        int numDigits;
+        int decimalPoint;
+        bool truncated;
+        uint8_t digits[MAX_DIGITS + 20]; // 왼쪽 이동 시 최대 19자리가 일시적으로 늘어남
+
+        void trim() {
+            while (numDigits > 0 && digits[numDigits - 1] == 0) --numDigits;
+        }
+
+        /// 값을 2^shift배 합니다. (shift ≤ 60)
+        void leftShift(unsigned int shift) {
+            if (numDigits == 0) return;
+            int read = numDigits - 1;
+            int write = numDigits + 18;
+            uint64_t carry = 0;
+            while (read >= 0) {
+                const uint64_t acc = (static_cast<uint64_t>(digits[read--]) << shift) + carry;
+                carry = acc / 10;
+                digits[write--] = static_cast<uint8_t>(acc - carry * 10);
+            }
+            while (carry > 0) {
+                const uint64_t q = carry / 10;
+                digits[write--] = static_cast<uint8_t>(carry - q * 10);
+                carry = q;
+            }
+            const int begin = write + 1;
+            const int count = numDigits + 19 - begin;
+            memmove(digits, digits + begin, static_cast<size_t>(count));
+            decimalPoint += count - numDigits;
+            numDigits = count;
+            if (numDigits > MAX_DIGITS) {
+                for (int i = MAX_DIGITS; i < numDigits; ++i) truncated |= (digits[i] != 0);
+                numDigits = MAX_DIGITS;
+            }
+            trim();
+        }
+
+        /// 값을 2^shift로 나눕니다. (shift ≤ 60)
+        void rightShift(unsigned int shift) {
+            int read = 0;
+            int write = 0;
+            uint64_t n = 0;
+            // 1. 첫 출력 자릿수가 나올 때까지 누적
+            while ((n >> shift) == 0) {
+                if (read < numDigits) {
+                    n = 10 * n + digits[read++];
+                } else if (n == 0) {
+                    numDigits = 0;
+                    return;
+                } else {
+                    while ((n >> shift) == 0) { n *= 10; ++read; }
+                    break;
+                }
+            }
+            decimalPoint -= read - 1;
+            const uint64_t mask = (uint64_t(1) << shift) - 1;
+            // 2. 나머지 자릿수를 흘려 보내며 몫을 기록
+            while (read < numDigits) {
+                const uint8_t d = static_cast<uint8_t>(n >> shift);
+                n = 10 * (n & mask) + digits[read++];
+                digits[write++] = d;
+            }
+            while (n > 0) {
+                const uint8_t d = static_cast<uint8_t>(n >> shift);
+                n = 10 * (n & mask);
+                if (write < MAX_DIGITS) digits[write++] = d;
+                else if (d > 0) truncated = true;
+            }
+            numDigits = write;
+            trim();
+        }
+
+        /// 소수점 위 정수부를 반올림하여 반환합니다. (동점은 짝수 쪽)
+        uint64_t roundedInteger() const {
+            if (numDigits == 0 || decimalPoint < 0) return 0;
+            if (decimalPoint > 18) return UINT64_MAX;
+            const int dp = decimalPoint;
+            uint64_t n = 0;
+            for (int i = 0; i < dp; ++i) n = 10 * n + ((i < numDigits) ? digits[i] : 0);
+            bool roundUp = false;
+            if (dp < numDigits) {
+                roundUp = digits[dp] >= 5;
+                if (digits[dp] == 5 && dp + 1 == numDigits) {
+                    roundUp = truncated || (dp > 0 && (digits[dp - 1] & 1));
+                }
+            }
+            return roundUp ? n + 1 : n;
+        }
+    };
+
+    /// 10^n을 2의 거듭제곱으로 이동할 때 한 번에 이동할 비트 수 (floor(n × log2(10)) 이하)
+    const uint8_t decimalShiftBits[] = {0, 3, 6, 9, 13, 16, 19, 23, 26, 29, 33, 36, 39, 43, 46, 49, 53, 56, 59};
+    constexpr unsigned int DECIMAL_MAX_SHIFT = 60;
+
+    inline unsigned int decimalShiftFor(int n) {
+        return (n < static_cast<int>(sizeof(decimalShiftBits))) ? decimalShiftBits[n] : DECIMAL_MAX_SHIFT;
+    }
+
+    /// [decimalToBits] 10진수를 IEEE-754 비트(부호 제외)로 정확히 반올림 변환 (Simple Decimal Conversion)
+    ///
+    /// @param mantissaBits 명시적 가수 비트 수 (double 52, float 23)
+    /// @param minExponent 최소 지수 - 1 (double -1023, float -127)
+    /// @param infinitePower 무한대 지수 필드 (double 0x7FF, float 0xFF)
+    /// @param overflow [OUT] 무한대로 넘쳤는지 여부
+    uint64_t decimalToBits(DecimalDigits& d, int mantissaBits, int minExponent, int infinitePower, bool& overflow) {
+        overflow = false;
+        const uint64_t infBits = static_cast<uint64_t>(infinitePower) << mantissaBits;
+        if (d.numDigits == 0 || d.decimalPoint < -400) return 0;
+        if (d.decimalPoint > 400) { overflow = true; return infBits; }
+
+        // 1. 값이 [1/2, 1) 범위에 들어오도록 2의 거듭제곱 단위로 이동
+        int exp2 = 0;
+        while (d.decimalPoint > 0) {
+            const unsigned int shift = decimalShiftFor(d.decimalPoint);
+            d.rightShift(shift);
+            exp2 += static_cast<int>(shift);
+        }
+        while (d.decimalPoint <= 0) {
+            unsigned int shift;
+            if (d.decimalPoint == 0) {
+                if (d.digits[0] >= 5) break;
+                shift = (d.digits[0] < 2) ? 2 : 1;
+            } else {
+                shift = decimalShiftFor(-d.decimalPoint);
+            }
+            d.leftShift(shift);
+            exp2 -= static_cast<int>(shift);
+            if (d.numDigits == 0) return 0;
+        }
+        exp2--; // [1/2, 1) → [1, 2)
+
+        // 2. 비정규수 영역이면 최소 지수까지 추가로 나눔
+        while (minExponent + 1 > exp2) {
+            unsigned int n = static_cast<unsigned int>(minExponent + 1 - exp2);
+            if (n > DECIMAL_MAX_SHIFT) n = DECIMAL_MAX_SHIFT;
+            d.rightShift(n);
+            exp2 += static_cast<int>(n);
+        }
+        if (exp2 - minExponent >= infinitePower) { overflow = true; return infBits; }
+
+        // 3. 가수 비트만큼 올린 뒤 정수부를 반올림하여 가수를 얻음
+        d.leftShift(static_cast<unsigned int>(mantissaBits + 1));
+        uint64_t mantissa = d.roundedInteger();
+        if (mantissa >= (uint64_t(1) << (mantissaBits + 1))) { // 반올림으로 자리 올림 발생
+            d.rightShift(1);
+            exp2 += 1;
+            mantissa = d.roundedInteger();
+            if (exp2 - minExponent >= infinitePower) { overflow = true; return infBits; }
+        }
+        int power2 = exp2 - minExponent;
+        if (mantissa < (uint64_t(1) << mantissaBits)) power2--; // 비정규수
+        return (static_cast<uint64_t>(power2) << mantissaBits) | (mantissa & ((uint64_t(1) << mantissaBits) - 1));
+    }
+
+    /// [diyFpToBits] 근사 곱셈으로 IEEE-754 비트(부호 제외)를 구합니다. (Grisu 캐시 거듭제곱 재사용)
+    ///
+    /// 오차를 1/8 ulp 단위로 추적하여 반올림 방향이 오차 범위 안에서 확정될 때만 성공합니다.
+    /// 확정할 수 없는 경계 사례(약 0.1% 미만)는 호출자가 정확한 10진 변환으로 다시 계산합니다.
+    ///
+    /// @param inexact 19자리를 넘는 숫자가 버려졌는지 여부 (가수 오차 1 ulp로 반영)
+    /// @return true: bits 확정, false: 정밀도 부족 또는 캐시 범위 밖
+    bool diyFpToBits(uint64_t mantissa, int exp10, bool inexact, int mantissaBits, int exponentBias, int infinitePower,
+                     uint64_t& bits, bool& overflow) {
+        constexpr int DENOMINATOR_LOG = 3;
+        constexpr int DENOMINATOR = 1 << DENOMINATOR_LOG;
+        const int lastK = CACHED_POWERS_MIN_K + CACHED_POWERS_STEP * static_cast<int>(sizeof(cachedPowers) / sizeof(cachedPowers[0]) - 1);
+        if (exp10 < CACHED_POWERS_MIN_K || exp10 >= lastK) return false;
+
+        // 1. 가수 정규화 (오차도 함께 스케일)
+        DiyFp input = diyNormalize(DiyFp{mantissa, 0});
+        // 정규화 이동량은 최대 63비트이므로 64비트로 추적 (inexact이면 가수가 19자리라 이동량이 작아 넘치지 않음)
+        uint64_t error = inexact ? DENOMINATOR : 0;
+        error <<= -input.e;
+
+        // 2. 10^k (캐시, 0.5 ulp 오차) × 10^adjust (정확) 로 분해하여 곱셈
+        const int index = (exp10 - CACHED_POWERS_MIN_K) / CACHED_POWERS_STEP;
+        const CachedPower& c = cachedPowers[index];
+        const int adjust = exp10 - c.k;
+        if (adjust > 0) {
+            static const uint32_t smallPowers[] = {1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u};
+            input = diyMul(input, diyNormalize(DiyFp{smallPowers[adjust], 0}));
+            error += DENOMINATOR / 2; // 곱셈 반올림
+        }
+        input = diyMul(input, DiyFp{c.f, c.e});
+        error += DENOMINATOR / 2 + (error == 0 ? 0 : 1) + DENOMINATOR / 2; // 캐시 오차 + 교차항 + 곱셈 반올림
+        const int oldE = input.e;
+        input = diyNormalize(input);
+        error <<= oldE - input.e;
+
+        // 3. 목표 유효 비트 수(비정규수는 더 적음)를 넘는 하위 비트가 반올림 판단 대상
+        const int denormalExponent = 1 - exponentBias;
+        const int orderOfMagnitude = 64 + input.e;
+        int significandSize = mantissaBits + 1;
+        if (orderOfMagnitude < denormalExponent + significandSize) {
+            significandSize = (orderOfMagnitude <= denormalExponent) ? 0 : orderOfMagnitude - denormalExponent;
+        }
+        int precisionBits = 64 - significandSize;
+        if (precisionBits + DENOMINATOR_LOG >= 64) {
+            const int shift = precisionBits + DENOMINATOR_LOG - 64 + 1;
+            input.f >>= shift;
+            input.e += shift;
+            error = (error >> shift) + 1 + DENOMINATOR;
+            precisionBits -= shift;
+        }
+        const uint64_t lowBits = (input.f & ((uint64_t(1) << precisionBits) - 1)) * DENOMINATOR;
+        const uint64_t halfWay = (uint64_t(1) << (precisionBits - 1)) * DENOMINATOR;
+        if (halfWay - error < lowBits && lowBits < halfWay + error) return false; // 오차 범위 안에 반올림 경계가 있음
+
+        // 4. 반올림 후 지수 필드를 구성 (반올림 자리 올림, 비정규수, 무한대 처리)
+        uint64_t significand = (input.f >> precisionBits) + (lowBits >= halfWay + error ? 1 : 0);
+        int exponent = input.e + precisionBits;
+        const uint64_t hiddenBit = uint64_t(1) << mantissaBits;
+        while (significand >= (hiddenBit << 1)) { significand >>= 1; exponent++; }
+        if (exponent >= infinitePower - exponentBias) { overflow = true; bits = static_cast<uint64_t>(infinitePower) << mantissaBits; return true; }
+        if (exponent < denormalExponent || significand == 0) { bits = 0; return true; }
+        while (exponent > denormalExponent && (significand & hiddenBit) == 0) { significand <<= 1; exponent--; }
+        const uint64_t biased = (exponent == denormalExponent && (significand & hiddenBit) == 0) ? 0 : static_cast<uint64_t>(exponent + exponentBias);
+        bits = (significand & (hiddenBit - 1)) | (biased << mantissaBits);
+        return true;
+    }
+
+    /// [RealScan] 실수 문자열 1차 스캔 결과 (검증 + Clinger 고속 경로용 가수/지수)
+    struct RealScan {
+        const char* end;          // 소비한 마지막 위치 다음
+        const char* mantBegin;    // 가수(숫자와 '.') 시작
+        const char* mantEnd;      // 가수 끝
+        uint64_t mantissa;        // 앞쪽 유효 숫자 최대 19자리
+        int exp10;                // 값 ≈ mantissa × 10^exp10
+        int explicitExp;          // 'e' 뒤의 지수
+        bool negative;
+        bool inexact;             // 19자리를 넘는 0이 아닌 숫자가 버려짐
+        char special;             // 'i': inf, 'n': nan, 0: 일반 숫자
+    };
+
+    /// 대소문자를 무시하고 [p, last)가 word로 시작하는지 확인합니다.
+    bool startsWithWord(const char* p, const char* last, const char* word) {
+        for (; *word; ++word, ++p) {
+            if (p >= last || (*p | 0x20) != *word) return false;
+        }
+        return true;
+    }
+
+    /// 단일 패스로 실수 형식을 검증하고 Clinger 경로에 필요한 값을 모읍니다. (형식 오류 시 false)
+    bool scanReal(const char* first, const char* last, RealScan& s) {
+        const char* p = first;
+        s.negative = false;
+        s.inexact = false;
+        s.special = 0;
+        s.mantissa = 0;
+        s.exp10 = 0;
+        s.explicitExp = 0;
+        if (p < last && (*p == '-' || *p == '+')) { s.negative = (*p == '-'); ++p; }
+
+        // 1. inf / infinity / nan (대소문자 무시)
+        if (startsWithWord(p, last, "inf")) {
+            s.special = 'i';
+            s.end = startsWithWord(p, last, "infinity") ? p + 8 : p + 3;
+            return true;
+        }
+        if (startsWithWord(p, last, "nan")) {
+            s.special = 'n';
+            s.end = p + 3;
+            return true;
+        }
+
+        // 2. 가수: 앞쪽 0은 건너뛰고 유효 숫자 19자리까지 누적
+        s.mantBegin = p;
+        int significant = 0;
+        bool anyDigit = false;
+        bool seenDot = false;
+        for (; p < last; ++p) {
+            const char c = *p;
+            if (c == '.' && !seenDot) { seenDot = true; continue; }
+            const unsigned int d = static_cast<unsigned int>(c - '0');
+            if (d > 9) break;
+            anyDigit = true;
+            if (significant == 0 && d == 0) {
+                if (seenDot) s.exp10--;
+                continue;
+            }
+            if (significant < 19) {
+                s.mantissa = s.mantissa * 10 + d;
+                significant++;
+                if (seenDot) s.exp10--;
+            } else {
+                if (!seenDot) s.exp10++;
+                if (d != 0) s.inexact = true;
+            }
+        }
+        if (!anyDigit) return false;
+        s.mantEnd = p;
+
+        // 3. 지수부 (숫자가 뒤따를 때만 소비, 범위는 ±99999로 포화)
+        if (p < last && (*p | 0x20) == 'e') {
+            const char* q = p + 1;
+            bool expNegative = false;
+            if (q < last && (*q == '-' || *q == '+')) { expNegative = (*q == '-'); ++q; }
+            if (q < last && static_cast<unsigned int>(*q - '0') <= 9) {
+                int e = 0;
+                for (; q < last && static_cast<unsigned int>(*q - '0') <= 9; ++q) {
+                    if (e < 99999) e = e * 10 + (*q - '0');
+                }
+                s.explicitExp = expNegative ? -e : e;
+                s.exp10 += s.explicitExp;
+                p = q;
+            }
+        }
+        s.end = p;
+        return true;
+    }
+
+    /// 스캔한 가수를 DecimalDigits로 옮깁니다. (Clinger 경로로 처리할 수 없을 때만 호출)
+    void fillDecimal(const RealScan& s, DecimalDigits& d) {
+        d.numDigits = 0;
+        d.decimalPoint = 0;
+        d.truncated = false;
+        bool seenDot = false;
+        for (const char* p = s.mantBegin; p < s.mantEnd; ++p) {
+            if (*p == '.') { seenDot = true; continue; }
+            const uint8_t v = static_cast<uint8_t>(*p - '0');
+            if (d.numDigits == 0 && v == 0) {
+                if (seenDot) d.decimalPoint--;
+                continue;
+            }
+            if (!seenDot) d.decimalPoint++;
+            if (d.numDigits < DecimalDigits::MAX_DIGITS) d.digits[d.numDigits++] = v;
+            else if (v != 0) d.truncated = true;
+        }
+        d.decimalPoint += s.explicitExp;
+        d.trim();
+    }
+
+    /// Clinger 고속 경로용 정확한 10의 거듭제곱 (double: 10^22까지, float: 10^10까지 오차 없음)
+    const double exactPow10d[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+    const float exactPow10f[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+
+    inline const double* choosePow10(double*) { return exactPow10d; }
+    inline const float* choosePow10(float*) { return exactPow10f; }
+
+    /// [parseRealCore] 실수 파싱 공통 구현 (Float: float/double, Bits: 같은 크기의 부호 없는 정수)
+    template<typename Float, typename Bits>
+    cms::string::ParseResult parseRealCore(const char* first, const char* last, Float& out) {
+        using cms::string::ParseErrc;
+        constexpr bool IS_DOUBLE = sizeof(Float) == 8;
+        constexpr int MANTISSA_BITS = IS_DOUBLE ? 52 : 23;
+        constexpr int MIN_EXPONENT = IS_DOUBLE ? -1023 : -127;
+        constexpr int INFINITE_POWER = IS_DOUBLE ? 0x7FF : 0xFF;
+        constexpr int SIGN_SHIFT = IS_DOUBLE ? 63 : 31;
+
+        RealScan s;
+        if (!first || first >= last || !scanReal(first, last, s)) return {first, ParseErrc::InvalidArgument};
+
+        Bits bits;
+        if (s.special) {
+            bits = static_cast<Bits>(static_cast<Bits>(INFINITE_POWER) << MANTISSA_BITS);
+            if (s.special == 'n') bits |= static_cast<Bits>(Bits(1) << (MANTISSA_BITS - 1)); // quiet NaN
+        } else if (s.mantissa == 0) {
+            bits = 0;
+        } else {
+            // 1. Clinger 고속 경로: 가수와 10^|e|가 모두 정확하면 한 번의 연산 결과가 올바르게 반올림된 값
+            constexpr uint64_t MAX_EXACT_MANTISSA = uint64_t(1) << (MANTISSA_BITS + 1);
+            constexpr int MAX_EXACT_POW10 = IS_DOUBLE ? 22 : 10;
+            if (!s.inexact && s.mantissa <= MAX_EXACT_MANTISSA && s.exp10 >= -MAX_EXACT_POW10 && s.exp10 <= MAX_EXACT_POW10) {
+                Float v = static_cast<Float>(s.mantissa);
+                const Float* const pow10 = choosePow10(static_cast<Float*>(nullptr));
+                v = (s.exp10 < 0) ? v / pow10[-s.exp10] : v * pow10[s.exp10];
+                out = s.negative ? -v : v;
+                return {s.end, ParseErrc::Ok};
+            }
+
+            // 2. 64비트 근사 곱셈 (반올림 방향이 확정되는 대부분의 경우)
+            uint64_t wide = 0;
+            bool overflow = false;
+            if (!diyFpToBits(s.mantissa, s.exp10, s.inexact, MANTISSA_BITS, -MIN_EXPONENT + MANTISSA_BITS, INFINITE_POWER, wide, overflow)) {
+                // 3. 정확한 10진 → 2진 변환 (정수 연산만 사용)
+                DecimalDigits d;
+                fillDecimal(s, d);
+                wide = decimalToBits(d, MANTISSA_BITS, MIN_EXPONENT, INFINITE_POWER, overflow);
+            }
+            if (overflow) return {s.end, ParseErrc::OutOfRange};
+            bits = static_cast<Bits>(wide);
+        }
+        if (s.negative) bits |= static_cast<Bits>(Bits(1) << SIGN_SHIFT);
+        memcpy(&out, &bits, sizeof(out));
+        return {s.end, ParseErrc::Ok};
+    }
+
+    // ----------------------------------------------------------------------------------------------
+    // [UTF-8 스캔 커널] 워드(SWAR) / SIMD 단위로 후속 바이트(10xxxxxx)를 세어 글자 수를 계산합니다.
+    // 모든 커널은 길이가 확정된 구간만 읽으며, NUL 이후 메모리를 건드리지 않습니다.
+    // ----------------------------------------------------------------------------------------------
+
+    using SwarWord = uintptr_t; // ESP32: 32비트, PC: 64비트
+    static constexpr SwarWord SWAR_ONES = ~static_cast<SwarWord>(0) / 0xFF; // 0x0101...01
+    static constexpr SwarWord SWAR_HIGH = SWAR_ONES * 0x80;                  // 0x8080...80
+
+    inline SwarWord loadWord(const unsigned char* p) {
+        SwarWord w;
+        memcpy(&w, p, sizeof(w)); // 비정렬 주소에서도 안전한 로드
+        return w;
+    }
+
+    /// 후속 바이트(상위 2비트 '10') 위치의 최상위 비트만 남긴 마스크
+    inline SwarWord continuationMask(SwarWord w) { return w & ~(w << 1) & SWAR_HIGH; }
+
+    /// 각 바이트 최상위 비트의 개수 (곱셈으로 모든 바이트를 최상위 바이트에 누적)
+    inline size_t countHighBits(SwarWord m) {
+        return static_cast<size_t>(((m >> 7) * SWAR_ONES) >> ((sizeof(SwarWord) - 1) * 8));
+    }
+
+#if defined(CMS_UTF8_SSE2) || defined(CMS_UTF8_NEON)
+    /// 16바이트 블록의 글자 시작 바이트 수
+    inline size_t blockCharStarts(const unsigned char* p) {
+#if defined(CMS_UTF8_SSE2)
+        // 부호 있는 비교: 0x80~0xBF(-128~-65)만 0xC0(-64)보다 작음
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const int cont = _mm_movemask_epi8(_mm_cmplt_epi8(v, _mm_set1_epi8(static_cast<char>(0xC0))));
+        return 16 - static_cast<size_t>(__builtin_popcount(static_cast<unsigned>(cont)));
+#else
+        const int8x16_t v = vld1q_s8(reinterpret_cast<const int8_t*>(p));
+        const uint8x16_t cont = vshrq_n_u8(vcltq_s8(v, vdupq_n_s8(-64)), 7);
+        return 16 - static_cast<size_t>(vaddvq_u8(cont));
+#endif
+    }
+
+    /// 16바이트 블록이 모두 ASCII인지 확인
+    inline bool blockIsAscii(const unsigned char* p) {
+#if defined(CMS_UTF8_SSE2)
+        return _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) == 0;
+#else
+        return vmaxvq_u8(vld1q_u8(p)) < 0x80;
+#endif
+    }
+#endif
+
+    /// [countCharStarts] len 바이트 구간의 UTF-8 글자 수 (후속 바이트가 아닌 바이트 수)
+    size_t countCharStarts(const unsigned char* p, size_t len) {
         size_t count = 0;
+        size_t i = 0;
+#if defined(CMS_UTF8_SSE2) || defined(CMS_UTF8_NEON)
+        for (; i + 16 <= len; i += 16) count += blockCharStarts(p + i);
+#endif
+        for (; i + sizeof(SwarWord) <= len; i += sizeof(SwarWord)) {
+            count += sizeof(SwarWord) - countHighBits(continuationMask(loadWord(p + i)));
+        }
+        for (; i < len; ++i) {
+            if ((p[i] & 0xC0) != 0x80) count++;
+        }
+        return count;
+    }
 
-        // 2. 문자열의 끝을 만나거나, 원하는 문자 인덱스(charIdx)에 도달할 때까지 바이트를 훑습니다.
-        while (*p && count < charIdx) {
-            // UTF-8 규칙: 바이트의 상위 2비트가 '10'이면 이전 문자에 딸린 '후속 바이트'입니다.
-            // 따라서 '10'이 아닌 경우에만 새로운 문자가 시작된 것으로 보고 카운트를 올립니다.
-            if ((*p & 0xC0) != 0x80) count++;
-            p++;
+    /// [advanceChars] charIdx번째 글자가 시작되는 바이트 오프셋 (없으면 len)
+    ///
+    /// 블록 안의 글자 시작 바이트 수를 한 번에 세어, 목표 글자가 블록 밖에 있으면 블록 전체를 건너뜁니다.
+    size_t advanceChars(const unsigned char* p, size_t len, size_t charIdx) {
+        size_t count = 0;
+        size_t i = 0;
+#if defined(CMS_UTF8_SSE2) || defined(CMS_UTF8_NEON)
+        for (; i + 16 <= len; i += 16) {
+            const size_t c = blockCharStarts(p + i);
+            if (count + c > charIdx) break;
+            count += c;
+        }
+#endif
+        for (; i + sizeof(SwarWord) <= len; i += sizeof(SwarWord)) {
+            const size_t c = sizeof(SwarWord) - countHighBits(continuationMask(loadWord(p + i)));
+            if (count + c > charIdx) break;
+            count += c;
+        }
+        for (; i < len; ++i) {
+            if ((p[i] & 0xC0) != 0x80) {
+                if (count == charIdx) return i;
+                count++;
+            }
         }
-        // 3. 만약 루프가 끝났는데 p가 후속 바이트 중간을 가리키고 있다면, 다음 문자의 시작점까지 전진합니다.
-        while (*p && (*p & 0xC0) == 0x80) p++;
+        return len;
+    }
+
+    /// [skipAscii] [p, end) 구간에서 첫 비 ASCII 바이트 위치 (없으면 end)
+    const unsigned char* skipAscii(const unsigned char* p, const unsigned char* end) {
+#if defined(CMS_UTF8_SSE2) || defined(CMS_UTF8_NEON)
+        while (end - p >= 16 && blockIsAscii(p)) p += 16;
+#endif
+        while (static_cast<size_t>(end - p) >= sizeof(SwarWord) && (loadWord(p) & SWAR_HIGH) == 0) p += sizeof(SwarWord);
+        while (p < end && *p < 0x80) p++;
         return p;
     }
+
+    /// [findUtf8CharStart] UTF-8 논리적 인덱스의 물리적 주소 탐색
+    ///
+    /// 멀티바이트 환경에서 'n번째 글자'가 실제 메모리의 어디에 위치하는지 정확히 찾기 위해 필요합니다.
+    /// UTF-8의 후속 바이트 비트 패턴(10xxxxxx)을 워드/블록 단위로 세어 빠르게 건너뜁니다.
+    ///
+    /// @param str 검색할 UTF-8 문자열
+    /// @param len 문자열의 바이트 길이
+    /// @param charIdx 찾고자 하는 글자의 논리적 위치 (0부터 시작)
+    /// @return 해당 글자가 시작되는 메모리 주소 (범위를 벗어나면 문자열 끝)
+    const char* findUtf8CharStart(const char* str, size_t len, size_t charIdx) {
+        if (!str) return nullptr;
+        return str + advanceChars(reinterpret_cast<const unsigned char*>(str), len, charIdx);
+    }
 }
 
 namespace cms {
@@ -227,43 +1104,214 @@ namespace cms {
         /// [strcasestr] 대소문자 무시 부분 문자열 검색
         ///
         /// Why: 표준 라이브러리에 없는 경우가 많고, 임베디드에서 대소문자 구분 없는 명령 파싱에 필수적입니다.
-        /// How: 패턴이 짧을 경우 KMP 알고리즘을 사용하여 O(n+m) 성능을 보장하며, 길면 Naive 방식으로 전환합니다.
+        /// How: ignoreCase Needle(Two-Way + Horspool)을 만들어 한 번 검색하므로 패턴 길이와 무관하게 O(n+m)을 보장합니다.
         const char* strcasestr(const char* haystack, const char* needle) {
             if (!*needle) return haystack;
-            size_t m = strlen(needle);
-
-            // [최적화] 패턴이 짧은 경우 KMP 알고리즘 적용 (LPS 테이블 스택 할당)
-            if (m <= 64) {
-                int16_t lps[64];
-                computeLPS(needle, m, lps);
-
-                size_t i = 0; // haystack index
-                size_t j = 0; // needle index
-                while (haystack[i]) {
-                    if (cms::string::toLower((unsigned char)haystack[i]) == cms::string::toLower((unsigned char)needle[j])) {
-                        i++; j++;
-                    }
-                    if (j == m) return &haystack[i - m];
-                    else if (haystack[i] && cms::string::toLower((unsigned char)haystack[i]) != cms::string::toLower((unsigned char)needle[j])) {
-                        if (j != 0) j = lps[j - 1];
-                        else i++;
-                    }
+            const int off = Needle(needle, strlen(needle), true).search(haystack, strlen(haystack));
+            return (off < 0) ? nullptr : haystack + off;
+        }
+
+        /// [Needle] 검색 패턴 전처리
+        ///
+        /// Why: strstr/KMP는 호출마다 패턴을 다시 분석하고, 역방향 탐색을 지원하지 않습니다.
+        /// How: 패턴(역방향이면 뒤집힌 패턴)의 최대 접미사를 두 가지 사전 순서로 구해 임계 분해 위치와 주기를 확정하고,
+        ///      각 바이트가 패턴에서 마지막으로 나타난 위치로 건너뛰기 테이블을 채웁니다.
+        Needle::Needle(const char* pattern, size_t len, bool ignoreCase, Direction dir) noexcept
+            : _pat(pattern), _len(pattern ? len : 0), _ms(0), _period(1), _memory0(0),
+              _ignoreCase(ignoreCase), _reverse(dir == Direction::Reverse) {
+            const size_t l = _len;
+            auto at = [this, l](size_t i) -> unsigned char {
+                const char c = _reverse ? _pat[l - 1 - i] : _pat[i];
+                return _ignoreCase ? foldByte<true>(c) : foldByte<false>(c);
+            };
+
+            // 1. 건너뛰기 테이블: 창의 마지막 바이트가 패턴에서 마지막으로 나타난 위치까지의 거리
+            memset(_skip, (l < 255) ? static_cast<int>(l) : 255, sizeof(_skip));
+            for (size_t i = 0; i < l; ++i) {
+                const size_t d = l - 1 - i;
+                _skip[at(i)] = static_cast<uint8_t>((d < 255) ? d : 255);
+            }
+            if (l < 2) return;
+
+            // 2. 최대 접미사 (오름차순 비교). ip는 -1에서 시작하므로 부호 없는 랩어라운드를 그대로 이용합니다.
+            size_t ip = static_cast<size_t>(-1), jp = 0, k = 1, p = 1;
+            while (jp + k < l) {
+                const unsigned char a = at(ip + k), b = at(jp + k);
+                if (a == b) {
+                    if (k == p) { jp += p; k = 1; }
+                    else k++;
+                } else if (a > b) {
+                    jp += k; k = 1; p = jp - ip;
+                } else {
+                    ip = jp++; k = p = 1;
+                }
+            }
+            size_t ms = ip;
+            const size_t p0 = p;
+
+            // 3. 최대 접미사 (내림차순 비교) 후 더 늦게 시작하는 쪽을 임계 분해 위치로 채택
+            ip = static_cast<size_t>(-1); jp = 0; k = p = 1;
+            while (jp + k < l) {
+                const unsigned char a = at(ip + k), b = at(jp + k);
+                if (a == b) {
+                    if (k == p) { jp += p; k = 1; }
+                    else k++;
+                } else if (a < b) {
+                    jp += k; k = 1; p = jp - ip;
+                } else {
+                    ip = jp++; k = p = 1;
                 }
+            }
+            if (ip + 1 > ms + 1) ms = ip;
+            else p = p0;
+
+            // 4. 주기성 판정: 왼쪽 조각이 주기 p만큼 뒤에서 반복되면 주기적 패턴 (이동 후 일치 구간 기억)
+            bool periodic = true;
+            for (size_t i = 0; i < ms + 1; ++i) {
+                if (at(i) != at(i + p)) { periodic = false; break; }
+            }
+            if (periodic) {
+                _memory0 = l - p;
             } else {
-                // 패턴이 너무 긴 경우(64바이트 초과) 스택 보호를 위해 Naive 방식으로 폴백
-                char first = cms::string::toLower((unsigned char)*needle);
-                for (; *haystack; haystack++) {
-                    if (cms::string::toLower((unsigned char)*haystack) == first) {
-                        const char* h = haystack + 1;
-                        const char* n = needle + 1;
-                        while (*h && *n && cms::string::toLower((unsigned char)*h) == cms::string::toLower((unsigned char)*n)) {
-                            h++; n++;
-                        }
-                        if (!*n) return haystack;
+                const size_t right = l - ms - 1;
+                p = ((ms + 1 > right) ? ms + 1 : right + 1);
+                _memory0 = 0;
+            }
+            _ms = ms;
+            _period = p;
+        }
+
+        int Needle::search(const char* hay, size_t hayLen) const noexcept {
+            if (!hay || _len == 0 || _len > hayLen) return -1;
+
+            if (_len == 1) {
+                // 단일 바이트는 테이블 없이 직접 스캔 (정방향 대소문자 구분은 memchr)
+                const unsigned char want = _ignoreCase ? foldByte<true>(*_pat) : foldByte<false>(*_pat);
+                if (!_reverse) {
+                    if (!_ignoreCase) {
+                        const void* hit = memchr(hay, want, hayLen);
+                        return hit ? static_cast<int>(static_cast<const char*>(hit) - hay) : -1;
+                    }
+                    for (size_t i = 0; i < hayLen; ++i) {
+                        if (foldByte<true>(hay[i]) == want) return static_cast<int>(i);
                     }
+                    return -1;
+                }
+                for (size_t i = hayLen; i-- > 0;) {
+                    const unsigned char c = _ignoreCase ? foldByte<true>(hay[i]) : foldByte<false>(hay[i]);
+                    if (c == want) return static_cast<int>(i);
+                }
+                return -1;
+            }
+
+            if (_reverse) {
+                return _ignoreCase ? searchImpl<true, true>(hay, hayLen) : searchImpl<true, false>(hay, hayLen);
+            }
+            return _ignoreCase ? searchImpl<false, true>(hay, hayLen) : searchImpl<false, false>(hay, hayLen);
+        }
+
+        /// [Needle::searchImpl] Two-Way 탐색 루프
+        ///
+        /// 역방향 탐색은 패턴과 텍스트를 모두 뒤집어 본 좌표계에서 같은 알고리즘을 수행한 뒤 오프셋을 되돌립니다.
+        /// 1) 창의 마지막 바이트로 건너뛰기 테이블을 조회해 불일치 구간을 즉시 넘기고,
+        /// 2) 오른쪽 조각을 왼쪽부터, 왼쪽 조각을 오른쪽부터 비교하며,
+        /// 3) 주기적 패턴은 이미 일치한 접두(mem)를 다시 비교하지 않아 전체 비교 횟수가 O(n)으로 유지됩니다.
+        template<bool REV, bool ICASE>
+        int Needle::searchImpl(const char* hay, size_t hayLen) const noexcept {
+            const size_t l = _len;
+            const char* const pat = _pat;
+            auto n = [pat, l](size_t i) { return foldByte<ICASE>(REV ? pat[l - 1 - i] : pat[i]); };
+            auto t = [hay, hayLen](size_t i) { return foldByte<ICASE>(REV ? hay[hayLen - 1 - i] : hay[i]); };
+
+            const size_t ms = _ms;
+            size_t h = 0;
+            size_t mem = 0;
+            while (h + l <= hayLen) {
+                // 1. 창 마지막 바이트 검사 (Horspool)
+                size_t k = _skip[t(h + l - 1)];
+                if (k) {
+                    if (k < mem) k = mem;
+                    h += k;
+                    mem = 0;
+                    continue;
+                }
+
+                // 2. 오른쪽 조각 비교
+                for (k = (ms + 1 > mem) ? ms + 1 : mem; k < l && n(k) == t(h + k); k++);
+                if (k < l) {
+                    h += k - ms;
+                    mem = 0;
+                    continue;
+                }
+
+                // 3. 왼쪽 조각 비교
+                for (k = ms + 1; k > mem && n(k - 1) == t(h + k - 1); k--);
+                if (k <= mem) {
+                    return static_cast<int>(REV ? hayLen - h - l : h);
+                }
+                h += _period;
+                mem = _memory0;
+            }
+            return -1;
+        }
+
+        /// [Tokenizer] 구분 문자 집합 비트맵 구성
+        Tokenizer::Tokenizer(const char* str, size_t len, const char* delimiters, char quote, char escape) noexcept
+            : _pos((str && len > 0) ? str : nullptr), _end(str ? str + len : nullptr), _stop{},
+              _quote(quote), _escape(escape), _delimiter('\0'), _quoted(false) {
+            if (delimiters) {
+                for (const unsigned char* d = reinterpret_cast<const unsigned char*>(delimiters); *d; ++d) {
+                    _stop[*d >> 5] |= 1u << (*d & 31);
+                }
+            }
+            // 따옴표/이스케이프도 같은 비트맵에 포함시켜 본문 루프를 비트 검사 한 번으로 유지
+            if (quote) _stop[(unsigned char)quote >> 5] |= 1u << ((unsigned char)quote & 31);
+            if (escape) _stop[(unsigned char)escape >> 5] |= 1u << ((unsigned char)escape & 31);
+        }
+
+        /// [Tokenizer::next] 다음 구분자까지 한 번만 전진
+        ///
+        /// 1) 멈춤 비트맵에 없는 바이트는 곧바로 건너뛰고,
+        /// 2) 이스케이프 문자는 다음 바이트와 함께, 따옴표는 구간 상태를 뒤집으며 소비하고,
+        /// 3) 따옴표 구간 밖의 구분자에서 토큰을 끝냅니다.
+        bool Tokenizer::next(Token& out) noexcept {
+            if (!_pos) return false;
+
+            const char* const start = _pos;
+            const char* p = start;
+            bool inQuote = false;
+            while (p < _end) {
+                const unsigned char c = (unsigned char)*p;
+                if (!isStop(c)) { ++p; continue; }
+                if (_escape && c == (unsigned char)_escape) {
+                    p = (_end - p > 1) ? p + 2 : _end;
+                    continue;
+                }
+                if (_quote && c == (unsigned char)_quote) {
+                    inQuote = !inQuote;
+                    ++p;
+                    continue;
                 }
+                if (!inQuote) break;
+                ++p;
+            }
+
+            out.ptr = start;
+            out.len = (size_t)(p - start);
+            _quoted = (_quote && out.len >= 2 && start[0] == _quote && p[-1] == _quote);
+            if (_quoted) {
+                out.ptr++;
+                out.len -= 2;
+            }
+
+            if (p < _end) {
+                _delimiter = *p;
+                _pos = p + 1;
+            } else {
+                _delimiter = '\0';
+                _pos = nullptr;
             }
-            return nullptr;
+            return true;
         }
 
         bool Token::equals(const Token& other, bool ignoreCase) const {
@@ -575,41 +1623,19 @@ namespace cms {
             return toFloat(str, strlen(str));
         }
 
-        // [최적화] NUL 종료되지 않은 문자열을 위한 실수 변환 로직
+        // NUL 종료되지 않은 문자열을 위한 실수 변환 (parse 코어 공유: 지수 표기 지원, 올바르게 반올림)
         double toFloat(const char* str, size_t len) {
             if (!str || len == 0) return 0.0;
 
-            size_t i = 0;
-            // 1. 공백 스킵
-            while (i < len && cms::string::isSpace((unsigned char)str[i])) i++;
-            if (i == len) return 0.0;
+            const char* first = str;
+            const char* const last = str + len;
+            // 1. 공백 스킵 (남은 문자는 기존 동작대로 무시)
+            while (first < last && cms::string::isSpace((unsigned char)*first)) first++;
 
-            // 2. 부호 처리
-            double sign = 1.0;
-            if (str[i] == '-') { sign = -1.0; i++; }
-            else if (str[i] == '+') { i++; }
-
-            // 3. 정수부 파싱
+            // 2. 변환 (실패 시 0.0)
             double val = 0.0;
-            while (i < len && cms::string::isDigit((unsigned char)str[i])) {
-                unsigned char c = (unsigned char)str[i];
-                val = val * 10.0 + (c - '0');
-                i++;
-            }
-
-            // 4. 소수부 파싱
-            if (i < len && str[i] == '.') {
-                i++;
-                double weight = 0.1;
-                while (i < len && cms::string::isDigit((unsigned char)str[i])) {
-                    unsigned char c = (unsigned char)str[i];
-                    val += (c - '0') * weight;
-                    weight /= 10.0;
-                    i++;
-                }
-            }
-
-            return val * sign;
+            if (!detail::parseReal(first, last, val)) return 0.0;
+            return val;
         }
 
         /// [isNumeric] 유효한 실수 형식 여부 확인
@@ -651,6 +1677,34 @@ namespace cms {
             return (i == len && digitCount > 0);
         }
 
+        namespace detail {
+            /// [parseInteger] 32비트 이하 정수 타입용 (64비트 나눗셈/곱셈을 피함)
+            ParseResult parseInteger(const char* first, const char* last, int base, uint32_t maxPositive,
+                                     uint32_t maxNegative, uint32_t& magnitude, bool& negative) {
+                return parseIntegerCore<uint32_t>(first, last, base, maxPositive, maxNegative, magnitude, negative);
+            }
+
+            ParseResult parseInteger(const char* first, const char* last, int base, uint64_t maxPositive,
+                                     uint64_t maxNegative, uint64_t& magnitude, bool& negative) {
+                return parseIntegerCore<uint64_t>(first, last, base, maxPositive, maxNegative, magnitude, negative);
+            }
+
+            /// [parseReal] float은 float 연산으로 직접 반올림 (double 경유 시 이중 반올림 오차 방지)
+            ParseResult parseReal(const char* first, const char* last, float& out) {
+                return parseRealCore<float, uint32_t>(first, last, out);
+            }
+
+            ParseResult parseReal(const char* first, const char* last, double& out) {
+                return parseRealCore<double, uint64_t>(first, last, out);
+            }
+
+            void trimSpaces(const char*& first, const char*& last) {
+                if (!first) return;
+                while (first < last && isSpace((unsigned char)*first)) first++;
+                while (last > first && isSpace((unsigned char)last[-1])) last--;
+            }
+        } // namespace detail
+
         /// [utf8_strlen] UTF-8 논리적 글자 수 측정
         ///
         /// 바이트 크기가 아닌 실제 화면에 표시되는 글자 수를 계산합니다.
@@ -658,20 +1712,18 @@ namespace cms {
         /// @param str 측정할 UTF-8 문자열
         size_t utf8_strlen(const char* str) {
             if (!str) return 0;
+            // strlen(라이브러리 최적화) 후 워드/블록 단위로 후속 바이트를 세는 편이 바이트 루프보다 빠릅니다.
+            return countCharStarts(reinterpret_cast<const unsigned char*>(str), strlen(str));
+        }
 
-            const unsigned char* p = reinterpret_cast<const unsigned char*>(str);
-            size_t count = 0;
-
-            // 빠른 경로: 선행 ASCII 바이트가 연속되는 경우 한 번에 처리
-            while (*p && *p < 0x80) { count++; p++; }
-            if (!*p) return count;
+        size_t utf8_strlen(const char* str, size_t len) {
+            if (!str) return 0;
+            return countCharStarts(reinterpret_cast<const unsigned char*>(str), len);
+        }
 
-            // 비 ASCII가 섞여 있는 경우 기존 방식으로 남은 부분 처리
-            while (*p) {
-                if ((*p & 0xC0) != 0x80) count++;
-                p++;
-            }
-            return count;
+        size_t utf8ByteOffset(const char* str, size_t len, size_t charIdx) {
+            if (!str) return 0;
+            return advanceChars(reinterpret_cast<const unsigned char*>(str), len, charIdx);
         }
 
         /// [utf8SafeEnd] 안전한 UTF-8 종료 지점 계산
@@ -713,21 +1765,30 @@ namespace cms {
             if (!str || !target || targetLen == 0 || targetLen > strLen) return -1;
 
             // 1. 물리적 시작 주소 확보: n번째 '글자'가 시작되는 실제 메모리 주소를 계산합니다.
-            const char* startPtr = findUtf8CharStart(str, startChar);
-            if (!startPtr || *startPtr == '\0') return -1;
+            const char* startPtr = findUtf8CharStart(str, strLen, startChar);
+            const size_t startByte = startPtr - str;
 
-            // 2. 고속 메모리 스캔: strstr 또는 strcasestr을 사용하여 주소를 찾습니다.
-            const char* foundPtr = ignoreCase ? cms::string::strcasestr(startPtr, target) : strstr(startPtr, target);
-            if (!foundPtr) return -1;
+            // 2. 고속 메모리 스캔: 바이트 단위 탐색 코어에 위임합니다.
+            const int foundByte = findBytes(str, strLen, target, targetLen, startByte, ignoreCase);
+            if (foundByte < 0) return -1;
 
-            // 3. 논리적 인덱스 변환: startPtr부터 foundPtr까지의 글자 수를 계산하여 상대적 인덱스로 환산
-            size_t charOffset = 0;
-            for (const char* p = startPtr; p < foundPtr; ++p) {
-                if ((*p & 0xC0) != 0x80) charOffset++;
-            }
+            // 3. 논리적 인덱스 변환: startPtr부터 발견 지점까지의 글자 수를 계산하여 상대적 인덱스로 환산
+            const size_t charOffset = countCharStarts(reinterpret_cast<const unsigned char*>(startPtr), foundByte - startByte);
             return static_cast<int>(startChar + charOffset);
         }
 
+        /// [findBytes] 바이트 오프셋 기준 부분 문자열 탐색
+        ///
+        /// 글자 인덱스 변환 없이 물리적 위치만 다루므로, 글자 수 캐시로 인덱스 == 오프셋임을 아는 호출자가 사용합니다.
+        /// @param startByte 검색 시작 바이트 위치
+        /// @return 발견된 바이트 오프셋 (찾지 못하면 -1)
+        int findBytes(const char* str, size_t strLen, const char* target, size_t targetLen, size_t startByte, bool ignoreCase) {
+            if (!str || !target || targetLen == 0 || startByte >= strLen || targetLen > strLen - startByte) return -1;
+
+            const int off = Needle(target, targetLen, ignoreCase).search(str + startByte, strLen - startByte);
+            return (off < 0) ? -1 : static_cast<int>(startByte + off);
+        }
+
         /// [lastIndexOf] 부분 문자열의 마지막 논리적 위치 탐색
         ///
         /// 파일 확장자나 경로 구분자 등 마지막에 나타나는 패턴을 찾을 때 유용합니다.
@@ -740,26 +1801,20 @@ namespace cms {
         }
 
         int lastIndexOf(const char* str, size_t strLen, const char* target, size_t targetLen, bool ignoreCase) {
-            if (!str || !target || targetLen == 0 || targetLen > strLen) return -1;
-
-            const char* lastFound = nullptr;
-            const char* current = str;
-
-            while (true) {
-                const char* found = ignoreCase ? cms::string::strcasestr(current, target) : strstr(current, target);
-                if (!found) break;
-                lastFound = found;
-                current = found + 1; // 다음 검색은 발견된 위치 바로 다음부터 시작
-            }
-
-            if (!lastFound) return -1;
+            const int lastByte = findLastBytes(str, strLen, target, targetLen, ignoreCase);
+            if (lastByte < 0) return -1;
 
             // 처음부터 마지막 발견 지점까지 한 번만 스캔하여 인덱스 확정
-            size_t charIdx = 0;
-            for (const char* p = str; p < lastFound; ++p) {
-                if ((*p & 0xC0) != 0x80) charIdx++;
-            }
-            return static_cast<int>(charIdx);
+            return static_cast<int>(countCharStarts(reinterpret_cast<const unsigned char*>(str), lastByte));
+        }
+
+        /// [findLastBytes] 부분 문자열이 마지막으로 나타나는 바이트 오프셋 탐색
+        ///
+        /// 앞에서부터 반복 검색하지 않고 끝에서부터 역방향 Two-Way 탐색을 한 번만 수행합니다.
+        /// @return 마지막으로 발견된 바이트 오프셋 (찾지 못하면 -1)
+        int findLastBytes(const char* str, size_t strLen, const char* target, size_t targetLen, bool ignoreCase) {
+            if (!str || !target || targetLen == 0 || targetLen > strLen) return -1;
+            return Needle(target, targetLen, ignoreCase, Needle::Direction::Reverse).search(str, strLen);
         }
 
         /// [insert] 특정 글자 위치에 문자열 삽입
@@ -773,9 +1828,19 @@ namespace cms {
             if (!buffer || !src || *src == '\0') return curLen;
 
             // 1. 삽입 지점 확보: 삽입할 글자 인덱스를 물리적 메모리 주소로 변환합니다.
-            const char* targetPtr = findUtf8CharStart(buffer, charIdx);
-            size_t byteOffset = targetPtr - buffer;
-            size_t srcLen = strlen(src);
+            const char* targetPtr = findUtf8CharStart(buffer, curLen, charIdx);
+            return insertBytes(buffer, maxLen, curLen, targetPtr - buffer, src, strlen(src));
+        }
+
+        /// [insertBytes] 특정 바이트 위치에 데이터 삽입
+        ///
+        /// insert의 물리적 코어입니다. 글자 인덱스 변환을 이미 마친 호출자가 직접 사용할 수 있습니다.
+        /// @param byteOffset 삽입할 바이트 위치 (curLen 초과 시 끝에 추가)
+        /// @param srcLen 삽입할 바이트 수
+        /// @return 삽입 후의 새로운 문자열 바이트 길이
+        size_t insertBytes(char* buffer, size_t maxLen, size_t curLen, size_t byteOffset, const char* src, size_t srcLen) {
+            if (!buffer || !src || srcLen == 0) return curLen;
+            if (byteOffset > curLen) byteOffset = curLen;
 
             // 2. 오버플로우 방어: 삽입 후 전체 길이가 버퍼 크기를 넘지 않도록 삽입할 길이를 조정합니다.
             if (curLen + srcLen >= maxLen) {
@@ -807,17 +1872,28 @@ namespace cms {
             if (!buffer) return 0;
 
             // 1. 삭제 범위 계산: 삭제를 시작할 위치와 끝낼 위치의 물리적 주소를 각각 찾습니다.
-            const char* startPtr = findUtf8CharStart(buffer, charIdx);
+            const char* startPtr = findUtf8CharStart(buffer, curLen, charIdx);
             if (!startPtr || *startPtr == '\0') return curLen;
 
-            const char* endPtr = findUtf8CharStart(buffer, charIdx + charCount);
+            // 시작 지점부터 상대적으로 종료 지점 탐색 (중복 스캔 방지)
             size_t startOffset = startPtr - buffer;
-            size_t endOffset = endPtr - buffer;
+            const char* endPtr = findUtf8CharStart(startPtr, curLen - startOffset, charCount);
+            return removeBytes(buffer, curLen, startOffset, endPtr - buffer);
+        }
+
+        /// [removeBytes] 바이트 구간 [startByte, endByte) 삭제
+        ///
+        /// remove의 물리적 코어입니다. 범위는 curLen으로 제한됩니다.
+        /// @return 삭제 후의 새로운 문자열 바이트 길이
+        size_t removeBytes(char* buffer, size_t curLen, size_t startByte, size_t endByte) {
+            if (!buffer) return 0;
+            if (endByte > curLen) endByte = curLen;
+            if (startByte >= endByte) return curLen;
 
             // 2. 데이터 당기기: 삭제 구간 뒤에 있는 데이터를 앞으로 당겨서 삭제 구간을 덮어씁니다.
-            size_t tailLen = curLen - endOffset;
-            memmove(buffer + startOffset, buffer + endOffset, tailLen + 1);
-            return curLen - (endOffset - startOffset);
+            size_t tailLen = curLen - endByte;
+            memmove(buffer + startByte, buffer + endByte, tailLen + 1);
+            return curLen - (endByte - startByte);
         }
 
         /// [substring] 논리적 글자 범위 추출
@@ -829,20 +1905,25 @@ namespace cms {
         /// @param left 시작 글자 인덱스
         /// @param right 종료 글자 인덱스 (0일 경우 끝까지)
         size_t substring(const char* src, char* dest, size_t destLen, size_t left, size_t right) {
+            if (!src) return 0;
+            return substring(src, strlen(src), dest, destLen, left, right);
+        }
+
+        size_t substring(const char* src, size_t srcLen, char* dest, size_t destLen, size_t left, size_t right) {
             if (!src || !dest || destLen == 0) return 0;
             dest[0] = '\0';
 
             // 1. 추출 범위 계산: 잘라낼 시작점과 끝점의 물리적 주소를 찾습니다.
-            const char* startPtr = findUtf8CharStart(src, left);
+            const char* startPtr = findUtf8CharStart(src, srcLen, left);
             if (!startPtr || *startPtr == '\0') return 0;
 
             const char* endPtr;
             if (right == 0) {
-                endPtr = src + strlen(src);
+                endPtr = src + srcLen;
             } else {
                 if (right <= left) return 0;
                 // 시작 지점(startPtr)부터 상대적으로 종료 지점 탐색 (중복 스캔 방지)
-                endPtr = findUtf8CharStart(startPtr, right - left);
+                endPtr = findUtf8CharStart(startPtr, srcLen - (startPtr - src), right - left);
             }
 
             if (endPtr <= startPtr) return 0;
@@ -981,62 +2062,139 @@ namespace cms {
         /// @param buffer 대상 버퍼
         /// @param curLen [IN/OUT] 현재 길이
         /// @param val 변환할 정수값
-        /// @param width 최소 출력 너비
+        /// @param width 최소 출력 너비 (부호 포함)
         /// @param padChar 채움 문자 (예: '0', ' ')
         void appendInt(char* buffer, size_t maxLen, size_t& curLen, long val, int width, char padChar) {
+            appendInt64(buffer, maxLen, curLen, val, width, padChar);
+        }
+
+        /// [appendUInt] 부호 없는 정수값을 문자열로 변환하여 추가
+        ///
+        /// long 범위를 넘는 uint32 값(Uptime tick 등)을 부호 변환 없이 직렬화합니다.
+        void appendUInt(char* buffer, size_t maxLen, size_t& curLen, unsigned long val, int width, char padChar) {
+            if (curLen >= maxLen - 1) return;
+            appendDecimal(buffer, maxLen, curLen, val, false, width, padChar);
+        }
+
+        /// [appendInt64] 64비트 정수값을 문자열로 변환하여 추가
+        ///
+        /// 32비트 범위의 값은 32비트 나눗셈만 사용하므로 appendInt와 같은 속도로 동작합니다.
+        void appendInt64(char* buffer, size_t maxLen, size_t& curLen, long long val, int width, char padChar) {
             // 1. 방어적 코드: 버퍼가 이미 가득 찼다면 중단합니다.
             if (curLen >= maxLen - 1) return;
-            unsigned long uval;
-            if (val < 0) {
-                buffer[curLen++] = '-';
-                uval = static_cast<unsigned long>(-(val + 1)) + 1;
-                appendUIntInternal(buffer, maxLen, curLen, uval, width > 0 ? width - 1 : 0, padChar);
-            } else {
-                uval = static_cast<unsigned long>(val);
-                appendUIntInternal(buffer, maxLen, curLen, uval, width, padChar);
-            }
+            // 2. 최솟값의 부호 반전 오버플로우를 피하기 위해 (-(val + 1)) + 1로 절댓값을 구합니다.
+            const uint64_t uval = (val < 0) ? static_cast<uint64_t>(-(val + 1)) + 1 : static_cast<uint64_t>(val);
+            appendDecimal(buffer, maxLen, curLen, uval, val < 0, width, padChar);
+        }
+
+        /// [appendUInt64] 64비트 부호 없는 정수값을 문자열로 변환하여 추가
+        void appendUInt64(char* buffer, size_t maxLen, size_t& curLen, unsigned long long val, int width, char padChar) {
+            if (curLen >= maxLen - 1) return;
+            appendDecimal(buffer, maxLen, curLen, val, false, width, padChar);
+        }
+
+        /// [appendHex] 부호 없는 정수값을 16진수 문자열로 변환하여 추가
+        ///
+        /// 레지스터 값이나 주소를 고정 너비로 찍을 때 %08X 포맷 해석 없이 바로 직렬화합니다.
+        void appendHex(char* buffer, size_t maxLen, size_t& curLen, unsigned long val, int width, char padChar, bool uppercase) {
+            if (curLen >= maxLen - 1) return;
+            appendHexInternal(buffer, maxLen, curLen, val, width, padChar, uppercase);
         }
 
         /// [appendFloat] 실수값을 문자열로 변환하여 추가
         ///
-        /// 반올림 보정을 수행한 후 정수부와 소수부를 분리하여 순차적으로 결합합니다.
+        /// 반올림 보정을 수행한 후 정수부와 소수부를 분리하여 전체 길이를 확인한 뒤 한 번에 기록합니다.
+        /// NaN/Inf와 정수부가 64비트를 넘는 값은 appendShortest의 표기(nan, inf, 1e+20 등)로 대체합니다.
         /// @param buffer 대상 버퍼
         /// @param curLen [IN/OUT] 현재 길이
         /// @param val 변환할 실수값
         /// @param decimalPlaces 소수점 이하 출력 자리수
-        void appendFloat(char* buffer, size_t maxLen, size_t& curLen, double val, int decimalPlaces) {
+        /// @param width 최소 출력 너비 (appendDecimal과 같이 '0' 채움은 부호 뒤에 기록)
+        void appendFloat(char* buffer, size_t maxLen, size_t& curLen, double val, int decimalPlaces, int width, char padChar) {
             if (curLen >= maxLen - 1) return;
             if (decimalPlaces < 0) decimalPlaces = 0;
             if (decimalPlaces > 9) decimalPlaces = 9;
 
-            double dval = val;
-            if (dval < 0) {
-                buffer[curLen++] = '-';
-                dval = -dval;
-            }
+            const bool negative = val < 0;
+            double dval = negative ? -val : val;
 
             // 1. 반올림 보정 (나눗셈 대신 미리 계산된 테이블 사용)
             dval += roundingOffsets[decimalPlaces];
+            if (!(dval < 18446744073709551616.0)) { // 2^64 이상 또는 NaN
+                const size_t start = curLen;
+                appendShortest(buffer, maxLen, curLen, val);
+                const size_t written = curLen - start;
+                const size_t padLen = (width > 0 && static_cast<size_t>(width) > written) ? static_cast<size_t>(width) - written : 0;
+                if (written > 0 && padLen > 0 && curLen + padLen < maxLen) { // printf와 같이 공백으로만 채움
+                    memmove(buffer + start + padLen, buffer + start, written + 1);
+                    memset(buffer + start, ' ', padLen);
+                    curLen += padLen;
+                }
+                return;
+            }
 
-            // 2. 정수부 추출 및 추가
-            unsigned long intPart = (unsigned long)dval;
-            appendInt(buffer, maxLen, curLen, (long)intPart, 0, ' ');
-
-            // 3. 소수부 추출 및 추가 (정수 연산으로 변환하여 정밀도 확보)
-            if (decimalPlaces > 0 && curLen < maxLen - 1) {
-                buffer[curLen++] = '.';
+            // 2. 정수부 추출 (32비트 범위는 32비트 변환으로 소프트웨어 double 연산을 줄임)
+            const uint64_t intPart = (dval < 4294967296.0) ? static_cast<uint64_t>(static_cast<uint32_t>(dval))
+                                                            : static_cast<uint64_t>(dval);
 
-                double fracPart = dval - (double)intPart;
+            // 3. 소수부 추출 (정수 연산으로 변환하여 정밀도 확보)
+            uint32_t fracInt = 0;
+            if (decimalPlaces > 0) {
+                const double fracPart = dval - static_cast<double>(intPart);
                 // 부동 소수점 오차 보정을 위해 미세한 값(epsilon)을 더함 (double 정밀도에 맞춰 조정)
-                unsigned long fracInt = (unsigned long)(fracPart * powersOf10[decimalPlaces] + 1e-9);
-
+                fracInt = static_cast<uint32_t>(fracPart * powersOf10[decimalPlaces] + 1e-9);
                 // 자릿수 오버플로우 방지 (예: 0.999... 가 1.0이 되는 경우)
-                if (fracInt >= (unsigned long)powersOf10[decimalPlaces]) {
-                    fracInt = (unsigned long)powersOf10[decimalPlaces] - 1;
-                }
+                const uint32_t limit = static_cast<uint32_t>(powersOf10[decimalPlaces]);
+                if (fracInt >= limit) fracInt = limit - 1;
+            }
 
-                appendUIntInternal(buffer, maxLen, curLen, fracInt, decimalPlaces, '0');
+            // 4. 전체 길이 확인 후 기록 (공간이 부족하면 숫자가 잘려 보이지 않도록 기록하지 않음)
+            const size_t intLen = static_cast<size_t>(countDigits(intPart));
+            const size_t fracLen = (decimalPlaces > 0) ? static_cast<size_t>(decimalPlaces) + 1 : 0;
+            const size_t bodyLen = (negative ? 1 : 0) + intLen + fracLen;
+            const size_t totalLen = (width > 0 && static_cast<size_t>(width) > bodyLen) ? static_cast<size_t>(width) : bodyLen;
+            if (curLen + totalLen >= maxLen) return;
+
+            char* out = buffer + curLen;
+            const size_t padLen = totalLen - bodyLen;
+            if (padChar == '0') {
+                if (negative) *out++ = '-';
+                memset(out, '0', padLen);
+                out += padLen;
+            } else {
+                memset(out, padChar, padLen);
+                out += padLen;
+                if (negative) *out++ = '-';
             }
+            writeDecimal(out + intLen, intPart);
+            if (fracLen > 0) {
+                char* const fracBegin = out + intLen + 1;
+                fracBegin[-1] = '.';
+                char* const fracDigits = writeDecimal(fracBegin + decimalPlaces, fracInt);
+                memset(fracBegin, '0', static_cast<size_t>(fracDigits - fracBegin)); // 앞자리 0 채움
+            }
+            curLen += totalLen;
+            buffer[curLen] = '\0';
+        }
+
+        /// [appendShortest] double 값을 다시 읽으면 같은 값이 되는 가장 짧은 문자열로 추가
+        ///
+        /// 고정 자릿수와 달리 0.1은 "0.1", 1e-7은 "1e-07"처럼 필요한 만큼만 출력하며, 64비트 정수 연산만 사용합니다.
+        void appendShortest(char* buffer, size_t maxLen, size_t& curLen, double val) {
+            if (curLen >= maxLen - 1) return;
+            uint64_t bits;
+            memcpy(&bits, &val, sizeof(bits));
+            appendShortestBits(buffer, maxLen, curLen, bits, 53, 11);
+        }
+
+        /// [appendShortest] float 값을 float 정밀도 기준의 가장 짧은 문자열로 추가
+        ///
+        /// float의 반올림 경계를 사용하므로 23.1f는 "23.100000381..."이 아닌 "23.1"로 출력됩니다.
+        void appendShortest(char* buffer, size_t maxLen, size_t& curLen, float val) {
+            if (curLen >= maxLen - 1) return;
+            uint32_t bits;
+            memcpy(&bits, &val, sizeof(bits));
+            appendShortestBits(buffer, maxLen, curLen, bits, 24, 8);
         }
 
         /// [contains] 부분 문자열 포함 여부 확인
@@ -1054,7 +2212,7 @@ namespace cms {
             if (!str || !target || targetLen > strLen) return false;
             if (targetLen == 0) return true;
 
-            return (ignoreCase ? cms::string::strcasestr(str, target) : strstr(str, target)) != nullptr;
+            return Needle(target, targetLen, ignoreCase).search(str, strLen) >= 0;
         }
 
         /// [toUpperCase] 모든 영문 소문자를 대문자로 변환
@@ -1110,89 +2268,140 @@ namespace cms {
         /// [replace] 특정 패턴의 전체 치환
         ///
         /// 문자열 내의 모든 'from' 패턴을 찾아 'to' 문자열로 교체합니다.
-        /// 치환 후 길이가 변할 경우 memmove를 통해 데이터를 재배치하며 제자리에서 수정합니다.
+        /// 패턴은 한 번만 전처리(Needle)하여 모든 일치 검색에 재사용하며, 일치 개수와 무관하게 데이터를 한 번씩만 옮깁니다.
+        /// - 길이가 같거나 줄어드는 치환: 읽기/쓰기 위치를 분리한 단일 전진 패스
+        /// - 늘어나는 치환: 1단계에서 일치 개수로 최종 길이를 계산하고, 원본을 늘어날 만큼 뒤로 한 번 민 뒤 앞에서부터 써 내려감
         /// @param str 대상 문자열 (In-place 수정)
         /// @param curLen 현재 길이
         /// @param from 찾을 패턴
         /// @param to 바꿀 내용
         /// @param ignoreCase true일 경우 대소문자 무시
+        /// @note 결과가 버퍼에 다 들어가지 않으면 앞쪽부터 들어가는 만큼만 치환하고 나머지 일치는 그대로 둡니다.
         size_t replace(char* str, size_t maxLen, size_t curLen, const char* from, const char* to, bool ignoreCase) {
             if (!str || !from || !to || *from == '\0') return curLen;
 
-            size_t fromLen = strlen(from);
-            size_t toLen = strlen(to);
-            size_t currentLen = curLen;
-            char* p = str;
+            const size_t fromLen = strlen(from);
+            const size_t toLen = strlen(to);
+            const Needle needle(from, fromLen, ignoreCase);
+
+            if (toLen <= fromLen) {
+                // [최적화] 쓰기 위치는 항상 읽기 위치보다 앞에 있으므로 일치 사이 구간을 한 번씩만 당깁니다.
+                const char* end = str + curLen;
+                const char* r = str;
+                char* w = str;
+                int off;
+                while ((off = needle.search(r, end - r)) >= 0) {
+                    if (w != r) memmove(w, r, off);
+                    w += off;
+                    memcpy(w, to, toLen);
+                    w += toLen;
+                    r += off + fromLen;
+                }
+                const size_t tail = end - r;
+                if (w != r) memmove(w, r, tail);
+                w += tail;
+                *w = '\0';
+                return w - str;
+            }
+
+            // 1단계: 버퍼에 들어가는 범위 안에서 치환 횟수를 세어 최종 길이를 확정합니다.
+            const size_t diff = toLen - fromLen;
+            const size_t room = (maxLen > curLen + 1) ? (maxLen - 1 - curLen) : 0;
+            const size_t budget = room / diff;
+            size_t matches = 0;
             bool truncated = false;
+            for (size_t pos = 0;;) {
+                const int off = needle.search(str + pos, curLen - pos);
+                if (off < 0) break;
+                if (matches == budget) {
+                    truncated = true;
+                    break;
+                }
+                matches++;
+                pos += off + fromLen;
+            }
 
-            while (true) {
-                // [최적화] 단일 문자 검색 시 strchr 사용 (대소문자 구분 시)
-                if (ignoreCase) {
-                    p = (char*) cms::string::strcasestr(p, from);
-                } else {
-                    p = (fromLen == 1) ? strchr(p, *from) : strstr(p, from);
+            if (matches > 0) {
+                // 2단계: 원본 전체를 늘어날 길이만큼 한 번 뒤로 민 뒤 앞에서부터 결과를 씁니다.
+                // 남은 치환마다 diff씩 여유가 있으므로 쓰기 위치가 아직 읽지 않은 데이터를 덮지 않습니다.
+                const size_t grow = matches * diff;
+                memmove(str + grow, str, curLen + 1);
+                const char* r = str + grow;
+                const char* end = r + curLen;
+                char* w = str;
+                for (size_t i = 0; i < matches; ++i) {
+                    const int off = needle.search(r, end - r);
+                    memmove(w, r, off);
+                    w += off;
+                    memcpy(w, to, toLen);
+                    w += toLen;
+                    r += off + fromLen;
                 }
+                // 모든 치환을 마치면 w == r 이므로 남은 꼬리는 이미 제자리에 있습니다.
+                curLen += grow;
+            }
 
-                if (!p) break;
+            // [최적화] 실제로 버퍼 부족으로 치환을 멈춘 경우에만 UTF-8 정제 수행
+            return truncated ? sanitizeUtf8(str, maxLen) : curLen;
+        }
 
-                if (toLen > fromLen) {
-                    size_t diff = toLen - fromLen;
-                    if (currentLen + diff >= maxLen) {
-                        truncated = true;
-                        break;
-                    }
-                    // [최적화] 데이터가 늘어나는 경우만 memmove로 공간 확보
-                    memmove(p + toLen, p + fromLen, currentLen - ((p - str) + fromLen) + 1);
-                    currentLen += diff;
-                } else if (toLen < fromLen) {
-                    // [최적화] 데이터가 줄어드는 경우 memmove로 간격 좁힘
-                    size_t diff = fromLen - toLen;
-                    memmove(p + toLen, p + fromLen, currentLen - ((p - str) + fromLen) + 1);
-                    currentLen -= diff;
+        /// [replaceInto] 치환 결과를 별도 버퍼에 작성
+        ///
+        /// 원본을 건드리지 않고 일치 사이 구간과 'to'를 차례로 복사하므로 제자리 데이터 이동이 전혀 없습니다.
+        /// 대상 버퍼가 부족하면 UTF-8 글자 경계에서 잘라 멀티바이트 문자가 깨지지 않도록 합니다.
+        /// @param src 원본 문자열
+        /// @param srcLen 원본 바이트 길이
+        /// @param dest 결과를 저장할 버퍼 (src와 겹치면 안 됨)
+        /// @param destLen 결과 버퍼의 최대 크기 (널 종료 문자 포함)
+        /// @return 결과 문자열의 바이트 길이
+        size_t replaceInto(const char* src, size_t srcLen, char* dest, size_t destLen, const char* from, const char* to, bool ignoreCase) {
+            if (!dest || destLen == 0) return 0;
+            dest[0] = '\0';
+            if (!src) return 0;
+
+            const size_t cap = destLen - 1;
+            size_t w = 0;
+            bool full = false;
+            auto put = [&](const char* p, size_t n) {
+                if (n > cap - w) {
+                    n = cap - w;
+                    while (n > 0 && (static_cast<unsigned char>(p[n]) & 0xC0) == 0x80) --n; // 글자 경계까지 후퇴
+                    full = true;
+                }
+                memcpy(dest + w, p, n);
+                w += n;
+            };
+
+            size_t pos = 0;
+            if (from && *from && to) {
+                const size_t fromLen = strlen(from);
+                const size_t toLen = strlen(to);
+                const Needle needle(from, fromLen, ignoreCase);
+                int off;
+                while (!full && (off = needle.search(src + pos, srcLen - pos)) >= 0) {
+                    put(src + pos, off);
+                    if (!full) put(to, toLen);
+                    pos += off + fromLen;
                 }
-                // toLen == fromLen 인 경우는 memmove 없이 바로 memcpy 수행
-
-                memcpy(p, to, toLen);
-                p += toLen;
             }
+            if (!full) put(src + pos, srcLen - pos);
 
-            // [최적화] 실제로 버퍼 오버플로우로 인해 잘린 경우에만 UTF-8 정제 수행
-            return truncated ? sanitizeUtf8(str, maxLen) : currentLen;
+            dest[w] = '\0';
+            return w;
         }
 
-        /// [matches] POSIX 정규표현식 매칭 검사
+        /// [matches] 정규표현식 매칭 검사
         ///
         /// 복잡한 텍스트 패턴(이메일, IP 주소 등)과의 일치 여부를 검사합니다.
+        /// 스택 위의 cms::Regex<>로 컴파일하므로 힙을 사용하지 않으며 Native/ARDUINO 결과가 같습니다.
         /// @param pattern 정규표현식 패턴
-        /// @return true: 매칭 성공, false: 실패 또는 문법 오류
+        /// @return true: 매칭 성공, false: 실패 또는 문법 오류(용량 초과 포함)
+        /// @note 같은 패턴을 반복 검사한다면 cms::Regex 객체를 한 번 만들어 재사용하세요.
         bool matches(const char* str, const char* pattern) {
-#ifdef ARDUINO
-// Arduino는 기본 환경에 정규식이 없으므로 POSIX regex를 명시적으로 포함합니다.
-            // 1. 유효성 검사: 대상 문자열이나 패턴이 비어있으면 매칭 실패로 간주합니다.
+            // 유효성 검사: 대상 문자열이나 패턴이 비어있으면 매칭 실패로 간주합니다. (기존 POSIX 경로와 동일)
             if (!str || !pattern || *str == '\0') return false;
-
-            // 2. 정규식 객체 선언: POSIX 표준 정규식 정보를 담을 구조체입니다.
-            regex_t regex;
-
-            // 3. [컴파일 단계]: 텍스트 패턴을 엔진이 실행 가능한 바이너리 형태로 변환합니다.
-            // REG_EXTENDED: 확장 문법 사용, REG_NOSUB: 매칭 여부만 확인하여 메모리를 절약합니다.
-            int ret = regcomp(&regex, pattern, REG_EXTENDED | REG_NOSUB);
-
-            // 4. 컴파일 에러 체크: 패턴 문법에 오류가 있다면 즉시 false를 반환합니다.
-            if (ret != 0) return false;
-
-            // 5. [실행 단계]: 컴파일된 정규식을 실제 문자열에 적용하여 일치 여부를 확인합니다.
-            // regexec는 패턴이 일치하면 0을 반환합니다.
-            ret = regexec(&regex, str, 0, NULL, 0);
-
-            // 6. [정리 단계]: 컴파일 과정에서 할당된 내부 메모리를 해제하여 메모리 누수를 방지합니다.
-            regfree(&regex);
-
-            // 7. 결과 반환: 0이면 일치(true), 그 외에는 불일치(false)입니다.
-            return (ret == 0);
-#else
-            return false; // Native 환경에서는 정규식 테스트 제외
-#endif
+            const cms::Regex<> regex(pattern);
+            return regex.matches(str);
         }
 
         /// [validateUtf8] UTF-8 인코딩 유효성 검증
@@ -1202,13 +2411,19 @@ namespace cms {
         /// @return true: 유효함, false: 인코딩 오류 발견
         bool validateUtf8(const char* str) {
             if (!str) return false;
+            return validateUtf8(str, strlen(str));
+        }
+
+        bool validateUtf8(const char* str, size_t len) {
+            if (!str) return false;
 
             const unsigned char* bytes = reinterpret_cast<const unsigned char*>(str);
+            const unsigned char* end = bytes + len;
 
-            while (*bytes) {
-                // 1. [1바이트 영역 (ASCII)]: 00~7F 범위는 단일 바이트 글자입니다.
+            while (bytes < end && *bytes) {
+                // 1. [1바이트 영역 (ASCII)]: 00~7F 범위는 단일 바이트 글자이므로 워드/블록 단위로 건너뜁니다.
                 if (bytes[0] <= 0x7F) {
-                    bytes++;
+                    bytes = skipAscii(bytes, end);
                 }
                 // 2. [2바이트 영역]: C2~DF로 시작하며, 뒤에 1개의 후속 바이트가 와야 합니다.
                 else if (bytes[0] >= 0xC2 && bytes[0] <= 0xDF) {
@@ -1386,6 +2601,180 @@ namespace cms {
             return finalLen;
         }
 
+        namespace {
+            /// [FormatSpec] 파싱된 포맷 지정자 정보
+            struct FormatSpec {
+                char type;      ///< 변환 문자 (s, d, u, x, X, f, c, % ...)
+                bool isLong;    ///< 'l' 길이 한정자 여부 (ld, lu, lx, lX)
+                char padChar;   ///< 채움 문자 (' ' 또는 '0')
+                int width;      ///< 최소 출력 너비
+                int precision;  ///< 정밀도 (-1: 미지정)
+            };
+
+            /// [parseSpec] '%' 다음 위치부터 플래그/너비/정밀도/타입을 파싱
+            ///
+            /// appendPrintf와 packPrintfArgs가 동일한 규칙으로 포맷을 해석하도록 공유합니다.
+            /// @param p [IN/OUT] '%' 다음 문자 위치 → 변환 문자(마지막으로 해석한 문자) 위치
+            void parseSpec(const char*& p, FormatSpec& spec) {
+                spec.padChar = ' ';
+                spec.width = 0;
+                spec.precision = -1;
+                spec.isLong = false;
+
+                // 1. 플래그 확인 (예: '0'이 오면 0으로 채움)
+                if (*p == '0') {
+                    spec.padChar = '0';
+                    p++;
+                }
+
+                // 2. 너비(Width) 파싱 (예: %02d에서 '2')
+                while (cms::string::isDigit((unsigned char)*p)) {
+                    unsigned char c = (unsigned char)*p;
+                    if (spec.width < 100) spec.width = spec.width * 10 + (c - '0'); // 비정상적인 너비 제한
+                    p++;
+                }
+
+                // 3. 정밀도(Precision) 파싱 (예: %.3f)
+                if (*p == '.') {
+                    p++;
+                    spec.precision = 0;
+                    while (cms::string::isDigit((unsigned char)*p)) {
+                        unsigned char c = (unsigned char)*p;
+                        spec.precision = spec.precision * 10 + (c - '0');
+                        p++;
+                    }
+                }
+
+                // 4. long 한정자 (ld, lu, lx, lX 대응)
+                spec.type = *p;
+                if (*p == 'l') {
+                    const char next = *(p + 1);
+                    if (next == 'd' || next == 'u' || next == 'x' || next == 'X') {
+                        spec.isLong = true;
+                        spec.type = next;
+                        p++;
+                    }
+                }
+            }
+
+            /// [VaArgs] va_list에서 인자를 읽는 어댑터
+            struct VaArgs {
+                va_list ap;
+                explicit VaArgs(va_list src) { va_copy(ap, src); }
+                ~VaArgs() { va_end(ap); }
+                const char* str(size_t& len) {
+                    const char* s = va_arg(ap, const char*);
+                    if (!s) s = "(null)";
+                    len = strlen(s);
+                    return s;
+                }
+                long sint(bool isLong) { return isLong ? va_arg(ap, long) : (long)va_arg(ap, int); }
+                unsigned long uint(bool isLong) { return isLong ? va_arg(ap, unsigned long) : va_arg(ap, unsigned int); }
+                double real() { return va_arg(ap, double); }
+            };
+
+            /// [PackedArgs] packPrintfArgs로 직렬화된 바이트에서 인자를 읽는 어댑터
+            ///
+            /// 데이터가 부족하면(패킹 시 잘린 경우) 0 또는 빈 문자열을 반환합니다.
+            struct PackedArgs {
+                const uint8_t* p;
+                const uint8_t* end;
+                template <typename V>
+                V read() {
+                    V v = 0;
+                    if ((size_t)(end - p) >= sizeof(V)) { memcpy(&v, p, sizeof(V)); p += sizeof(V); }
+                    else p = end;
+                    return v;
+                }
+                const char* str(size_t& len) {
+                    len = read<uint8_t>();
+                    if ((size_t)(end - p) < len) len = (size_t)(end - p);
+                    const char* s = reinterpret_cast<const char*>(p);
+                    p += len;
+                    return s;
+                }
+                long sint(bool isLong) { return isLong ? read<long>() : (long)read<int>(); }
+                unsigned long uint(bool isLong) { return isLong ? read<unsigned long>() : read<unsigned int>(); }
+                double real() { return read<double>(); }
+            };
+
+            /// [formatCore] 포맷 문자열 해석 및 버퍼 추가 공통 엔진
+            ///
+            /// 인자 공급원(Args)만 바꿔 va_list와 패킹된 바이트 양쪽에서 동일한 출력을 만듭니다.
+            template <typename Args>
+            int formatCore(char* buffer, size_t maxLen, size_t& curLen, const char* format, Args& args) {
+                const char* p = format;
+                while (*p) {
+                    // [최적화] 다음 포맷 지정자(%) 위치를 찾아 리터럴 텍스트를 일괄 복사
+                    const char* nextPercent = strchr(p, '%');
+                    if (nextPercent != p) {
+                        size_t literalLen = (nextPercent) ? (size_t)(nextPercent - p) : strlen(p);
+                        append(buffer, maxLen, curLen, p, literalLen);
+                        p += literalLen;
+                        if (!*p) break;
+                    }
+
+                    // p는 이제 '%'를 가리킴
+                    if (*(p + 1)) {
+                        p++; // '%' 문자 건너뛰기
+                        FormatSpec spec;
+                        parseSpec(p, spec);
+
+                        // 타입별 처리
+                        switch (spec.type) {
+                            case 's': { // 문자열
+                                size_t len;
+                                const char* src = args.str(len);
+                                append(buffer, maxLen, curLen, src, len);
+                                break;
+                            }
+                            case 'd': // 정수
+                                appendInt(buffer, maxLen, curLen, args.sint(spec.isLong), spec.width, spec.padChar);
+                                break;
+                            case 'u': // 부호 없는 정수
+                                appendUInt(buffer, maxLen, curLen, args.uint(spec.isLong), spec.width, spec.padChar);
+                                break;
+                            case 'x': // 16진수 (소문자)
+                                appendHexInternal(buffer, maxLen, curLen, args.uint(spec.isLong), spec.width, spec.padChar, false);
+                                break;
+                            case 'X': // 16진수 (대문자)
+                                appendHexInternal(buffer, maxLen, curLen, args.uint(spec.isLong), spec.width, spec.padChar, true);
+                                break;
+                            case 'l': // 지원하지 않는 long 조합은 무시
+                                break;
+                            case 'f': // 실수
+                                appendFloat(buffer, maxLen, curLen, args.real(), (spec.precision >= 0) ? spec.precision : 2, spec.width, spec.padChar);
+                                break;
+                            case 'c': // 단일 문자
+                                {
+                                    char c = (char)args.sint(false);
+                                    append(buffer, maxLen, curLen, &c, 1);
+                                }
+                                break;
+                            case '%': // '%' 문자 자체
+                                append(buffer, maxLen, curLen, "%", 1);
+                                break;
+                            default: // 지원하지 않는 포맷은 원문 출력
+                                append(buffer, maxLen, curLen, "%", 1);
+                                append(buffer, maxLen, curLen, p, 1);
+                                break;
+                        }
+                    }
+                    p++;
+                }
+                return (int)curLen;
+            }
+
+            /// [packValue] 값을 패킹 버퍼에 기록 (공간이 부족하면 false)
+            template <typename V>
+            bool packValue(uint8_t* out, size_t maxLen, size_t& len, V v) {
+                if (maxLen - len < sizeof(V)) return false;
+                memcpy(out + len, &v, sizeof(V));
+                len += sizeof(V);
+                return true;
+            }
+        }
+
         /// [appendPrintf] 초경량 포맷팅 엔진
         ///
         /// 표준 vsnprintf의 무거운 스택 사용량을 피하면서 가변 인자 포맷팅 기능을 제공합니다.
@@ -1397,105 +2786,65 @@ namespace cms {
         /// @return 포맷팅 완료 후 최종 바이트 길이
         int appendPrintf(char* buffer, size_t maxLen, size_t& curLen, const char* format, va_list args) {
             if (!buffer || !format) return 0;
+            VaArgs source(args);
+            return formatCore(buffer, maxLen, curLen, format, source);
+        }
 
+        /// [packPrintfArgs] 포맷 문자열이 요구하는 인자만 바이트로 직렬화
+        ///
+        /// 포맷팅 비용을 호출 시점에서 제거하기 위해, 값 자체만 복사합니다. (%s는 길이 1바이트 + 내용, 최대 255바이트)
+        /// @return 기록한 바이트 수 (공간이 부족하면 그 지점까지만 기록)
+        size_t packPrintfArgs(uint8_t* out, size_t maxLen, const char* format, va_list args) {
+            if (!out || !format) return 0;
+            VaArgs source(args);
+            size_t len = 0;
             const char* p = format;
-            while (*p) {
-                // [최적화] 다음 포맷 지정자(%) 위치를 찾아 리터럴 텍스트를 일괄 복사
-                const char* nextPercent = strchr(p, '%');
-                if (nextPercent != p) {
-                    size_t literalLen = (nextPercent) ? (size_t)(nextPercent - p) : strlen(p);
-                    append(buffer, maxLen, curLen, p, literalLen);
-                    p += literalLen;
-                    if (!*p) break;
-                }
-
-                // p는 이제 '%'를 가리킴
-                if (*(p + 1)) {
-                    p++; // '%' 문자 건너뛰기
-                    char padChar = ' ';
-                    int width = 0;
-                    int precision = -1; // 정밀도 변수 추가
-
-                    // 1. 플래그 확인 (예: '0'이 오면 0으로 채움)
-                    if (*p == '0') {
-                        padChar = '0';
-                        p++;
-                    }
-
-                    // 2. 너비(Width) 파싱 (예: %02d에서 '2')
-                    while (cms::string::isDigit((unsigned char)*p)) {
-                        unsigned char c = (unsigned char)*p;
-                        if (width < 100) width = width * 10 + (c - '0'); // 비정상적인 너비 제한
-                        p++;
-                    }
-
-                    // 3. 정밀도(Precision) 파싱 (예: %.3f)
-                    if (*p == '.') {
-                        p++;
-                        precision = 0;
-                        while (cms::string::isDigit((unsigned char)*p)) {
-                            unsigned char c = (unsigned char)*p;
-                            precision = precision * 10 + (c - '0');
-                            p++;
-                        }
-                    }
-
-                    // 4. 타입별 처리
-                    switch (*p) {
-                        case 's': { // 문자열
-                            const char* s = va_arg(args, const char*);
-                            const char* src = s ? s : "(null)";
-                            append(buffer, maxLen, curLen, src, strlen(src));
-                            break;
-                        }
-                        case 'd': // 정수
-                            appendInt(buffer, maxLen, curLen, (long)va_arg(args, int), width, padChar);
-                            break;
-                        case 'u': // 부호 없는 정수
-                            appendUIntInternal(buffer, maxLen, curLen, va_arg(args, unsigned int), width, padChar);
-                            break;
-                        case 'x': // 16진수 (소문자)
-                            appendHexInternal(buffer, maxLen, curLen, va_arg(args, unsigned int), width, padChar, false);
-                            break;
-                        case 'X': // 16진수 (대문자)
-                            appendHexInternal(buffer, maxLen, curLen, va_arg(args, unsigned int), width, padChar, true);
-                            break;
-                        case 'l': // long (ld, lu, lx, lX 대응)
-                            if (*(p + 1) == 'd') {
-                                appendInt(buffer, maxLen, curLen, va_arg(args, long), width, padChar);
-                                p++;
-                            } else if (*(p + 1) == 'u') {
-                                appendUIntInternal(buffer, maxLen, curLen, va_arg(args, unsigned long), width, padChar);
-                                p++;
-                            } else if (*(p + 1) == 'x') {
-                                appendHexInternal(buffer, maxLen, curLen, va_arg(args, unsigned long), width, padChar, false);
-                                p++;
-                            } else if (*(p + 1) == 'X') {
-                                appendHexInternal(buffer, maxLen, curLen, va_arg(args, unsigned long), width, padChar, true);
-                                p++;
-                            }
-                            break;
-                        case 'f': // 실수
-                            appendFloat(buffer, maxLen, curLen, va_arg(args, double), (precision >= 0) ? precision : 2);
-                            break;
-                        case 'c': // 단일 문자
-                            {
-                                char c = (char)va_arg(args, int);
-                                append(buffer, maxLen, curLen, &c, 1);
-                            }
-                            break;
-                        case '%': // '%' 문자 자체
-                            append(buffer, maxLen, curLen, "%", 1);
-                            break;
-                        default: // 지원하지 않는 포맷은 원문 출력
-                            append(buffer, maxLen, curLen, "%", 1);
-                            append(buffer, maxLen, curLen, p, 1);
-                            break;
+            while ((p = strchr(p, '%')) != nullptr && *(p + 1)) {
+                p++; // '%' 문자 건너뛰기
+                FormatSpec spec;
+                parseSpec(p, spec);
+
+                bool ok = true;
+                switch (spec.type) {
+                    case 's': {
+                        size_t sLen;
+                        const char* s = source.str(sLen);
+                        if (sLen > 255) sLen = 255;
+                        if (maxLen - len < 1) { ok = false; break; }
+                        if (sLen > maxLen - len - 1) sLen = maxLen - len - 1; // 남은 공간만큼 잘라서 보관
+                        out[len++] = (uint8_t)sLen;
+                        memcpy(out + len, s, sLen);
+                        len += sLen;
+                        break;
                     }
+                    case 'd':
+                        ok = spec.isLong ? packValue(out, maxLen, len, source.sint(true))
+                                         : packValue(out, maxLen, len, (int)source.sint(false));
+                        break;
+                    case 'c':
+                        ok = packValue(out, maxLen, len, (int)source.sint(false));
+                        break;
+                    case 'u': case 'x': case 'X':
+                        ok = spec.isLong ? packValue(out, maxLen, len, source.uint(true))
+                                         : packValue(out, maxLen, len, (unsigned int)source.uint(false));
+                        break;
+                    case 'f':
+                        ok = packValue(out, maxLen, len, source.real());
+                        break;
+                    default: // '%', 미지원 지정자는 인자를 소비하지 않음
+                        break;
                 }
+                if (!ok) break;
                 p++;
             }
-            return (int)curLen;
+            return len;
+        }
+
+        /// [appendPacked] packPrintfArgs로 직렬화된 인자로 포맷팅하여 버퍼 끝에 추가
+        int appendPacked(char* buffer, size_t maxLen, size_t& curLen, const char* format, const uint8_t* packed, size_t packedLen) {
+            if (!buffer || !format) return 0;
+            PackedArgs source{packed, packed + packedLen};
+            return formatCore(buffer, maxLen, curLen, format, source);
         }
 
     } // string
@@ -9,8 +9,14 @@
 #include <cstring>  // strlen, strchr, strstr
 #include <stddef.h> // size_t, NULL
 #include <stdarg.h> // va_list
+#include <stdint.h> // uint8_t
+#include <limits>      // std::numeric_limits
+#include <type_traits> // std::is_integral, std::conditional
 
 namespace cms {
+    // cmsRegex.h에 정의된 정규표현식 객체 (matches 오버로드용 전방 선언)
+    template<size_t MAX_INST, size_t MAX_CLASSES> class Regex;
+
     namespace string {
         // 표준 strlcpy가 없는 환경을 대비한 자체 구현 (BSD 스타일)
         size_t strlcpy(char *dst, const char *src, size_t dsize);
@@ -63,6 +69,46 @@ namespace cms {
             return (d | l | u);
         }
 
+        // ---------------------------------------------------------
+        // [djb2] 컴파일 타임에도 계산 가능한 DJB2 문자열 해시입니다. (hash * 33 + c, 초기값 5381)
+        // 로거의 태그 색상 선택, StringTable, "cmd"_hash 리터럴이 모두 같은 함수를 공유합니다. (docs/DJB2_HASH.md)
+        //
+        // Usage:
+        //   using namespace cms::string::literals;
+        //   switch (cmd.hash()) {
+        //       case "reboot"_hash: ...; break;     // 정수 비교로 분기 (충돌하는 리터럴은 중복 case로 컴파일 오류)
+        //   }
+        //
+        // @param ignoreCase true일 경우 영문 소문자를 대문자로 접은 뒤 누적 (로거 태그 해시와 동일)
+        // @note 외부 입력으로 분기할 때 다른 문자열이 같은 해시를 가질 수 있으므로, 필요하면 case 안에서 equals로 확인하세요.
+        // ---------------------------------------------------------
+        constexpr uint32_t DJB2_SEED = 5381;
+
+        constexpr uint32_t djb2Step(uint32_t hash, char c, bool ignoreCase = false) noexcept {
+            const unsigned char u = static_cast<unsigned char>(c);
+            return ((hash << 5) + hash) + ((ignoreCase && u >= 'a' && u <= 'z') ? static_cast<unsigned char>(u - 'a' + 'A') : u);
+        }
+
+        constexpr uint32_t djb2(const char* str, size_t len, bool ignoreCase = false) noexcept {
+            uint32_t hash = DJB2_SEED;
+            for (size_t i = 0; i < len; ++i) hash = djb2Step(hash, str[i], ignoreCase);
+            return hash;
+        }
+
+        /// NUL 종료 문자열 전용 (대소문자 구분)
+        constexpr uint32_t djb2(const char* str) noexcept {
+            uint32_t hash = DJB2_SEED;
+            for (; str && *str; ++str) hash = djb2Step(hash, *str);
+            return hash;
+        }
+
+        namespace literals {
+            /// "cmd"_hash: 대소문자를 구분하는 컴파일 타임 DJB2
+            constexpr uint32_t operator""_hash(const char* str, size_t len) noexcept { return djb2(str, len); }
+            /// "cmd"_ihash: 대소문자를 무시하는 컴파일 타임 DJB2 (hash(true)와 짝)
+            constexpr uint32_t operator""_ihash(const char* str, size_t len) noexcept { return djb2(str, len, true); }
+        }
+
         // ---------------------------------------------------------
         // [trim] 문자열 양 끝의 공백 및 제어 문자(\r, \n, \t)를 제거합니다.
         // 후방 공백은 널 문자로 자르고, 전방 공백은 memmove로 당깁니다.
@@ -126,6 +172,8 @@ namespace cms {
             int toInt() const;
             /// 토큰의 내용을 실수(double)로 변환합니다.
             double toFloat() const;
+            /// 토큰 내용의 DJB2 해시를 계산합니다. ("cmd"_hash / "cmd"_ihash와 비교)
+            constexpr uint32_t hash(bool ignoreCase = false) const noexcept { return djb2(ptr, len, ignoreCase); }
 
             /// 다른 토큰과 내용을 비교합니다.
             bool equals(const Token& other, bool ignoreCase = false) const;
@@ -138,6 +186,12 @@ namespace cms {
                 return cms::string::equals(ptr, len, s, M - 1, ignoreCase);
             }
 
+            /// 컴파일된 정규표현식과 일치하는 구간이 있는지 검사합니다. (cmsRegex.h 포함 필요)
+            template<size_t MAX_INST, size_t MAX_CLASSES>
+            bool matches(const cms::Regex<MAX_INST, MAX_CLASSES>& regex) const {
+                return regex.matches(ptr, len);
+            }
+
             // 편의를 위한 연산자 오버로딩
             bool operator==(const Token& other) const { return equals(other); }
             bool operator==(const char* s) const { return equals(s); }
@@ -145,6 +199,151 @@ namespace cms {
             bool operator!=(const char* s) const { return !equals(s); }
         };
 
+        // ---------------------------------------------------------
+        // [Needle] 반복 검색을 위해 미리 전처리(컴파일)해 둔 검색 패턴입니다.
+        // Two-Way(Crochemore-Perrin) 임계 분해로 최악의 경우에도 선형 시간을 보장하고,
+        // Horspool 건너뛰기 테이블로 불일치 구간을 한 번에 뛰어넘습니다.
+        // ignoreCase 검색은 ASCII 대소문자 폴딩 테이블을 거쳐 비교합니다.
+        //
+        // Usage:
+        //   cms::string::Needle topic("sensor/", 7);
+        //   int off = topic.search(buf, len);          // 첫 일치 바이트 오프셋
+        //   cms::string::Needle last("/", 1, false, cms::string::Needle::Direction::Reverse);
+        //   int tail = last.search(buf, len);          // 마지막 일치 바이트 오프셋
+        //
+        // @note 패턴 포인터만 보관하므로 패턴 메모리는 Needle보다 오래 유지되어야 합니다.
+        // @note 객체 크기는 약 280바이트(건너뛰기 테이블 256바이트 포함)이며 힙을 사용하지 않습니다.
+        // ---------------------------------------------------------
+        class Needle {
+        public:
+            /// 검색 방향 (Reverse는 마지막 일치를 찾는 진짜 역방향 탐색)
+            enum class Direction : uint8_t { Forward, Reverse };
+
+            /// 패턴을 분석하여 임계 분해와 건너뛰기 테이블을 준비합니다. (O(패턴 길이))
+            Needle(const char* pattern, size_t len, bool ignoreCase = false, Direction dir = Direction::Forward) noexcept;
+
+            /// 문자열 리터럴 전용 생성자 (strlen 생략)
+            template<size_t M>
+            explicit Needle(const char (&pattern)[M], bool ignoreCase = false, Direction dir = Direction::Forward) noexcept
+                : Needle(pattern, M - 1, ignoreCase, dir) {}
+
+            /// hay[0, hayLen) 구간에서 패턴을 찾습니다.
+            /// @return Forward: 첫 일치, Reverse: 마지막 일치의 바이트 오프셋 (찾지 못했거나 빈 패턴이면 -1)
+            int search(const char* hay, size_t hayLen) const noexcept;
+
+            /// 패턴의 바이트 길이를 반환합니다.
+            size_t length() const noexcept { return _len; }
+
+        private:
+            const char* _pat;
+            size_t _len;
+            size_t _ms;       // 임계 분해 위치 - 1 (최대 접미사 시작 직전, -1은 SIZE_MAX로 표현)
+            size_t _period;   // 주기 (비주기 패턴이면 안전한 이동 거리)
+            size_t _memory0;  // 주기적 패턴에서 이동 후 이미 일치가 보장된 접두 길이
+            bool _ignoreCase;
+            bool _reverse;
+            uint8_t _skip[256]; // 창 마지막 바이트 기준 이동 거리 (255로 제한)
+
+            template<bool REV, bool ICASE>
+            int searchImpl(const char* hay, size_t hayLen) const noexcept;
+        };
+
+        // ---------------------------------------------------------
+        // [Tokenizer] 출력 배열 없이 Token을 하나씩 꺼내는 지연(Lazy) 분할기입니다.
+        // 여러 구분 문자를 256비트 비트맵으로 한 번에 판별하고, 따옴표 구간과 이스케이프 문자 뒤의 구분자는 무시합니다.
+        //
+        // Why: split(Token*)은 호출자가 배열 크기를 정해야 하고 구분자가 하나뿐이라,
+        //      "k=v;k=v" 같은 중첩 형식은 여러 번 훑거나 String<N> 배열로 복사해야 했습니다.
+        // How: 현재 위치만 보관하며 next() 호출마다 다음 구분자까지 한 번만 전진합니다.
+        //      원본을 수정하지 않으므로(토큰은 원본을 가리킴) 원본 메모리는 순회가 끝날 때까지 유지되어야 합니다.
+        //
+        // Usage:
+        //   for (cms::string::Token field : cms::string::Tokenizer(line, len, ",", '"')) { ... }
+        //
+        //   cms::string::Tokenizer kv(frame, len, ";=");     // 한 번의 패스로 키와 값을 구분
+        //   cms::string::Token key, value;
+        //   while (kv.next(key) && kv.delimiter() == '=' && kv.next(value)) { ... }
+        //
+        // @note 연속된 구분자 사이의 빈 토큰도 반환합니다. ("a,,b" → "a", "", "b", "a," → "a", "")
+        //       빈 입력은 토큰을 만들지 않습니다.
+        // @note 토큰 전체가 따옴표로 감싸져 있으면 바깥 따옴표를 제외한 범위를 반환합니다.
+        //       내부의 이스케이프("" 또는 \")는 원본 그대로 남으므로 필요하면 isQuoted()로 확인 후 처리합니다.
+        // ---------------------------------------------------------
+        class Tokenizer {
+        public:
+            /// 분할을 준비합니다. (구분 문자 집합 구성 O(구분자 수))
+            ///
+            /// @param str 분할할 데이터 (NUL 종료 불필요)
+            /// @param len 데이터의 바이트 길이
+            /// @param delimiters 구분 문자 집합 (NUL 종료 문자열, 예: ",;")
+            /// @param quote 따옴표 문자 ('\0'이면 사용 안 함)
+            /// @param escape 다음 한 바이트를 일반 문자로 취급할 이스케이프 문자 ('\0'이면 사용 안 함)
+            Tokenizer(const char* str, size_t len, const char* delimiters, char quote = '\0', char escape = '\0') noexcept;
+
+            /// NUL 종료 문자열 전용 생성자
+            Tokenizer(const char* str, const char* delimiters, char quote = '\0', char escape = '\0') noexcept
+                : Tokenizer(str, str ? strlen(str) : 0, delimiters, quote, escape) {}
+
+            /// 다른 토큰을 다시 분할하는 생성자 (중첩 형식용)
+            Tokenizer(const Token& src, const char* delimiters, char quote = '\0', char escape = '\0') noexcept
+                : Tokenizer(src.ptr, src.len, delimiters, quote, escape) {}
+
+            /// 다음 토큰을 꺼냅니다.
+            ///
+            /// @param out [OUT] 다음 토큰
+            /// @return true: 토큰을 꺼냄, false: 더 이상 토큰 없음
+            bool next(Token& out) noexcept;
+
+            /// 꺼낼 토큰이 남아 있는지 확인합니다.
+            bool hasNext() const noexcept { return _pos != nullptr; }
+
+            /// 마지막으로 꺼낸 토큰을 끝낸 구분 문자를 반환합니다. (입력 끝에서 끝났으면 '\0')
+            char delimiter() const noexcept { return _delimiter; }
+
+            /// 마지막으로 꺼낸 토큰이 바깥 따옴표를 벗겨낸 것인지 확인합니다.
+            bool isQuoted() const noexcept { return _quoted; }
+
+            /// 아직 분할하지 않은 나머지 전체를 반환합니다. (명령어 뒤 인자 묶음 등)
+            Token rest() const noexcept { return _pos ? Token{_pos, static_cast<size_t>(_end - _pos)} : Token{_end, 0}; }
+
+            /// 범위 기반 for 문용 입력 반복자
+            class Iterator {
+            public:
+                const Token& operator*() const noexcept { return _current; }
+                const Token* operator->() const noexcept { return &_current; }
+                Iterator& operator++() noexcept {
+                    if (!_owner->next(_current)) _owner = nullptr;
+                    return *this;
+                }
+                bool operator==(const Iterator& other) const noexcept { return _owner == other._owner; }
+                bool operator!=(const Iterator& other) const noexcept { return _owner != other._owner; }
+
+            private:
+                friend class Tokenizer;
+                explicit Iterator(Tokenizer* owner) noexcept : _owner(owner), _current{nullptr, 0} {
+                    if (_owner) ++(*this);
+                }
+                Tokenizer* _owner;
+                Token _current;
+            };
+
+            /// 현재 위치부터 순회를 시작합니다. (반복자는 Tokenizer 자체를 전진시킴)
+            Iterator begin() noexcept { return Iterator(this); }
+            Iterator end() noexcept { return Iterator(nullptr); }
+
+        private:
+            /// 구분자/따옴표/이스케이프 중 하나인지 판별하는 비트맵 (바이트당 1비트)
+            bool isStop(unsigned char c) const noexcept { return (_stop[c >> 5] >> (c & 31)) & 1u; }
+
+            const char* _pos;  // 다음 토큰 시작 (nullptr이면 순회 종료)
+            const char* _end;
+            uint32_t _stop[8];
+            char _quote;
+            char _escape;
+            char _delimiter;
+            bool _quoted;
+        };
+
         // ---------------------------------------------------------
         // [indexOf] 문자열 내에서 특정 문자가 처음 나타나는 위치를 찾습니다.
         //
@@ -224,6 +423,96 @@ namespace cms {
         bool isNumeric(const char* str);
         bool isNumeric(const char* str, size_t len);
 
+        // ---------------------------------------------------------
+        // [parse] std::from_chars 스타일의 검증된 숫자 변환입니다.
+        // toInt/toFloat와 달리 성공 여부와 소비 위치를 반환하며, 오버플로우를 감지합니다.
+        //
+        // Why: toInt/toFloat는 실패와 0을 구분할 수 없고 오버플로우 시 값이 조용히 손상되며,
+        //      strtod는 NUL 종료 문자열이 필요하고 플랫폼에 따라 수 KB의 코드와 로캘 처리를 끌어옵니다.
+        // How: 정수는 한 번의 스캔으로 검증·누적·범위 검사를 끝내고(32비트 이하 타입은 32비트 연산만 사용),
+        //      실수는 Clinger 고속 경로와 정수 전용 10진 → 2진 변환으로 항상 올바르게 반올림된 값을 얻습니다.
+        //
+        // Usage:
+        //   int32_t id; float gain;
+        //   if (cms::string::parse(tokens[1], id) && cms::string::parse(tokens[2], gain)) { ... }
+        //   uint16_t reg; cms::string::parse(token, reg, 16);            // "0x1F" 또는 "1f"
+        //   auto r = cms::string::parse(p, end, value);                  // r.ptr: 소비가 끝난 위치
+        //
+        // @note 지원 타입: bool을 제외한 정수 타입, float, double. (long double은 컴파일 오류)
+        // @note 실패 시 out은 변경되지 않습니다. 범위 초과(OutOfRange) 시에도 숫자 부분은 끝까지 소비합니다.
+        // @note std::from_chars와 달리 앞의 '+' 부호와 16진수의 "0x" 접두사를 허용합니다. (설정 파일/명령 입력 호환)
+        // ---------------------------------------------------------
+
+        /// parse()의 결과 코드 (std::errc의 from_chars 관련 부분만 축약)
+        enum class ParseErrc : uint8_t {
+            Ok = 0,           // 변환 성공
+            InvalidArgument,  // 숫자 형식이 아님 (ptr은 입력 시작 또는 남은 문자 위치)
+            OutOfRange        // 대상 타입의 범위를 벗어남
+        };
+
+        /// parse()의 반환 값 (std::from_chars_result 대응)
+        struct ParseResult {
+            const char* ptr;  // 소비가 끝난 다음 위치
+            ParseErrc ec;
+
+            /// 변환에 성공했는지 확인합니다.
+            explicit operator bool() const { return ec == ParseErrc::Ok; }
+        };
+
+        namespace detail {
+            /// [parseInteger] 부호와 절댓값을 분리하여 파싱합니다. (maxNegative가 0이면 '-' 불허)
+            ParseResult parseInteger(const char* first, const char* last, int base, uint32_t maxPositive,
+                                     uint32_t maxNegative, uint32_t& magnitude, bool& negative);
+            ParseResult parseInteger(const char* first, const char* last, int base, uint64_t maxPositive,
+                                     uint64_t maxNegative, uint64_t& magnitude, bool& negative);
+            /// [parseReal] 실수 파싱 코어 (inf, infinity, nan, 지수 표기 지원)
+            ParseResult parseReal(const char* first, const char* last, float& out);
+            ParseResult parseReal(const char* first, const char* last, double& out);
+            /// 앞뒤 공백을 제외한 범위로 좁힙니다.
+            void trimSpaces(const char*& first, const char*& last);
+        }
+
+        /// [first, last) 범위의 앞부분을 숫자로 변환합니다. (공백 미허용, 남은 문자는 ptr로 확인)
+        ///
+        /// @param base 정수 진법 (2~36, 16일 경우 "0x" 접두사 허용, 실수에서는 무시)
+        template<typename T>
+        ParseResult parse(const char* first, const char* last, T& out, int base = 10) {
+            static_assert(!std::is_same<T, bool>::value, "cms::string::parse does not support bool.");
+            static_assert(std::is_integral<T>::value || std::is_same<T, float>::value || std::is_same<T, double>::value,
+                          "cms::string::parse supports integral types, float and double only.");
+            if constexpr (std::is_integral<T>::value) {
+                using Magnitude = typename std::conditional<(sizeof(T) > 4), uint64_t, uint32_t>::type;
+                const Magnitude maxPositive = static_cast<Magnitude>(std::numeric_limits<T>::max());
+                const Magnitude maxNegative = std::is_signed<T>::value ? static_cast<Magnitude>(maxPositive + 1) : 0;
+                Magnitude magnitude = 0;
+                bool negative = false;
+                const ParseResult r = detail::parseInteger(first, last, base, maxPositive, maxNegative, magnitude, negative);
+                if (r.ec == ParseErrc::Ok) {
+                    // -(m - 1) - 1 형태로 계산하여 최솟값에서도 부호 있는 오버플로우가 없도록 함
+                    out = (negative && magnitude > 0) ? static_cast<T>(-static_cast<T>(magnitude - 1) - 1)
+                                                      : static_cast<T>(magnitude);
+                }
+                return r;
+            } else {
+                (void)base;
+                return detail::parseReal(first, last, out);
+            }
+        }
+
+        /// 토큰 전체를 숫자로 변환합니다. (앞뒤 공백 허용, 그 외 남은 문자가 있으면 InvalidArgument)
+        template<typename T>
+        ParseResult parse(const Token& token, T& out, int base = 10) {
+            const char* first = token.ptr;
+            const char* last = token.ptr ? token.ptr + token.len : nullptr;
+            detail::trimSpaces(first, last);
+            T value;
+            const ParseResult r = parse(first, last, value, base);
+            if (r.ec != ParseErrc::Ok) return r;
+            if (r.ptr != last) return {r.ptr, ParseErrc::InvalidArgument};
+            out = value;
+            return r;
+        }
+
         // ---------------------------------------------------------
         // [utf8_strlen] UTF-8 인코딩을 인식하여 문자열의 글자 수를 측정합니다.
         //
@@ -233,6 +522,19 @@ namespace cms {
         // @return 논리적 글자 수 (바이트 크기가 아님)
         // ---------------------------------------------------------
         size_t utf8_strlen(const char* str);
+        size_t utf8_strlen(const char* str, size_t len);
+
+        // ---------------------------------------------------------
+        // [utf8ByteOffset] charIdx번째 글자가 시작되는 바이트 오프셋을 반환합니다.
+        //
+        // Usage: size_t off = cms::string::utf8ByteOffset(str, len, 3);
+        //
+        // @param str UTF-8 문자열
+        // @param len 문자열의 바이트 길이
+        // @param charIdx 논리적 글자 위치 (0부터 시작)
+        // @return 바이트 오프셋 (글자 수를 넘으면 len)
+        // ---------------------------------------------------------
+        size_t utf8ByteOffset(const char* str, size_t len, size_t charIdx);
         // ---------------------------------------------------------
         // [utf8SafeEnd] UTF-8 ?? ??? ???? ??? ?? ??? ?????.
         //
@@ -260,6 +562,16 @@ namespace cms {
         int find(const char* str, const char* target, size_t startChar = 0, bool ignoreCase = false);
         int find(const char* str, size_t strLen, const char* target, size_t targetLen, size_t startChar, bool ignoreCase);
 
+        // ---------------------------------------------------------
+        // [findBytes] 바이트 오프셋 기준으로 부분 문자열을 찾습니다.
+        //
+        // Usage: int off = cms::string::findBytes(s, len, "TAG", 3, 0, false);
+        //
+        // @param startByte 검색을 시작할 바이트 위치
+        // @return 발견된 바이트 오프셋 (찾지 못하면 -1)
+        // ---------------------------------------------------------
+        int findBytes(const char* str, size_t strLen, const char* target, size_t targetLen, size_t startByte, bool ignoreCase);
+
         // ---------------------------------------------------------
         // [lastIndexOf] 문자열에서 마지막으로 나타나는 위치를 찾습니다.
         //
@@ -272,6 +584,8 @@ namespace cms {
         // ---------------------------------------------------------
         int lastIndexOf(const char* str, const char* target, bool ignoreCase = false);
         int lastIndexOf(const char* str, size_t strLen, const char* target, size_t targetLen, bool ignoreCase);
+        /// 마지막 발견 지점의 바이트 오프셋을 반환합니다. (찾지 못하면 -1)
+        int findLastBytes(const char* str, size_t strLen, const char* target, size_t targetLen, bool ignoreCase);
 
         // ---------------------------------------------------------
         // [insert] 특정 글자 위치에 문자열을 삽입합니다.
@@ -285,6 +599,8 @@ namespace cms {
         // @return 삽입 후의 새로운 문자열 바이트 길이
         // ---------------------------------------------------------
         size_t insert(char* buffer, size_t maxLen, size_t curLen, size_t charIdx, const char* src);
+        /// 바이트 위치(byteOffset)에 srcLen 바이트를 삽입합니다. (insert의 물리적 코어)
+        size_t insertBytes(char* buffer, size_t maxLen, size_t curLen, size_t byteOffset, const char* src, size_t srcLen);
 
         // ---------------------------------------------------------
         // [remove] 문자열의 특정 구간을 삭제합니다.
@@ -298,6 +614,8 @@ namespace cms {
         // @return 삭제 후의 새로운 문자열 바이트 길이
         // ---------------------------------------------------------
         size_t remove(char* buffer, size_t curLen, size_t charIdx, size_t charCount);
+        /// 바이트 구간 [startByte, endByte)를 삭제합니다. (remove의 물리적 코어)
+        size_t removeBytes(char* buffer, size_t curLen, size_t startByte, size_t endByte);
 
         // ---------------------------------------------------------
         // [substring] 지정된 글자 범위를 추출합니다.
@@ -312,6 +630,7 @@ namespace cms {
         // @return 추출된 문자열의 바이트 길이
         // ---------------------------------------------------------
         size_t substring(const char* src, char* dest, size_t destLen, size_t left, size_t right = 0);
+        size_t substring(const char* src, size_t srcLen, char* dest, size_t destLen, size_t left, size_t right = 0);
 
         // ---------------------------------------------------------
         // [byteSubstring] 바이트 오프셋 기준으로 문자열을 자릅니다.
@@ -414,8 +733,25 @@ namespace cms {
         // ---------------------------------------------------------
         size_t replace(char* str, size_t maxLen, size_t curLen, const char* from, const char* to, bool ignoreCase = false);
 
+        // ---------------------------------------------------------
+        // [replaceInto] 원본은 그대로 두고 치환 결과를 다른 버퍼에 씁니다.
+        //
+        // Usage: size_t n = cms::string::replaceInto(tpl, tplLen, out, sizeof(out), "{id}", id);
+        //
+        // @param src 원본 문자열
+        // @param srcLen 원본 바이트 길이
+        // @param dest 결과를 저장할 버퍼 (src와 겹치면 안 됨)
+        // @param destLen 결과 버퍼의 최대 크기 (널 종료 문자 포함)
+        // @param from 찾을 패턴
+        // @param to 바꿀 내용
+        // @param ignoreCase true일 경우 대소문자 무시
+        // @return 결과 문자열의 바이트 길이 (버퍼가 부족하면 UTF-8 글자 경계에서 잘림)
+        // ---------------------------------------------------------
+        size_t replaceInto(const char* src, size_t srcLen, char* dest, size_t destLen, const char* from, const char* to, bool ignoreCase = false);
+
         // ---------------------------------------------------------
         // [matches] 정규식 패턴과의 일치 여부를 확인합니다.
+        // 호출마다 패턴을 스택에서 컴파일하므로, 반복 검사에는 cms::Regex 객체를 재사용하세요.
         //
         // Usage: if (cms::string::matches(s, "^[0-9]+$")) { ... }
         //
@@ -434,6 +770,7 @@ namespace cms {
         // @return true: 유효한 UTF-8, false: 인코딩 오류(깨진 글자) 발견
         // ---------------------------------------------------------
         bool validateUtf8(const char* str);
+        bool validateUtf8(const char* str, size_t len);
 
         // ---------------------------------------------------------
         // [sanitizeUtf8] 깨진 UTF-8 바이트를 대체 문자로 치환합니다.
@@ -460,6 +797,37 @@ namespace cms {
         // ---------------------------------------------------------
         int appendPrintf(char* buffer, size_t maxLen, size_t& curLen, const char* format, va_list args);
 
+        // ---------------------------------------------------------
+        // [packPrintfArgs] 포맷 문자열이 요구하는 인자 값만 바이트로 직렬화합니다.
+        //
+        // Why: 로그 호출 시점에는 값만 복사하고, 무거운 포맷팅은 나중에(appendPacked) 수행하기 위함입니다.
+        // How: appendPrintf와 같은 규칙으로 지정자를 해석하며, %s는 내용(최대 255바이트)을 복사합니다.
+        //
+        // Usage: size_t n = cms::string::packPrintfArgs(buf, sizeof(buf), format, args);
+        //
+        // @param out 직렬화 결과를 저장할 버퍼
+        // @param maxLen 버퍼의 최대 크기
+        // @param format 포맷 문자열 (appendPacked 시점까지 유효해야 함)
+        // @param args 가변 인자 리스트 (va_list)
+        // @return 기록한 바이트 수 (공간이 부족하면 그 지점까지만 기록)
+        // ---------------------------------------------------------
+        size_t packPrintfArgs(uint8_t* out, size_t maxLen, const char* format, va_list args);
+
+        // ---------------------------------------------------------
+        // [appendPacked] packPrintfArgs로 직렬화된 인자를 사용하여 포맷팅 결과를 버퍼 끝에 추가합니다.
+        //
+        // Usage: cms::string::appendPacked(buf, maxLen, len, format, packed, packedLen);
+        //
+        // @param buffer 결과가 저장될 버퍼
+        // @param maxLen 버퍼의 최대 크기 (널 종료 문자 포함)
+        // @param curLen 현재 문자열 길이 (참조로 전달되어 업데이트됨)
+        // @param format packPrintfArgs에 사용한 것과 같은 포맷 문자열
+        // @param packed 직렬화된 인자
+        // @param packedLen 직렬화된 인자 바이트 수
+        // @return 포맷팅 완료 후 최종 문자열의 전체 바이트 길이
+        // ---------------------------------------------------------
+        int appendPacked(char* buffer, size_t maxLen, size_t& curLen, const char* format, const uint8_t* packed, size_t packedLen);
+
         // ---------------------------------------------------------
         // [append] 길이를 아는 데이터를 버퍼 끝에 추가합니다.
         //
@@ -487,6 +855,51 @@ namespace cms {
         // ---------------------------------------------------------
         void appendInt(char* buffer, size_t maxLen, size_t& curLen, long val, int width = 0, char padChar = ' ');
 
+        // ---------------------------------------------------------
+        // [appendUInt] 부호 없는 정수값을 문자열로 변환하여 버퍼 끝에 추가합니다.
+        //
+        // Usage: cms::string::appendUInt(buf, maxLen, len, millis());
+        //
+        // @param buffer 대상 버퍼
+        // @param maxLen 버퍼 최대 크기
+        // @param curLen 현재 길이 (업데이트됨)
+        // @param val 변환할 정수값 (unsigned long 타입)
+        // @param width 최소 출력 너비 (0일 경우 가변 길이)
+        // @param padChar 채움 문자 (예: '0', ' ')
+        // ---------------------------------------------------------
+        void appendUInt(char* buffer, size_t maxLen, size_t& curLen, unsigned long val, int width = 0, char padChar = ' ');
+
+        // ---------------------------------------------------------
+        // [appendInt64] 64비트 정수값을 문자열로 변환하여 버퍼 끝에 추가합니다.
+        //
+        // Usage: cms::string::appendInt64(buf, maxLen, len, energyMicroWh);
+        //
+        // @note 32비트 범위의 값은 32비트 나눗셈만 사용합니다. (ESP32의 64비트 나눗셈 회피)
+        // ---------------------------------------------------------
+        void appendInt64(char* buffer, size_t maxLen, size_t& curLen, long long val, int width = 0, char padChar = ' ');
+
+        // ---------------------------------------------------------
+        // [appendUInt64] 64비트 부호 없는 정수값을 문자열로 변환하여 버퍼 끝에 추가합니다.
+        //
+        // Usage: cms::string::appendUInt64(buf, maxLen, len, esp_timer_get_time());
+        // ---------------------------------------------------------
+        void appendUInt64(char* buffer, size_t maxLen, size_t& curLen, unsigned long long val, int width = 0, char padChar = ' ');
+
+        // ---------------------------------------------------------
+        // [appendHex] 부호 없는 정수값을 16진수 문자열로 변환하여 버퍼 끝에 추가합니다.
+        //
+        // Usage: cms::string::appendHex(buf, maxLen, len, reg, 8);   // "0000BEEF"
+        //
+        // @param buffer 대상 버퍼
+        // @param maxLen 버퍼 최대 크기
+        // @param curLen 현재 길이 (업데이트됨)
+        // @param val 변환할 값
+        // @param width 최소 출력 너비 (0일 경우 가변 길이)
+        // @param padChar 채움 문자 (기본 '0')
+        // @param uppercase true: "BEEF", false: "beef"
+        // ---------------------------------------------------------
+        void appendHex(char* buffer, size_t maxLen, size_t& curLen, unsigned long val, int width = 0, char padChar = '0', bool uppercase = true);
+
         // ---------------------------------------------------------
         // [appendFloat] 실수값을 문자열로 변환하여 버퍼 끝에 추가합니다.
         //
@@ -497,8 +910,26 @@ namespace cms {
         // @param curLen 현재 길이 (업데이트됨)
         // @param val 변환할 실수값 (float 타입)
         // @param decimalPlaces 소수점 이하 출력 자리수
+        // @param width 최소 출력 너비 (0일 경우 가변 길이, printf의 %8.3f와 같이 부호와 소수점 포함)
+        // @param padChar 채움 문자 ('0'이면 부호 뒤에 채움, nan/inf는 항상 공백)
+        // ---------------------------------------------------------
+        void appendFloat(char* buffer, size_t maxLen, size_t& curLen, double val, int decimalPlaces = 2, int width = 0, char padChar = ' ');
+
+        // ---------------------------------------------------------
+        // [appendShortest] 다시 읽으면 같은 값이 되는 가장 짧은 10진 표기로 실수를 추가합니다.
+        //
+        // Why: 고정 자릿수는 0.1f를 "0.10", 1e-7f를 "0.00"으로 만들어 정보를 잃거나 자리를 낭비하므로,
+        //      센서 JSON처럼 값을 그대로 전달해야 하는 경로에서 정확하고 짧은 표기를 쓰기 위함입니다.
+        // How: Grisu2(64비트 정수 연산 + 79개 캐시 테이블)로 자릿수를 구하고(왕복은 항상 보장, 99.9% 이상에서 최단),
+        //      10진 지수가 -4 이상 15 미만이면 고정 표기, 그 외에는 "1.5e+20"처럼 지수 표기를 사용합니다.
+        //
+        // Usage: cms::string::appendShortest(buf, maxLen, len, 23.1f);   // "23.1"
+        //
+        // @note float 오버로드는 float의 반올림 경계를 사용하므로 double로 승격된 오차 자릿수를 출력하지 않습니다.
+        // @note NaN/Inf는 "nan", "inf", "-inf"로 출력합니다. 공간이 부족하면 아무것도 기록하지 않습니다.
         // ---------------------------------------------------------
-        void appendFloat(char* buffer, size_t maxLen, size_t& curLen, double val, int decimalPlaces = 2);
+        void appendShortest(char* buffer, size_t maxLen, size_t& curLen, double val);
+        void appendShortest(char* buffer, size_t maxLen, size_t& curLen, float val);
     } // string
 } // namespace cms
 
@@ -0,0 +1,58 @@
+/// @author comser.dev
+/// @brief StringView의 구현부입니다. (추출/분할, StringBase 변환)
+
+#include <cstring>
+#include "cmsStringView.h"
+#include "cmsStringBase.h"
+
+namespace cms {
+
+    /// [StringView] StringBase 현재 내용을 가리키는 생성자
+    StringView::StringView(const StringBase& str) noexcept : StringView(str.c_str(), str.length()) {}
+
+    /// [substring] 글자 단위 구간 구현
+    ///
+    /// 바이트 오프셋 변환만 수행하며, 경계는 항상 글자 시작 위치이므로 UTF-8이 깨지지 않습니다.
+    StringView StringView::substring(size_t left, size_t right) const {
+        if (right != 0 && right <= left) return StringView(_ptr, 0);
+        const size_t begin = cms::string::utf8ByteOffset(_ptr, _len, left);
+        if (begin >= _len) return StringView(_ptr + _len, 0);
+        const size_t end = (right == 0) ? _len : begin + cms::string::utf8ByteOffset(_ptr + begin, _len - begin, right - left);
+        return StringView(_ptr + begin, end - begin);
+    }
+
+    /// [byteSubstring] 바이트 단위 구간 구현
+    StringView StringView::byteSubstring(size_t startByte, size_t endByte) const {
+        if (startByte >= _len) return StringView(_ptr + _len, 0);
+        const size_t end = (endByte == 0 || endByte > _len) ? _len : endByte;
+        return (end > startByte) ? StringView(_ptr + startByte, end - startByte) : StringView(_ptr + startByte, 0);
+    }
+
+    /// [trimmed] 앞뒤 공백 제외 구현 (StringBase::trim과 같은 문자 기준)
+    StringView StringView::trimmed() const {
+        size_t begin = 0;
+        size_t end = _len;
+        while (begin < end && cms::string::isSpace((unsigned char)_ptr[begin])) ++begin;
+        while (end > begin && cms::string::isSpace((unsigned char)_ptr[end - 1])) --end;
+        return StringView(_ptr + begin, end - begin);
+    }
+
+    /// [split] 비파괴 분할 구현 (memchr로 구분 문자 탐색)
+    size_t StringView::split(char delimiter, StringView* out, size_t maxTokens) const {
+        if (!out || maxTokens == 0) return 0;
+
+        size_t count = 0;
+        const char* start = _ptr;
+        const char* end = _ptr + _len;
+        while (count < maxTokens - 1) {
+            const char* hit = static_cast<const char*>(memchr(start, delimiter, (size_t)(end - start)));
+            if (!hit) break;
+            out[count++] = StringView(start, (size_t)(hit - start));
+            start = hit + 1;
+        }
+        // 마지막 조각은 남은 전체를 포함
+        out[count++] = StringView(start, (size_t)(end - start));
+        return count;
+    }
+
+} // namespace cms
@@ -0,0 +1,159 @@
+/// @author comser.dev
+///
+/// 다른 버퍼의 일부를 (포인터, 길이)로 가리키는 읽기 전용 문자열 뷰입니다.
+/// 검색/비교/분할 결과를 복사 없이 다루어 파싱 경로의 String<N> 임시 객체를 없앱니다.
+
+#pragma once // 중복 포함 방지
+
+#include <stddef.h> // size_t 정의
+#include <stdint.h> // uint32_t 정의
+#include <string>   // std::char_traits (constexpr strlen)
+#include "cmsStringUtil.h"
+
+namespace cms {
+
+    class StringBase;
+
+// ==================================================================================================
+// [StringView] 개요
+// - 왜 존재하는가: substring()/byteSubstring()/splitTo()는 결과를 String<N>으로 복사하고, Token은 조회 API가 적어
+//   읽기만 하는 파싱에도 복사와 strlen 재계산이 반복됩니다. 원본을 그대로 가리킨 채 StringBase와 같은 조회 API를 쓰기 위해 존재합니다.
+// - 어떻게 동작하는가: 길이를 함께 들고 다니므로 NUL 종료가 필요 없고, 모든 검색/비교는 cms::string의 길이 기반 함수로 수행합니다.
+//   StringBase의 검색/비교/결합 함수는 StringView를 받는 오버로드를 제공하여 strlen 없이 동작합니다.
+//
+// 사용 예:
+// @code
+// cms::StringView line = rx;                          // "SET temp=23.5"
+// cms::StringView parts[2];
+// if (line.split(' ', parts, 2) == 2 && parts[0] == "SET") {
+//     cms::StringView kv = parts[1];
+//     int eq = kv.find("=");
+//     float t;
+//     if (eq > 0 && kv.substring(eq + 1).parse(t)) { ... }   // 복사 0회
+// }
+// @endcode
+//
+// @note 뷰는 원본 버퍼를 소유하지 않습니다. 원본이 수정되거나 소멸하면 뷰도 무효가 됩니다.
+// ==================================================================================================
+
+    /// 소유하지 않는 읽기 전용 문자열 뷰입니다.
+    ///
+    /// Why: 부분 문자열을 복사하지 않고 조회/비교/분할하기 위함입니다.
+    /// How: (ptr, len) 두 값만 가지므로 값으로 전달하며, 문자 인덱스 API는 StringBase와 같이 UTF-8 글자 단위입니다.
+    class StringView {
+    public:
+        constexpr StringView() noexcept : _ptr(""), _len(0) {}
+        constexpr StringView(const char* ptr, size_t len) noexcept : _ptr(ptr ? ptr : ""), _len(ptr ? len : 0) {}
+
+        /// NUL 종료 문자열 (리터럴은 컴파일 타임에 길이 계산)
+        constexpr StringView(const char* str) noexcept
+            : _ptr(str ? str : ""), _len(str ? std::char_traits<char>::length(str) : 0) {}
+
+        /// Token과 같은 구간을 가리킵니다.
+        constexpr StringView(const cms::string::Token& token) noexcept : StringView(token.ptr, token.len) {}
+
+        /// StringBase의 현재 내용을 가리킵니다. (이후 원본의 수정은 뷰를 무효화함)
+        StringView(const StringBase& str) noexcept;
+
+        // ---------------------------------------------------------
+        // 상태 및 정보
+        // ---------------------------------------------------------
+
+        /// [data] 시작 포인터 (NUL 종료가 보장되지 않음)
+        constexpr const char* data() const noexcept { return _ptr; }
+        /// [length] 바이트 길이
+        constexpr size_t length() const noexcept { return _len; }
+        /// [isEmpty] 빈 뷰 여부
+        constexpr bool isEmpty() const noexcept { return _len == 0; }
+        /// [operator[]] 바이트 단위 읽기
+        constexpr char operator[](size_t i) const noexcept { return _ptr[i]; }
+        /// [count] UTF-8 글자 수 (O(길이))
+        size_t count() const { return cms::string::utf8_strlen(_ptr, _len); }
+        /// [hash] DJB2 해시 ("cmd"_hash / "cmd"_ihash와 비교)
+        constexpr uint32_t hash(bool ignoreCase = false) const noexcept { return cms::string::djb2(_ptr, _len, ignoreCase); }
+        /// [toToken] 같은 구간의 Token
+        cms::string::Token toToken() const noexcept { return cms::string::Token{_ptr, _len}; }
+
+        // ---------------------------------------------------------
+        // 검색 및 비교 (모두 복사 없음)
+        // ---------------------------------------------------------
+
+        /// [find] target이 처음 나타나는 글자 위치 (찾지 못하면 -1)
+        int find(StringView target, size_t startChar = 0, bool ignoreCase = false) const {
+            return cms::string::find(_ptr, _len, target._ptr, target._len, startChar, ignoreCase);
+        }
+        /// [indexOf] find와 같음
+        int indexOf(StringView target, size_t startChar = 0, bool ignoreCase = false) const {
+            return find(target, startChar, ignoreCase);
+        }
+        /// [lastIndexOf] target이 마지막으로 나타나는 글자 위치 (찾지 못하면 -1)
+        int lastIndexOf(StringView target, bool ignoreCase = false) const {
+            return cms::string::lastIndexOf(_ptr, _len, target._ptr, target._len, ignoreCase);
+        }
+        /// [contains] 부분 문자열 포함 여부
+        bool contains(StringView target, bool ignoreCase = false) const {
+            return cms::string::contains(_ptr, _len, target._ptr, target._len, ignoreCase);
+        }
+        /// [startsWith] 접두사 일치 여부
+        bool startsWith(StringView prefix, bool ignoreCase = false) const {
+            return prefix._len <= _len && cms::string::equals(_ptr, prefix._len, prefix._ptr, prefix._len, ignoreCase);
+        }
+        /// [endsWith] 접미사 일치 여부
+        bool endsWith(StringView suffix, bool ignoreCase = false) const {
+            return suffix._len <= _len && cms::string::equals(_ptr + _len - suffix._len, suffix._len, suffix._ptr, suffix._len, ignoreCase);
+        }
+        /// [equals] 내용 일치 여부
+        bool equals(StringView other, bool ignoreCase = false) const {
+            return cms::string::equals(_ptr, _len, other._ptr, other._len, ignoreCase);
+        }
+        /// [compare] 사전식 비교 (음수: 앞, 0: 같음, 양수: 뒤)
+        int compare(StringView other) const { return cms::string::compare(_ptr, _len, other._ptr, other._len); }
+        /// [compareIgnoreCase] 대소문자를 무시한 사전식 비교
+        int compareIgnoreCase(StringView other) const {
+            return cms::string::compareIgnoreCase(_ptr, _len, other._ptr, other._len);
+        }
+
+        bool operator==(StringView other) const { return equals(other); }
+        bool operator!=(StringView other) const { return !equals(other); }
+        bool operator<(StringView other) const { return compare(other) < 0; }
+        bool operator>(StringView other) const { return compare(other) > 0; }
+
+        // ---------------------------------------------------------
+        // 추출 및 분할 (결과도 같은 원본을 가리키는 뷰)
+        // ---------------------------------------------------------
+
+        /// [substring] 글자 단위 [left, right) 구간 (right가 0이면 끝까지, StringBase::substring과 같은 규칙)
+        StringView substring(size_t left, size_t right = 0) const;
+        /// [byteSubstring] 바이트 단위 [startByte, endByte) 구간 (endByte가 0이면 끝까지, UTF-8 경계 보정 없음)
+        StringView byteSubstring(size_t startByte, size_t endByte = 0) const;
+        /// [trimmed] 앞뒤 공백/제어 문자를 제외한 구간
+        StringView trimmed() const;
+
+        /// [split] 구분 문자로 분할 (StringBase::split과 같이 마지막 조각이 남은 전체를 포함)
+        /// @return 분할된 조각 수
+        size_t split(char delimiter, StringView* out, size_t maxTokens) const;
+
+        /// [tokenize] 지연 분할기 (구분 문자 집합, 따옴표, 이스케이프 지원)
+        cms::string::Tokenizer tokenize(const char* delimiters, char quote = '\0', char escape = '\0') const noexcept {
+            return cms::string::Tokenizer(_ptr, _len, delimiters, quote, escape);
+        }
+
+        // ---------------------------------------------------------
+        // 변환
+        // ---------------------------------------------------------
+
+        int toInt() const { return cms::string::toInt(_ptr, _len); }
+        double toFloat() const { return cms::string::toFloat(_ptr, _len); }
+
+        /// [parse] 전체를 숫자로 변환 (앞뒤 공백 허용, 실패 시 out 유지, cms::string::parse 참고)
+        template<typename T>
+        cms::string::ParseResult parse(T& out, int base = 10) const {
+            return cms::string::parse(toToken(), out, base);
+        }
+
+    private:
+        const char* _ptr; ///< 시작 포인터 (nullptr 대신 항상 유효한 주소)
+        size_t _len;      ///< 바이트 길이
+    };
+
+} // namespace cms
@@ -0,0 +1,310 @@
+#define CMS_BENCH     1
+
+#ifdef CMS_BENCH
+
+/// @author comser.dev
+///
+/// 문자열, 큐, 로거의 성능 회귀를 잡기 위한 벤치마크입니다.
+/// 결과는 한 줄에 하나씩 JSON(JSON Lines)으로 출력하므로 릴리스 간 결과를 그대로 비교(diff/스크립트)할 수 있습니다.
+///
+/// - Native: std::chrono::steady_clock 기준 나노초 (unit: "ns")
+/// - ESP32 (Arduino): CCOUNT 사이클 카운터 기준 CPU 사이클 (unit: "cycles"), setup()에서 한 번 실행
+///
+/// 출력 예:
+/// {"bench":"string.find","input":"hangul","threads":1,"ops":20000,"per_op":812.4,"unit":"ns"}
+
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include "../src/cmsString.h"
+#include "../src/cmsQueue.h"
+#include "../src/cmsAsyncLogger.h"
+
+#if defined(ARDUINO) && defined(ESP32)
+#include <Arduino.h>
+#endif
+
+namespace {
+
+// --------------------------------------------------------------------------------------------------
+// [측정 도구] 시계, 결과 출력, 최적화 방지
+// --------------------------------------------------------------------------------------------------
+
+#if defined(ARDUINO) && defined(ESP32)
+    /// CCOUNT는 32비트라 240MHz에서 약 17초마다 돌아오므로, 각 측정 구간은 그보다 짧게 유지합니다.
+    using Ticks = uint32_t;
+    inline Ticks now() { return ESP.getCycleCount(); }
+    constexpr const char* UNIT = "cycles";
+    constexpr uint32_t SCALE = 1;   // 온타깃은 반복 횟수를 줄여 구간당 1초 미만 유지
+#else
+    using Ticks = uint64_t;
+    inline Ticks now() {
+        using namespace std::chrono;
+        return (Ticks)duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+    }
+    constexpr const char* UNIT = "ns";
+    constexpr uint32_t SCALE = 4;
+#endif
+
+    /// 컴파일러가 결과를 쓰지 않는 루프를 지우지 못하도록 값을 흘려보내는 곳
+    volatile uintptr_t g_sink = 0;
+
+    void report(const char* bench, const char* input, unsigned threads, uint32_t ops, Ticks elapsed) {
+        std::printf("{\"bench\":\"%s\",\"input\":\"%s\",\"threads\":%u,\"ops\":%lu,\"per_op\":%.1f,\"unit\":\"%s\"}\n",
+                    bench, input, threads, (unsigned long)ops, ops ? (double)elapsed / ops : 0.0, UNIT);
+    }
+
+    /// fn(i)를 ops번 실행한 시간을 측정하여 보고합니다.
+    template <typename Fn>
+    void run(const char* bench, const char* input, uint32_t ops, Fn&& fn) {
+        for (uint32_t i = 0; i < ops / 16; ++i) fn(i); // 캐시/분기 예측 워밍업
+        const Ticks start = now();
+        for (uint32_t i = 0; i < ops; ++i) fn(i);
+        report(bench, input, 1, ops, (Ticks)(now() - start));
+    }
+
+    // --------------------------------------------------------------------------------------------------
+    // [문자열] append / appendPrintf / 숫자 직렬화 / find / replace / count
+    // --------------------------------------------------------------------------------------------------
+
+    struct TextInput {
+        const char* name;
+        const char* piece;    // 본문을 채울 반복 단위
+        const char* needle;   // 본문 끝에만 있는 검색어
+        const char* from;     // replace 대상 (본문에 여러 번 등장)
+        const char* to;
+    };
+
+    const TextInput INPUTS[] = {
+        {"ascii",  "sensor value ok ", "END-MARK", "ok", "good"},
+        {"hangul", "온도 센서 정상 값 ", "끝표시", "정상", "양호함"},
+    };
+
+    void benchStrings() {
+        const uint32_t ops = 20000 * SCALE;
+
+        for (const TextInput& in : INPUTS) {
+            cms::String<512> text;
+            while (text.length() + strlen(in.piece) + strlen(in.needle) < 480) text += in.piece;
+            text += in.needle;
+            const size_t pieceLen = strlen(in.piece);
+
+            cms::String<512> s;
+            run("string.append", in.name, ops, [&](uint32_t i) {
+                if ((i & 15) == 0) s.clear();
+                s.append(in.piece, pieceLen);
+                g_sink = g_sink + s.length();
+            });
+
+            run("string.find", in.name, ops, [&](uint32_t) {
+                g_sink = g_sink + (uintptr_t)text.find(in.needle);
+            });
+
+            run("string.replace", in.name, ops / 4, [&](uint32_t) {
+                s = text;
+                s.replace(in.from, in.to);
+                g_sink = g_sink + s.length();
+            });
+
+            run("string.count", in.name, ops, [&](uint32_t) {
+                text[0] = text[0]; // 쓰기 접근으로 글자 수 캐시를 무효화하여 매번 다시 셈
+                g_sink = g_sink + text.count();
+            });
+        }
+
+        cms::String<128> s;
+        run("string.appendPrintf", "mixed", ops, [&](uint32_t i) {
+            s.clear();
+            s.appendPrintf("id=%d t=%.2f st=%s hex=%X", (int)i, 23.5 + (i & 7), "ok", (unsigned)i);
+            g_sink = g_sink + s.length();
+        });
+        run("string.appendInt", "int32", ops, [&](uint32_t i) {
+            s.clear();
+            s.appendInt((long)(i * 2654435761u));
+            g_sink = g_sink + s.length();
+        });
+        run("string.appendFloat", "2dp", ops, [&](uint32_t i) {
+            s.clear();
+            s.appendFloat(i * 0.37f, 2);
+            g_sink = g_sink + s.length();
+        });
+    }
+
+    // --------------------------------------------------------------------------------------------------
+    // [큐] 단일 스레드 enqueue/pop, 생산자 1~4개 경합
+    // --------------------------------------------------------------------------------------------------
+
+    template <typename Q>
+    void benchQueueContention(const char* bench, unsigned producers, uint32_t perProducer) {
+        static Q q;
+        std::atomic<unsigned> running{producers};
+        std::atomic<bool> go{false};
+        std::thread workers[4];
+
+        for (unsigned p = 0; p < producers; ++p) {
+            workers[p] = std::thread([&, p]() {
+                while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+                for (uint32_t i = 0; i < perProducer; ++i) q.enqueue((int)(p * perProducer + i));
+                running.fetch_sub(1, std::memory_order_release);
+            });
+        }
+
+        // 소비자는 현재 스레드: 생산자가 모두 끝나고 큐가 빌 때까지 꺼냄
+        const Ticks start = now();
+        go.store(true, std::memory_order_release);
+        int v = 0;
+        uint32_t popped = 0;
+        for (;;) {
+            if (q.pop(v)) { popped++; continue; }
+            if (running.load(std::memory_order_acquire) == 0) {
+                while (q.pop(v)) popped++;
+                break;
+            }
+            std::this_thread::yield(); // 단일 코어 타깃에서 생산자에게 CPU를 양보
+        }
+        const Ticks elapsed = (Ticks)(now() - start);
+        for (unsigned p = 0; p < producers; ++p) workers[p].join();
+
+        g_sink = g_sink + popped;
+        report(bench, "int", producers, producers * perProducer, elapsed);
+    }
+
+    void benchQueues() {
+        const uint32_t ops = 50000 * SCALE;
+
+        cms::Queue<int, 256> plain;
+        run("queue.enqueue_pop", "int", ops, [&](uint32_t i) {
+            plain.enqueue((int)i);
+            int v = 0;
+            if (plain.pop(v)) g_sink = g_sink + (uintptr_t)v;
+        });
+
+        int samples[64];
+        for (int i = 0; i < 64; ++i) samples[i] = i;
+        run("queue.enqueueN_popN", "int x64", ops / 64, [&](uint32_t) {
+            plain.enqueueN(samples, 64);
+            int out[64];
+            const size_t got = plain.popN(out, 64);
+            g_sink = g_sink + got + (got > 0 ? (uintptr_t)out[got - 1] : 0);
+        });
+
+        const uint32_t perProducer = 10000 * SCALE;
+        for (unsigned producers = 1; producers <= 4; ++producers) {
+            benchQueueContention<cms::ThreadSafeQueue<int, 256>>("threadsafe_queue.contention", producers, perProducer);
+        }
+        for (unsigned producers = 1; producers <= 4; ++producers) {
+            benchQueueContention<cms::MpmcQueue<int, 256, cms::QueueFullPolicy::OverwriteOldest>>("mpmc_queue.contention", producers, perProducer);
+        }
+    }
+
+    // --------------------------------------------------------------------------------------------------
+    // [로거] i() 호출 비용과 i() → update() → 출력까지의 종단 지연 (색상 켬/끔)
+    // --------------------------------------------------------------------------------------------------
+
+    /// 출력 매체 대신 바이트 수만 세는 로거 (콘솔 출력 비용을 측정에서 제외)
+    class NullLogger : public cms::AsyncLogger<128, 32> {
+    protected:
+        void outputLog(const cms::StringBase& msg) override { g_sink = g_sink + msg.length(); }
+    };
+
+    /// NullLogger와 같지만 코어/스레드별 shard 큐를 사용하는 로거
+    class NullShardedLogger : public cms::AsyncLogger<128, 32, cms::ShardedLogQueue> {
+    protected:
+        void outputLog(const cms::StringBase& msg) override { g_sink = g_sink + msg.length(); }
+    };
+
+    /// 생산자 스레드 여러 개가 동시에 i()를 호출하는 비용 (소비는 현재 스레드에서 계속 비움)
+    template <typename Logger>
+    void benchLoggerContention(const char* input, unsigned producers, uint32_t perProducer) {
+        static Logger log;
+        log.begin(cms::LogLevel::Debug, false);
+        std::atomic<unsigned> running{producers};
+        std::atomic<bool> go{false};
+        std::thread workers[4];
+
+        for (unsigned p = 0; p < producers; ++p) {
+            workers[p] = std::thread([&]() {
+                while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+                for (uint32_t i = 0; i < perProducer; ++i) log.i("[Bench] sample=%d", (int)i);
+                running.fetch_sub(1, std::memory_order_release);
+            });
+        }
+
+        const Ticks start = now();
+        go.store(true, std::memory_order_release);
+        while (running.load(std::memory_order_acquire) != 0) {
+            if (log.updateBatch() == 0) std::this_thread::yield();
+        }
+        const Ticks elapsed = (Ticks)(now() - start);
+        for (unsigned p = 0; p < producers; ++p) workers[p].join();
+        while (log.updateBatch() > 0) {}
+
+        report("logger.i.contention", input, producers, producers * perProducer, elapsed);
+    }
+
+    void benchLogger() {
+        const uint32_t ops = 5000 * SCALE;
+
+        for (int color = 0; color <= 1; ++color) {
+            const char* input = color ? "color" : "plain";
+            static NullLogger log; // 약 6.5KB: Arduino loop 태스크 스택(기본 8KB)에 두지 않음
+            log.begin(cms::LogLevel::Debug, color != 0);
+
+            // 1. 호출자 측 비용 (큐가 차기 전에 주기적으로 비움, 비우는 시간은 제외)
+            Ticks producer = 0;
+            for (uint32_t i = 0; i < ops; ++i) {
+                const Ticks t0 = now();
+                log.i("[Bench] sample=%d value=%.2f status=%s", (int)i, i * 0.5, "ok");
+                producer += (Ticks)(now() - t0);
+                if ((i & 15) == 15) while (log.update());
+            }
+            while (log.update());
+            report("logger.i", input, 1, ops, producer);
+
+            // 2. 종단 지연: 한 줄 기록부터 포맷·스타일링·출력 완료까지
+            run("logger.end_to_end", input, ops, [&](uint32_t i) {
+                log.i("[Bench] sample=%d value=%.2f status=%s", (int)i, i * 0.5, "ok");
+                while (log.update());
+            });
+        }
+
+        const uint32_t perProducer = 2000 * SCALE;
+        for (unsigned producers = 1; producers <= 4; ++producers) {
+            benchLoggerContention<NullLogger>("shared", producers, perProducer);
+            benchLoggerContention<NullShardedLogger>("sharded", producers, perProducer);
+        }
+    }
+
+    void runAll() {
+        benchStrings();
+        benchQueues();
+        benchLogger();
+    }
+
+} // namespace
+
+#if defined(ARDUINO) && defined(ESP32)
+
+void setup() {
+    Serial.begin(115200);
+    delay(500);
+    runAll();
+}
+
+void loop() {
+    delay(1000);
+}
+
+#else
+
+int main() {
+    runAll();
+    return 0;
+}
+
+#endif
+
+#endif // CMS_BENCH
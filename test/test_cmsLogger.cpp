@@ -3,7 +3,16 @@
 #ifdef CMS_LOGGER_TEST
 
 #include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <cstring>
+#ifndef ARDUINO
+#include <pthread.h>
+#endif
 #include "../src/cmsAsyncLogger.h"
+#include "../src/cmsLogSink.h"
 
 /**
  * @brief 테스트용 커스텀 로거
@@ -30,7 +39,195 @@ protected:
     }
 };
 
+/**
+ * @brief 일괄 출력 테스트용 로거
+ * outputLogBatch 오버라이딩으로 묶음 단위 전달을 확인하며, 묶음별 개수와 전달된 줄을 보관합니다.
+ */
+class BatchLogger : public cms::AsyncLogger<64, 8> {
+public:
+    std::vector<size_t> batches;
+    std::vector<std::string> lines;
+
+protected:
+    void outputLogBatch(const cms::StringBase* const* msgs, size_t count) override {
+        std::cout << "[Batch " << count << "개]";
+        for (size_t i = 0; i < count; ++i) {
+            std::cout << " " << msgs[i]->c_str();
+            lines.emplace_back(msgs[i]->c_str(), msgs[i]->length());
+        }
+        std::cout << std::endl;
+        batches.push_back(count);
+    }
+};
+
+/**
+ * @brief 검증용 sink
+ * 전달된 줄과 레벨을 보관하여 출력 내용을 확인합니다.
+ */
+class CaptureSink : public cms::LogSink {
+public:
+    std::vector<std::string> lines;
+    std::vector<cms::LogLevel> levels;
+
+    void write(const cms::StringBase& line, cms::LogLevel level) override {
+        lines.emplace_back(line.c_str(), line.length());
+        levels.push_back(level);
+    }
+
+    /// fragment를 포함한 줄 수
+    size_t count(const char* fragment) const {
+        size_t n = 0;
+        for (const std::string& l : lines) n += (l.find(fragment) != std::string::npos) ? 1 : 0;
+        return n;
+    }
+};
+
+/**
+ * @brief 블록 기록 검증용 버퍼 sink
+ * 16바이트 페이지로 기록된 블록의 크기와 내용을 보관하며, 실패를 흉내 낼 수 있습니다.
+ */
+class MemoryBlockSink : public cms::BufferedLogSinkBase {
+public:
+    std::vector<size_t> blocks;
+    std::string written;
+    bool fail = false;
+
+    MemoryBlockSink() : cms::BufferedLogSinkBase(_page, sizeof(_page)) {}
+
+protected:
+    bool writeBlock(const uint8_t* data, size_t len) override {
+        if (fail) return false;
+        blocks.push_back(len);
+        written.append(reinterpret_cast<const char*>(data), len);
+        return true;
+    }
+
+private:
+    uint8_t _page[16];
+};
+
+/**
+ * @brief handleLog 필터가 큐 공간을 차지하지 않는지 확인하기 위한 로거
+ * "DROP"이 든 로그는 가로채고, "REWRITE"가 든 로그는 변형한 사본을 pushToQueue로 넣은 뒤 가로챕니다.
+ */
+template <template <typename, size_t> class Q>
+class FilterLogger : public cms::AsyncLogger<64, 4, Q> {
+protected:
+    bool handleLog(const cms::StringBase& msg) override {
+        if (msg.contains("REWRITE")) {
+            this->pushToQueue(cms::String<64>("rewritten"));
+            return true;
+        }
+        return msg.contains("DROP");
+    }
+};
+
+/// 큐를 가득 채운 뒤 가로채는 로그를 넣어도, 가로채는 로그가 없을 때와 같은 줄이 출력되는지 확인합니다.
+template <template <typename, size_t> class Q>
+static bool filteredKeepsQueue(const char* name) {
+    FilterLogger<Q> ref;
+    FilterLogger<Q> log;
+    CaptureSink refCap, cap;
+    ref.begin(cms::LogLevel::Debug, false);
+    log.begin(cms::LogLevel::Debug, false);
+    ref.addSink(refCap);
+    log.addSink(cap);
+    for (int i = 0; i < 4; ++i) {
+        ref.i("keep %d", i);
+        log.i("keep %d", i);
+    }
+    for (int i = 0; i < 3; ++i) log.i("DROP %d", i);
+    while (ref.update());
+    while (log.update());
+    const cms::LogStats full = log.stats();
+    bool same = cap.lines.size() == refCap.lines.size() && cap.lines.size() >= 2;
+    for (size_t i = 0; same && i < cap.lines.size(); ++i) {
+        // 타임스탬프는 다를 수 있으므로 첫 ']' 뒤(레벨 배지와 본문)만 비교
+        same = cap.lines[i].substr(cap.lines[i].find(']')) == refCap.lines[i].substr(refCap.lines[i].find(']'));
+    }
+    const bool keptAll = same && cap.count("keep 3") == 1 && full.overwritten == ref.stats().overwritten && full.filtered == 3;
+
+    // 빈 자리에서 가로챈 로그도 슬롯을 남기지 않음 (pushToQueue로 넣은 사본 뒤에 남는 빈 슬롯은 출력되지 않음)
+    const size_t before = cap.lines.size();
+    log.resetStats();
+    log.i("DROP alone");
+    log.i("REWRITE me");
+    const size_t queued = log.queue().size();
+    while (log.update());
+    const bool noHoles = queued <= 2 && cap.lines.size() == before + 1 && cap.count("rewritten") == 1 && log.stats().filtered == 2;
+    std::cout << name << ": 출력 " << before << "줄 (필터 없음: " << refCap.lines.size() << "줄), 덮어쓰기 "
+              << full.overwritten << ", 가로챔 후 큐 " << queued << std::endl;
+    return keptAll && noHoles;
+}
+
+#ifndef ARDUINO
+/// 칠해 둔 스택에서 fn을 실행하고, 덮어쓰인 깊이(바이트)로 최대 스택 사용량을 측정합니다. (스택 페인팅)
+///
+/// 스레드 진입 프레임과 TLS도 포함되므로 절대값보다는 두 측정값의 차이를 비교하는 데 사용합니다.
+template <typename Fn>
+static size_t measureStack(Fn fn) {
+    constexpr size_t STACK_BYTES = 256 * 1024;
+    constexpr unsigned char PAINT = 0xA5;
+    alignas(64) static unsigned char stack[STACK_BYTES];
+    memset(stack, PAINT, sizeof(stack));
+
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstack(&attr, stack, sizeof(stack));
+    pthread_t th;
+    pthread_create(&th, &attr, [](void* arg) -> void* { (*static_cast<Fn*>(arg))(); return nullptr; }, &fn);
+    pthread_join(th, nullptr);
+    pthread_attr_destroy(&attr);
+
+    size_t untouched = 0; // 스택은 높은 주소에서 낮은 주소로 자라므로 앞쪽에 칠한 값이 남음
+    while (untouched < sizeof(stack) && stack[untouched] == PAINT) ++untouched;
+    return sizeof(stack) - untouched;
+}
+#endif
+
+#ifndef ARDUINO // native의 스레드 기준 shard 배정 규칙에 의존
+/// ShardedLogQueue의 shard 배정 규칙(스레드 ID 해시)에 맞는 스레드를 찾아 그 shard에 stamp 순서대로 로그를 넣습니다.
+///
+/// 종료된 스레드의 ID는 재사용될 수 있으므로, 맞지 않으면 살아 있는 스레드 안에서 다음 스레드를 만들어 새 ID를 얻습니다.
+template <typename Queue>
+static void fillShard(Queue& q, size_t shard, size_t shards, const uint32_t* stamps, const char* const* texts, size_t n) {
+    std::thread t([&]() {
+        if (std::hash<std::thread::id>()(std::this_thread::get_id()) % shards != shard) {
+            fillShard(q, shard, shards, stamps, texts, n);
+            return;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            cms::LogEntry<32> e;
+            e.meta.stamp = stamps[i];
+            e.text = texts[i];
+            q.enqueue(e);
+        }
+    });
+    t.join();
+}
+#endif
+
+/// line이 "[HH:MM:SS.f...] " 형식(소수부 fracDigits자리)의 벽시계 타임스탬프로 시작하는지 확인합니다.
+static bool hasClockPrefix(const std::string& line, size_t fracDigits) {
+    const std::string shape = "[00:00:00." + std::string(fracDigits, '0') + "] ";
+    if (line.size() < shape.size()) return false;
+    for (size_t i = 0; i < shape.size(); ++i) {
+        const bool digit = line[i] >= '0' && line[i] <= '9';
+        if (shape[i] == '0' ? !digit : line[i] != shape[i]) return false;
+    }
+    return true;
+}
+
+/// 검증 결과를 출력하고 누적합니다.
+static bool check(const char* name, bool ok, bool& allOk) {
+    std::cout << name << " 검증: " << (ok ? "OK" : "FAIL") << std::endl;
+    allOk = allOk && ok;
+    return ok;
+}
+
 int main() {
+    bool allOk = true;
+
     // 1. 로거 인스턴스 획득 및 초기화
     auto& logger = cms::AsyncLogger<>::instance();
     logger.begin(cms::LogLevel::Debug, true);
@@ -72,7 +269,507 @@ int main() {
     std::cout << "큐에 저장된 마지막 16개의 로그만 출력됩니다:" << std::endl;
     while (logger.update());
 
-    return 0;
+    std::cout << "\n=== Test 5: 일괄 출력 (updateBatch) ===" << std::endl;
+    BatchLogger batchLog;
+    batchLog.begin(cms::LogLevel::Debug, false);
+    for (int i = 0; i < 6; ++i) {
+        batchLog.i("batch #%d", i);
+    }
+
+    // 한 묶음에 최대 60바이트: 메시지 길이에 따라 여러 번 나뉘어 전달됩니다.
+    size_t drained = batchLog.updateBatch(8, 60);
+    std::cout << "처리된 로그: " << drained << "개" << std::endl;
+    // 묶음마다 60바이트 이하로 최대한 채우고(다음 줄을 더하면 초과), 순서대로 모두 전달되어야 함
+    bool packed = drained == 6 && batchLog.lines.size() == 6 && batchLog.batches.size() > 1;
+    size_t batchNext = 0;
+    for (size_t count : batchLog.batches) {
+        size_t bytes = 0;
+        for (size_t i = 0; i < count && batchNext + i < batchLog.lines.size(); ++i) bytes += batchLog.lines[batchNext + i].size();
+        batchNext += count;
+        const bool full = batchNext >= batchLog.lines.size() || bytes + batchLog.lines[batchNext].size() > 60;
+        packed = packed && count > 0 && bytes <= 60 && full;
+    }
+    bool ordered = batchNext == 6;
+    for (size_t i = 0; ordered && i < batchLog.lines.size(); ++i) {
+        ordered = batchLog.lines[i].find("batch #" + std::to_string(i)) != std::string::npos;
+    }
+    check("일괄 출력", packed && ordered, allOk);
+
+    std::cout << "\n=== Test 6: 가변 길이 링 큐 (LogRingQueue) ===" << std::endl;
+    // 고정 슬롯 큐와 같은 RAM(128 x 8 = 1KB)에 짧은 로그를 더 많이 보관
+    cms::AsyncLogger<128, 8, cms::LogRingQueue> ringLog;
+    CaptureSink ringCap;
+    ringLog.begin(cms::LogLevel::Debug, false);
+    ringLog.addSink(ringCap);
+    for (int i = 0; i < 20; ++i) {
+        ringLog.i("ring #%d", i);
+    }
+    const size_t ringHeld = ringLog.queue().size();
+    std::cout << "보관된 로그: " << ringHeld << "줄 (고정 슬롯 큐는 8줄)"
+              << ", 링 사용률: " << ringLog.queue().utilization() << "%" << std::endl;
+    while (ringLog.update());
+    // 가장 오래된 로그부터 버려지므로, 남은 줄은 마지막 ringHeld개가 순서대로 출력되어야 함
+    bool newest = ringHeld > 8 && ringHeld <= 20 && ringCap.lines.size() == ringHeld;
+    for (size_t i = 0; newest && i < ringHeld; ++i) {
+        newest = ringCap.lines[i].find("ring #" + std::to_string(20 - ringHeld + i)) != std::string::npos;
+    }
+    check("가변 길이 링 큐", newest, allOk);
+
+    std::cout << "\n=== Test 7: 지연 포맷팅 (setDeferred) ===" << std::endl;
+    // 로그 호출 시점에는 인자만 패킹하고, 포맷팅은 update() 시점에 수행
+    cms::AsyncLogger<64, 8> deferredLog;
+    cms::AsyncLogger<64, 8, cms::LogRingQueue> deferredRing;
+    CaptureSink deferredCap, deferredRingCap;
+    deferredLog.begin(cms::LogLevel::Debug, false);
+    deferredRing.begin(cms::LogLevel::Debug, false);
+    deferredLog.addSink(deferredCap);
+    deferredRing.addSink(deferredRingCap);
+    deferredLog.setDeferred(true);
+    deferredRing.setDeferred(true);
+    deferredLog.i("[%s] temp=%.1f id=%d", "Sensor", 23.5f, 7);
+    deferredRing.w("[%s] retry %u/%x", "Net", 3u, 0xFFu);
+    while (deferredLog.update());
+    while (deferredRing.update());
+    const auto endsWith = [](const std::vector<std::string>& lines, const std::string& tail) {
+        return lines.size() == 1 && lines[0].size() >= tail.size() &&
+               lines[0].compare(lines[0].size() - tail.size(), tail.size(), tail) == 0;
+    };
+    const bool fixedOk = endsWith(deferredCap.lines, "[I] [Sensor] temp=23.5 id=7");
+    const bool ringOk = endsWith(deferredRingCap.lines, "[W] [Net] retry 3/ff");
+    check("지연 포맷팅", fixedOk && ringOk, allOk);
+
+    std::cout << "\n=== Test 8: 컴파일 타임 레벨 매크로 (CMS_LOG_*) ===" << std::endl;
+    // CMS_LOG_MIN_LEVEL 미만의 호출은 인자 평가까지 제거됩니다. (-DCMS_LOG_MIN_LEVEL=3 빌드 시 1개)
+    int evaluated = 0;
+    CMS_LOG_D(deferredLog, "macro debug %d", ++evaluated);
+    CMS_LOG_E(deferredLog, "macro error %d", ++evaluated);
+    while (deferredLog.update());
+    std::cout << "최소 레벨: " << CMS_LOG_MIN_LEVEL << ", 평가된 인자: " << evaluated << "개" << std::endl;
+    const int debugKept = (cms::LOG_MIN_LEVEL <= cms::LogLevel::Debug) ? 1 : 0;
+    const int errorKept = (cms::LOG_MIN_LEVEL <= cms::LogLevel::Error) ? 1 : 0;
+    const bool counted = evaluated == debugKept + errorKept;
+    const bool printed = deferredCap.count("macro debug 1") == (size_t)debugKept &&
+                         deferredCap.count(("macro error " + std::to_string(debugKept + 1)).c_str()) == (size_t)errorKept;
+    check("레벨 매크로", counted && printed, allOk);
+
+    std::cout << "\n=== Test 9: 사용자 키워드/태그 색상 ===" << std::endl;
+    static const cms::LogKeyword MY_KEYWORDS[] = { {"TIMEOUT", "1;93"}, {"PANIC", "1;91"} };
+    cms::AsyncLogger<128, 4> styleLog;
+    cms::ConsoleLogSink styleConsole;
+    CaptureSink styleCap;
+    styleLog.begin(cms::LogLevel::Debug, true);
+    styleLog.addSink(styleConsole, cms::LogLevel::Debug, true);
+    styleLog.addSink(styleCap, cms::LogLevel::Debug, true);
+    styleLog.setKeywords(MY_KEYWORDS, 2);
+    styleLog.setTagColor("Network", "94");
+    styleLog.w("[Network] 응답 timeout 발생, ERROR는 더 이상 강조되지 않습니다.");
+    styleLog.e("[network] 대소문자가 달라도 같은 색상, PANIC 강조");
+    while (styleLog.update());
+    const bool tagged = styleCap.count("\033[94m[Network]\033[0m") == 1 && styleCap.count("\033[94m[network]\033[0m") == 1;
+    const bool keywords = styleCap.count("\033[1;93mtimeout\033[0m") == 1 && styleCap.count("\033[1;91mPANIC\033[0m") == 1;
+    const bool replaced = styleCap.count(" ERROR는") == 1;
+    check("키워드/태그 색상", styleCap.lines.size() == 2 && tagged && keywords && replaced, allOk);
+
+    std::cout << "\n=== Test 10: 캐시 타임스탬프 / 해상도 / 시간대 ===" << std::endl;
+    cms::AsyncLogger<96, 8> clockLog;
+    cms::ConsoleLogSink clockConsole;
+    CaptureSink clockCap;
+    clockLog.begin(cms::LogLevel::Debug, false);
+    clockLog.addSink(clockConsole);
+    clockLog.addSink(clockCap);
+    clockLog.systemTimeSynced(true);
+    clockLog.setTimezoneOffset(0);
+    clockLog.setTimestampResolution(cms::TimestampResolution::Millis);
+    clockLog.i("UTC 밀리초 해상도");
+    clockLog.setTimezoneOffset(9 * 3600);
+    clockLog.setTimestampResolution(cms::TimestampResolution::Micros);
+    clockLog.i("KST 마이크로초 해상도");
+    clockLog.systemTimeSynced(false);
+    clockLog.i("Uptime (마이크로초)");
+    while (clockLog.update());
+    const std::vector<std::string>& clockLines = clockCap.lines;
+    const bool shaped = clockLines.size() == 3 && hasClockPrefix(clockLines[0], 3) && hasClockPrefix(clockLines[1], 6);
+    // 같은 순간의 UTC와 KST(UTC+9) 시각 비교
+    const bool zoned = shaped && std::stoi(clockLines[1].substr(1, 2)) == (std::stoi(clockLines[0].substr(1, 2)) + 9) % 24;
+    // 미동기화 시 "[<uptime>] " 정수 형식
+    const size_t uptimeEnd = shaped ? clockLines[2].find("] ") : std::string::npos;
+    bool uptime = uptimeEnd != std::string::npos && uptimeEnd > 1 && clockLines[2][0] == '[';
+    for (size_t i = 1; uptime && i < uptimeEnd; ++i) uptime = clockLines[2][i] >= '0' && clockLines[2][i] <= '9';
+    check("타임스탬프 형식", shaped && zoned && uptime, allOk);
+
+    std::cout << "\n=== Test 11: 로그 호출의 스택 사용량 (스택 페인팅) ===" << std::endl;
+    using BigLogger = cms::AsyncLogger<512, 16>;
+    std::cout << "MSG_SIZE=512 버퍼 상수 - 로그 호출: " << BigLogger::LOG_STACK_BYTES << "바이트 (가득 찬 큐: "
+              << BigLogger::LOG_FULL_STACK_BYTES << "바이트), update(): " << BigLogger::UPDATE_STACK_BYTES
+              << "바이트, updateBatch(): " << BigLogger::UPDATE_BATCH_STACK_BYTES << "바이트" << std::endl;
+#ifndef ARDUINO
+    {
+        // 메시지는 슬롯에 직접 조립되므로 i()의 스택 사용량은 MSG_SIZE와 무관해야 함
+        static cms::AsyncLogger<64, 4> smallLog;
+        static cms::AsyncLogger<1024, 4> hugeLog;
+        smallLog.begin(cms::LogLevel::Debug, true);
+        hugeLog.begin(cms::LogLevel::Debug, true);
+        auto logSmall = [] { smallLog.i("[Net] value=%d status=%s", 42, "ok"); };
+        auto logHuge = [] { hugeLog.i("[Net] value=%d status=%s", 42, "ok"); };
+        const size_t idle = measureStack([] {});
+        const size_t small = measureStack(logSmall);
+        const size_t huge = measureStack(logHuge);
+        while (smallLog.update());
+        while (hugeLog.update());
+
+        // 측정 방법 자체의 검증: 가득 찬 큐에서는 handleLog 판정용 메시지 버퍼(1024바이트)가 실제로 보여야 함
+        for (int i = 0; i < 4; ++i) hugeLog.i("fill %d", i);
+        const size_t hugeFull = measureStack(logHuge);
+        while (hugeLog.update());
+
+        std::cout << "i() 스택 사용량 (스레드 기본 " << idle << "바이트 제외) - MSG_SIZE=64: " << small - idle
+                  << ", MSG_SIZE=1024: " << huge - idle << ", MSG_SIZE=1024 가득 찬 큐: " << hugeFull - idle << std::endl;
+        const bool independent = huge < small + 256;      // 메시지 크기 버퍼가 있다면 약 1KB 차이
+        const bool detectable = hugeFull >= huge + 1024;  // 버퍼가 있는 경로는 측정에 드러남
+        check("로그 호출 스택", independent && detectable, allOk);
+    }
+#endif
+
+    std::cout << "\n=== Test 12: 반복 억제 (setRepeatWindow) ===" << std::endl;
+    {
+        cms::AsyncLogger<128, 16> repeatLog;
+        CaptureSink cap;
+        repeatLog.begin(cms::LogLevel::Debug, false);
+        repeatLog.addSink(cap);
+        repeatLog.setRepeatWindow(60000);
+        for (int i = 0; i < 10; ++i) repeatLog.w("센서 응답 없음 #%d", i); // 같은 호출 위치
+        repeatLog.i("다른 위치의 로그");
+        while (repeatLog.update());
+        const bool collapsed = cap.count("센서 응답 없음") == 1 && cap.count("다른 위치") == 1 &&
+                               repeatLog.stats().suppressed == 9;
+
+        repeatLog.flushSuppressed();                                  // 남은 반복 개수를 요약으로
+        while (repeatLog.update());
+        const bool summarized = cap.count("반복 9회 생략") == 1 && cap.levels.back() == cms::LogLevel::Warn;
+        repeatLog.flushSuppressed();                                  // 이미 요약했으면 아무것도 남기지 않음
+        const bool once = !repeatLog.update();
+
+        // 구간이 끝나면 같은 위치도 다시 출력되고, 이전 구간의 반복 개수가 요약으로 남음
+        repeatLog.setRepeatWindow(50);
+        for (int i = 0; i < 3; ++i) repeatLog.e("재시도 실패 #%d", i);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        for (int i = 0; i < 1; ++i) repeatLog.e("재시도 실패 #%d", i + 3);
+        while (repeatLog.update());
+        const bool expired = cap.count("재시도 실패") == 3 && cap.count("반복 2회 생략") == 1;
+        for (const std::string& l : cap.lines) std::cout << "  " << l << std::endl;
+        check("반복 억제", collapsed && summarized && once && expired, allOk);
+    }
+
+    std::cout << "\n=== Test 13: 레벨별 속도 제한 (setRateLimit) ===" << std::endl;
+    {
+        cms::AsyncLogger<128, 16> rateLog;
+        CaptureSink cap;
+        rateLog.begin(cms::LogLevel::Debug, false);
+        rateLog.addSink(cap);
+        rateLog.setRateLimit(cms::LogLevel::Info, 10, 3);            // 초당 10줄, 순간 3줄
+        for (int i = 0; i < 10; ++i) rateLog.i("burst #%d", i);
+        rateLog.w("다른 레벨은 제한 없음");
+        while (rateLog.update());
+        const bool limited = cap.count("burst") == 3 && cap.count("다른 레벨") == 1 && rateLog.stats().rateLimited == 7;
+
+        // 긴 공백 뒤에도 버킷은 burst까지만 채워짐
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        for (int i = 0; i < 5; ++i) rateLog.i("refill #%d", i);
+        while (rateLog.update());
+        const bool refilled = cap.count("refill") == 3 && cap.count("7개 로그 생략") == 1;
+
+        rateLog.flushSuppressed();
+        while (rateLog.update());
+        const bool flushed = cap.count("2개 로그 생략") == 1 && rateLog.stats().rateLimited == 9;
+        for (const std::string& l : cap.lines) std::cout << "  " << l << std::endl;
+        check("속도 제한", limited && refilled && flushed, allOk);
+    }
+
+    std::cout << "\n=== Test 14: 운영 통계 (stats / resetStats) ===" << std::endl;
+    {
+        using StatLogger = cms::AsyncLogger<64, 4>;
+        StatLogger statLog;
+        CaptureSink cap;
+        statLog.begin(cms::LogLevel::Debug, false);
+        statLog.addSink(cap);
+        for (int i = 0; i < 6; ++i) statLog.i("stat #%d", i);   // 깊이 4: 오래된 2줄이 밀려남
+        cms::LogStats st = statLog.stats();
+        const bool overwrite = st.produced == 6 && st.overwritten == 2 && st.highWater == 4 && st.dropped == 0 &&
+                               statLog.queue().stats().enqueued == 6;
+        while (statLog.update());
+        st = statLog.stats();
+        uint32_t histogram = 0;
+        for (uint32_t b : st.latency) histogram += b;
+        const bool outputCounted = st.output == 4 && histogram == 4 && cap.count("stat #5") == 1 && cap.count("stat #0") == 0;
+
+        // 가장 오래된 슬롯이 기록 중이면 덮어쓰지 못하고 새 로그를 버림
+        StatLogger::QueueType::Slot held = statLog.queue().reserve();
+        for (int i = 0; i < 4; ++i) statLog.i("held #%d", i);
+        st = statLog.stats();
+        const bool dropped = st.dropped == 1 && statLog.queue().stats().dropped == 1 && st.overwritten == 2;
+        held->meta = cms::LogMeta();
+        held->text.clear();                                        // 빈 슬롯은 출력 없이 건너뜀
+        statLog.queue().commit(held);
+        while (statLog.update());
+
+        statLog.i("이 줄은 64바이트 MSG_SIZE보다 길어서 잘립니다: 0123456789012345678901234567890123456789");
+        const bool truncated = statLog.stats().truncated == 1;
+
+        TestLogger filterLog;
+        filterLog.begin(cms::LogLevel::Debug);
+        filterLog.e("SECRET 토큰");
+        const bool filtered = filterLog.stats().filtered == 1 && filterLog.stats().produced == 1;
+
+        statLog.resetStats();                                      // highWater는 현재 개수(잘린 로그 1줄)부터 다시 기록
+        st = statLog.stats();
+        const bool reset = st.produced == 0 && st.output == 0 && st.overwritten == 0 && st.dropped == 0 &&
+                           st.truncated == 0 && st.highWater == 1 && statLog.queue().stats().enqueued == 0;
+        std::cout << "overwrite=" << overwrite << " output=" << outputCounted << " dropped=" << dropped
+                  << " truncated=" << truncated << " filtered=" << filtered << " reset=" << reset << std::endl;
+        check("운영 통계", overwrite && outputCounted && dropped && truncated && filtered && reset, allOk);
+    }
+
+    std::cout << "\n=== Test 15: 버퍼 sink 페이지 기록 / flush 조건 ===" << std::endl;
+    {
+        MemoryBlockSink page;
+        page.setFlushLevel(cms::LogLevel::None);
+        page.setFlushInterval(0);
+        page.write(cms::String<32>("0123456789"), cms::LogLevel::Info);    // 11바이트: 버퍼에만
+        const bool buffered = page.blocks.empty() && page.buffered() == 11;
+        page.write(cms::String<32>("abcdefghij"), cms::LogLevel::Error);   // 경계를 넘는 줄: 정확히 한 페이지 기록
+        const bool onePage = page.blocks.size() == 1 && page.blocks[0] == 16 && page.buffered() == 6;
+        for (int i = 0; i < 3; ++i) page.write(cms::String<32>("ABCDEFGHIJKLMNO"), cms::LogLevel::Info);
+        bool pagesOnly = true;
+        for (size_t b : page.blocks) pagesOnly = pagesOnly && b == 16;
+        page.flush();
+        const bool flushed = page.buffered() == 0 && page.blocks.back() == 70 - 16 * (page.blocks.size() - 1) &&
+                             page.written == "0123456789\nabcdefghij\nABCDEFGHIJKLMNO\nABCDEFGHIJKLMNO\nABCDEFGHIJKLMNO\n";
+
+        MemoryBlockSink level;                                              // 기본 flushLevel = Error
+        level.write(cms::String<32>("warn"), cms::LogLevel::Warn);
+        const bool belowLevel = level.blocks.empty();
+        level.write(cms::String<32>("err"), cms::LogLevel::Error);
+        const bool atLevel = level.blocks.size() == 1 && level.blocks[0] == 9;
+
+        MemoryBlockSink timed;
+        timed.setFlushInterval(30);
+        timed.write(cms::String<32>("slow"), cms::LogLevel::Info);
+        timed.tick();
+        const bool notYet = timed.blocks.empty();
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        timed.tick();
+        const bool afterInterval = timed.blocks.size() == 1 && timed.buffered() == 0;
+
+        MemoryBlockSink failing;
+        failing.fail = true;
+        failing.setFlushLevel(cms::LogLevel::None);
+        failing.write(cms::String<32>("0123456789abcdefg"), cms::LogLevel::Info); // 페이지 기록 실패
+        failing.flush();                                                    // 나머지 기록 실패
+        const bool errors = failing.writeErrors() == 2 && failing.buffered() == 0;
+
+        std::cout << "blocks:";
+        for (size_t b : page.blocks) std::cout << " " << b;
+        std::cout << ", writeErrors: " << failing.writeErrors() << std::endl;
+        check("버퍼 sink", buffered && onePage && pagesOnly && flushed && belowLevel && atLevel && notYet &&
+                               afterInterval && errors, allOk);
+    }
+
+    std::cout << "\n=== Test 16: sink 등록 / 레벨 필터 / 색상 제거 ===" << std::endl;
+    {
+        cms::AsyncLogger<128, 8> sinkLog;
+        CaptureSink colored, plain;
+        sinkLog.begin(cms::LogLevel::Debug, true);
+        const bool added = sinkLog.addSink(colored, cms::LogLevel::Debug, true) &&
+                           sinkLog.addSink(plain, cms::LogLevel::Warn) && !sinkLog.addSink(plain);
+        sinkLog.i("[Net] 연결됨");
+        sinkLog.w("[Net] 재시도 FATAL");
+        while (sinkLog.update());
+        const bool filteredByLevel = colored.lines.size() == 2 && plain.lines.size() == 1 && plain.levels[0] == cms::LogLevel::Warn;
+        const bool colorKept = colored.count("\033[") == 2;
+        const bool colorStripped = plain.count("\033") == 0 && plain.count("[Net] 재시도 FATAL") == 1;
+        std::cout << "plain sink: " << plain.lines[0] << std::endl;
+
+        CaptureSink extra[cms::LoggerBase::MAX_SINKS];
+        size_t accepted = 0;
+        for (CaptureSink& x : extra) accepted += sinkLog.addSink(x) ? 1 : 0;
+        const bool limited = accepted == cms::LoggerBase::MAX_SINKS - 2 && sinkLog.sinkCount() == cms::LoggerBase::MAX_SINKS;
+        const bool removed = sinkLog.removeSink(colored) && !sinkLog.removeSink(colored) &&
+                             sinkLog.sinkCount() == cms::LoggerBase::MAX_SINKS - 1;
+        sinkLog.e("after remove");
+        while (sinkLog.update());
+        const bool detached = colored.lines.size() == 2 && plain.lines.size() == 2 && extra[0].lines.size() == 1;
+        check("sink 등록/필터", added && filteredByLevel && colorKept && colorStripped && limited && removed && detached, allOk);
+    }
+
+#ifndef ARDUINO
+    std::cout << "\n=== Test 17: ShardedLogQueue 타임스탬프 병합 ===" << std::endl;
+    {
+        using Sharded = cms::ShardedLogQueue<cms::LogEntry<32>, 4, 2>;
+        cms::LogEntry<32> e;
+
+        // 병합 순서: stamp 오름차순, 같으면 shard 번호가 작은 쪽 먼저
+        Sharded merge;
+        const uint32_t s0[] = {10, 30};
+        const uint32_t s1[] = {20, 30, 40};
+        const char* const t0[] = {"a10", "a30"};
+        const char* const t1[] = {"b20", "b30", "b40"};
+        fillShard(merge, 0, 2, s0, t0, 2);
+        fillShard(merge, 1, 2, s1, t1, 3);
+        std::string order;
+        while (merge.pop(e)) order += std::string(e.text.c_str()) + " ";
+        std::cout << "병합 순서: " << order << std::endl;
+        const bool merged = order == "a10 b20 a30 b30 b40 ";
+
+        // uint32 tick 순환: 0xFFFFFFF0은 0x10보다 이전
+        Sharded wrap;
+        const uint32_t w0[] = {0x10u};
+        const uint32_t w1[] = {0xFFFFFFF0u};
+        const char* const wt0[] = {"after"};
+        const char* const wt1[] = {"before"};
+        fillShard(wrap, 0, 2, w0, wt0, 1);
+        fillShard(wrap, 1, 2, w1, wt1, 1);
+        std::string wrapOrder;
+        while (wrap.pop(e)) wrapOrder += std::string(e.text.c_str()) + " ";
+        std::cout << "순환 구간 순서: " << wrapOrder << std::endl;
+        const bool wrapSafe = wrapOrder == "before after ";
+
+        // 일부만 release하면 남은 조회 항목은 다음 peekBatch에서 순서대로 다시 나옴
+        Sharded partial;
+        fillShard(partial, 0, 2, s0, t0, 2);
+        fillShard(partial, 1, 2, s1, t1, 3);
+        Sharded::Slot slots[4];
+        const size_t first = partial.peekBatch(slots, 3);           // a10 b20 a30
+        partial.releaseBatch(slots, 2);                              // a10 b20만 제거
+        const size_t second = partial.peekBatch(slots, 4);          // a30 b30 b40
+        std::string partialOrder;
+        for (size_t i = 0; i < second; ++i) partialOrder += std::string(slots[i]->text.c_str()) + " ";
+        partial.releaseBatch(slots, second);
+        std::cout << "부분 release 후: " << partialOrder << std::endl;
+        const bool kept = first == 3 && partialOrder == "a30 b30 b40 " && partial.isEmpty();
+
+        check("shard 병합", merged && wrapSafe && kept, allOk);
+    }
+#endif
+
+    std::cout << "\n=== Test 18: CrashLogSink 복구 / 재출력 ===" << std::endl;
+    {
+        // 같은 저장소로 CrashLogSink를 다시 생성하여 재부팅을 흉내 냄
+        static cms::CrashLogStore<64> store;
+        auto newestSlot = [](cms::CrashLogHeader& h) -> cms::CrashLogHeader::State& {
+            return static_cast<int32_t>(h.state[0].seq - h.state[1].seq) > 0 ? h.state[0] : h.state[1];
+        };
+        auto popAll = [](cms::CrashLogSink& sink, std::vector<cms::LogLevel>* levels = nullptr) {
+            std::string all;
+            cms::String<64> line;
+            cms::LogLevel level;
+            while (line.clear(), sink.popRecovered(line, level)) {
+                all += std::string(line.c_str()) + " ";
+                if (levels) levels->push_back(level);
+            }
+            return all;
+        };
+
+        // 복구 순서(오래된 것부터)와 레벨
+        {
+            cms::CrashLogSink before(store);
+            before.clear();
+            before.write(cms::String<32>("alpha"), cms::LogLevel::Info);
+            before.write(cms::String<32>("beta"), cms::LogLevel::Warn);
+            before.write(cms::String<32>("gamma"), cms::LogLevel::Error);
+        }
+        cms::CrashLogSink rebooted(store);
+        std::vector<cms::LogLevel> levels;
+        const bool counted = rebooted.recoveredCount() == 3;
+        const std::string order = popAll(rebooted, &levels);
+        const bool ordered = counted && order == "alpha beta gamma " && levels.size() == 3 &&
+                             levels[0] == cms::LogLevel::Info && levels[1] == cms::LogLevel::Warn &&
+                             levels[2] == cms::LogLevel::Error && rebooted.size() == 0;
+        std::cout << "복구 순서: " << order << std::endl;
+
+        // 범위를 벗어난 레벨 바이트는 Error로 보정
+        rebooted.write(cms::String<32>("odd"), cms::LogLevel::Info);
+        store.data[(newestSlot(store.header).head + 2) % 64] = 200; // 가장 오래된 레코드의 레벨 바이트
+        cms::CrashLogSink clampedSink(store);
+        cms::String<32> clampedLine;
+        cms::LogLevel clampedLevel = cms::LogLevel::Debug;
+        const bool clamped = clampedSink.popRecovered(clampedLine, clampedLevel) && clampedLine == "odd" &&
+                             clampedLevel == cms::LogLevel::Error;
+
+        // 두 seal 사이 리셋: 최신 슬롯이 깨지면 직전 유효 상태를 선택
+        clampedSink.write(cms::String<32>("one"), cms::LogLevel::Info);
+        clampedSink.write(cms::String<32>("two"), cms::LogLevel::Info);
+        newestSlot(store.header).checksum ^= 0x5A5A5A5Au;
+        cms::CrashLogSink torn(store);
+        const std::string tornOrder = popAll(torn);
+        const bool olderChosen = tornOrder == "one ";
+        std::cout << "최신 슬롯 손상 후 복구: " << tornOrder << std::endl;
+
+        // 두 슬롯 모두 체크섬 불일치: 빈 링으로 시작
+        torn.write(cms::String<32>("lost"), cms::LogLevel::Info);
+        store.header.state[0].checksum ^= 1u;
+        store.header.state[1].checksum ^= 1u;
+        cms::CrashLogSink corrupted(store);
+        const bool rejected = corrupted.recoveredCount() == 0 && corrupted.size() == 0 && corrupted.bytesUsed() == 0;
+
+        // 용량/펌웨어 변경: 매직 또는 용량이 다르면 폐기하고 헤더를 다시 초기화
+        corrupted.write(cms::String<32>("stale"), cms::LogLevel::Info);
+        store.header.capacity = 32;
+        cms::CrashLogSink resized(store);
+        const bool resizedCleared = resized.recoveredCount() == 0 && resized.size() == 0 && store.header.capacity == 64;
+        resized.write(cms::String<32>("stale"), cms::LogLevel::Info);
+        store.header.magic ^= 0xFFu;
+        cms::CrashLogSink reflashed(store);
+        const bool magicCleared = reflashed.recoveredCount() == 0 && reflashed.size() == 0;
+
+        // 링 끝을 넘어 감기는 레코드 (13바이트 레코드 × 5: 세 번째부터 64바이트 경계를 넘음)
+        const char* const wrapLines[] = {"AAAAAAAAAA", "BBBBBBBBBB", "CCCCCCCCCC", "DDDDDDDDDD", "EEEEEEEEEE", "FFFFFFFFFF"};
+        for (const char* l : wrapLines) reflashed.write(cms::String<32>(l), cms::LogLevel::Info);
+        const bool dropped = reflashed.size() == 4 && reflashed.bytesUsed() == 52;
+        cms::CrashLogSink wrapped(store);
+        const std::string wrapOrder = popAll(wrapped);
+        const bool wrapIntact = dropped && wrapOrder == "CCCCCCCCCC DDDDDDDDDD EEEEEEEEEE FFFFFFFFFF ";
+        std::cout << "경계 순환 복구: " << wrapOrder << std::endl;
+
+        // 유휴 update마다 3줄씩 "[Prev] "로 재출력 (원본 크래시 sink에는 재기록하지 않음)
+        const char* const prevLines[] = {"p1", "p2", "p3", "p4", "p5", "p6", "p7"};
+        for (const char* l : prevLines) wrapped.write(cms::String<32>(l), cms::LogLevel::Warn);
+        cms::CrashLogSink source(store);
+        cms::AsyncLogger<128, 8> replayLog;
+        CaptureSink replayed;
+        replayLog.begin(cms::LogLevel::Debug, false);
+        replayLog.addSink(replayed);
+        replayLog.addSink(source);
+        replayLog.replayCrashLog(source, 3);
+        const bool noQueued = !replayLog.update();
+        const size_t afterFirst = replayed.lines.size();
+        replayLog.update();
+        const size_t afterSecond = replayed.lines.size();
+        replayLog.update();
+        replayLog.update();
+        const bool paced = noQueued && afterFirst == 3 && afterSecond == 6 && replayed.lines.size() == 7;
+        const bool prefixed = replayed.count("[Prev] ") == 7 && replayed.lines[0] == "[Prev] p1" &&
+                              replayed.lines[6] == "[Prev] p7" && replayed.levels[0] == cms::LogLevel::Warn;
+        const bool skipped = source.size() == 0 && source.recoveredCount() == 0;
+        replayLog.i("live");
+        while (replayLog.update());
+        const bool liveRecorded = source.size() == 1 && replayed.lines.size() == 8;
+        std::cout << "재출력: " << afterFirst << " → " << afterSecond << " → " << replayed.lines.size() - 1 << "줄" << std::endl;
+
+        check("CrashLogSink", ordered && clamped && olderChosen && rejected && resizedCleared && magicCleared &&
+                                  wrapIntact && paced && prefixed && skipped && liveRecorded, allOk);
+    }
+
+    std::cout << "\n=== Test 19: handleLog가 가로챈 로그는 큐 공간을 차지하지 않음 ===" << std::endl;
+    {
+        bool keep = filteredKeepsQueue<cms::ThreadSafeQueue>("ThreadSafeQueue");
+        keep = filteredKeepsQueue<cms::LogRingQueue>("LogRingQueue") && keep;
+#ifndef ARDUINO
+        keep = filteredKeepsQueue<cms::ShardedLogQueue>("ShardedLogQueue") && keep;
+#endif
+        check("필터 로그 슬롯 반환", keep, allOk);
+    }
+
+    return allOk ? 0 : 1;
 }
 
 #endif // CMS_LOGGER_TEST
@@ -0,0 +1,409 @@
+#define CMS_QUEUE_TEST     1
+
+#ifdef CMS_QUEUE_TEST
+
+#include <iostream>
+#include <thread>
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <chrono>
+#include "../src/cmsQueue.h"
+
+/// 값 배열을 공백으로 이어 붙입니다.
+static std::string joinValues(const int* values, size_t n) {
+    std::string text;
+    for (size_t i = 0; i < n; ++i) text += std::to_string(values[i]) + " ";
+    return text;
+}
+
+/// peekContiguous + releaseN 루프로 비우며 구간 크기("3,4")와 값을 기록합니다.
+template <typename Q>
+static std::string drainContiguous(Q& q, std::string& segments) {
+    std::string values;
+    size_t n = 0;
+    while (typename Q::Slot p = q.peekContiguous(n)) {
+        segments += (segments.empty() ? "" : ",") + std::to_string(n);
+        values += joinValues(p, n);
+        q.releaseN(n);
+    }
+    return values;
+}
+
+/// Queue와 ThreadSafeQueue(기본 OverwriteOldest)의 묶음 API가 같은 결과를 내는지 확인합니다. (N = 8)
+template <typename Q>
+static bool checkBulkApi(Q& q, const char* name) {
+    const int seq[20] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20};
+    int out[20] = {};
+
+    // 부분 popN: 5개 중 3개만 요청, 남은 2개 뒤에 6개를 추가해 꼬리가 배열 끝을 넘어감
+    const bool partial = q.enqueueN(seq, 5) == 5 && q.popN(out, 3) == 3 && joinValues(out, 3) == "1 2 3 ";
+    const bool wrapped = q.enqueueN(seq + 5, 6) == 6 && q.size() == 8 && q.popN(out, 20) == 8 &&
+                         joinValues(out, 8) == "4 5 6 7 8 9 10 11 " && q.popN(out, 4) == 0;
+
+    // n > N: 마지막 N개만 남음 / 남은 공간보다 많으면 가장 오래된 것부터 밀려남
+    const bool lastN = q.enqueueN(seq, 20) == 8 && q.popN(out, 20) == 8 && joinValues(out, 8) == "13 14 15 16 17 18 19 20 ";
+    q.enqueueN(seq + 17, 3);  // 18 19 20
+    const bool evicted = q.enqueueN(seq, 7) == 7 && q.size() == 8 && q.popN(out, 20) == 8 &&
+                         joinValues(out, 8) == "20 1 2 3 4 5 6 7 ";
+
+    // peekContiguous + releaseN: 새 큐의 헤드를 배열 끝 가까이(5) 옮긴 뒤 순환 지점에서 두 구간으로 나뉘는지
+    Q fresh;
+    fresh.enqueueN(seq, 6);
+    fresh.popN(out, 5);
+    fresh.enqueueN(seq + 6, 6);  // [5..7] 6 7 8 | [0..3] 9 10 11 12
+    std::string segments;
+    const std::string drained = drainContiguous(fresh, segments);
+    const bool contiguous = segments == "3,4" && drained == "6 7 8 9 10 11 12 " && fresh.isEmpty();
+
+    const bool ok = partial && wrapped && lastN && evicted && contiguous;
+    std::cout << name << " 구간: " << segments << ", 값: " << drained << (ok ? "" : " (FAIL)") << std::endl;
+    return ok;
+}
+
+int main() {
+    std::cout << "=== Test 1: Queue 덮어쓰기 동작 ===" << std::endl;
+    cms::Queue<int, 4> q;
+    for (int i = 0; i < 6; ++i) q.enqueue(i);
+
+    int v;
+    std::cout << "가장 오래된 2개가 밀려나 2~5만 남아야 합니다:";
+    while (q.pop(v)) std::cout << " " << v;
+    std::cout << std::endl;
+
+    std::cout << "\n=== Test 2: SpscQueue 가득 참 처리 ===" << std::endl;
+    cms::SpscQueue<int, 4> spsc;
+    int accepted = 0;
+    for (int i = 0; i < 6; ++i) {
+        if (spsc.enqueue(i)) accepted++;
+    }
+    std::cout << "용량(4)만큼만 수락되고 나머지는 버려져야 합니다: " << accepted << "개 수락" << std::endl;
+    std::cout << "남은 데이터:";
+    while (spsc.pop(v)) std::cout << " " << v;
+    std::cout << std::endl;
+
+    std::cout << "\n=== Test 3: SpscQueue 생산자/소비자 스레드 ===" << std::endl;
+    cms::SpscQueue<int, 16> shared;
+    const int total = 100000;
+
+    std::thread producer([&shared]() {
+        for (int i = 0; i < total; ++i) {
+            while (!shared.enqueue(i)) std::this_thread::yield(); // 가득 차면 소비자를 기다림
+        }
+    });
+
+    // 제3의 태스크(통계/isEmpty 호출자)가 보는 size()도 항상 0 ~ N이어야 함
+    std::atomic<bool> draining{true};
+    std::atomic<size_t> maxObserved{0};
+    std::thread observer([&]() {
+        while (draining.load()) {
+            const size_t n = shared.size();
+            if (n > maxObserved.load()) maxObserved.store(n);
+        }
+    });
+
+    int expected = 0;
+    bool ordered = true;
+    while (expected < total) {
+        if (shared.pop(v)) {
+            if (v != expected) ordered = false;
+            expected++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    draining.store(false);
+    observer.join();
+    ordered = ordered && maxObserved.load() <= 16;
+
+    std::cout << total << "개 수신, 관찰된 최대 size(): " << maxObserved.load() << ", 순서 보장: " << (ordered ? "OK" : "FAIL") << std::endl;
+
+    std::cout << "\n=== Test 4: MpmcQueue 가득 참 정책 ===" << std::endl;
+    cms::MpmcQueue<int, 4> dropNew;
+    cms::MpmcQueue<int, 4, cms::QueueFullPolicy::OverwriteOldest> dropOld;
+    for (int i = 0; i < 6; ++i) {
+        dropNew.tryEnqueue(i);
+        dropOld.tryEnqueue(i);
+    }
+    std::cout << "DropNewest (0~3):";
+    while (dropNew.tryPop(v)) std::cout << " " << v;
+    std::cout << "\nOverwriteOldest (2~5):";
+    while (dropOld.tryPop(v)) std::cout << " " << v;
+    std::cout << std::endl;
+
+    std::cout << "\n=== Test 5: MpmcQueue 다중 생산자/다중 소비자 ===" << std::endl;
+    cms::MpmcQueue<int, 64> mpmc;
+    const int producers = 4;
+    const int perProducer = 50000;
+    std::atomic<long long> sum(0);
+    std::atomic<int> received(0);
+
+    std::thread workers[producers * 2];
+    for (int p = 0; p < producers; ++p) {
+        workers[p] = std::thread([&mpmc, p]() {
+            for (int i = 0; i < perProducer; ++i) {
+                while (!mpmc.tryEnqueue(p * perProducer + i)) std::this_thread::yield();
+            }
+        });
+        workers[producers + p] = std::thread([&mpmc, &sum, &received]() {
+            int item;
+            while (received.load() < producers * perProducer) {
+                if (mpmc.tryPop(item)) {
+                    sum += item;
+                    received++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& t : workers) t.join();
+
+    const long long n = static_cast<long long>(producers) * perProducer;
+    const bool complete = (sum.load() == n * (n - 1) / 2);
+    std::cout << received.load() << "개 수신, 합계 검증: " << (complete ? "OK" : "FAIL") << std::endl;
+
+    std::cout << "\n=== Test 6: reserve/commit, peek/release 슬롯 API ===" << std::endl;
+    cms::ThreadSafeQueue<int, 4> slotQueue;
+    cms::ThreadSafeQueue<int, 4>::Slot pending = slotQueue.reserve();
+    *pending = 7;
+    std::cout << "commit 전에는 조회되지 않아야 합니다: " << (slotQueue.peek() ? "FAIL" : "OK") << std::endl;
+    slotQueue.commit(pending);
+
+    cms::SpscQueue<int, 4> nested;
+    cms::SpscQueue<int, 4>::Slot outer = nested.reserve();
+    *outer = 1;
+    nested.enqueue(2); // 예약이 열린 동안의 중첩 추가는 바깥 commit 시점에 함께 공개
+    std::cout << "중첩 예약 중 공개된 개수 (0): " << nested.size() << std::endl;
+    nested.commit(outer);
+
+    bool slotsOk = true;
+    if (cms::ThreadSafeQueue<int, 4>::Slot slot = slotQueue.peek()) {
+        slotsOk = slotsOk && (*slot == 7);
+        slotQueue.release(slot);
+    }
+    std::cout << "중첩 예약 commit 후:";
+    while (cms::SpscQueue<int, 4>::Slot slot = nested.peek()) {
+        std::cout << " " << *slot;
+        nested.release(slot);
+    }
+    std::cout << std::endl;
+    slotsOk = slotsOk && slotQueue.isEmpty() && nested.isEmpty();
+    std::cout << "슬롯 API 검증: " << (slotsOk ? "OK" : "FAIL") << std::endl;
+
+    std::cout << "\n=== Test 7: ByteRing 가변 길이 레코드와 래핑 ===" << std::endl;
+    cms::ByteRing<64> ring;
+    const char* words[] = { "alpha", "bravo-charlie", "delta", "echo-foxtrot-golf", "hotel" };
+    char buf[32];
+    size_t len;
+    bool ringOk = true;
+    // 여러 바퀴를 돌며 버퍼 끝에서 래핑 마커가 생성되도록 반복 추가/제거
+    for (int round = 0; round < 20; ++round) {
+        const char* w = words[round % 5];
+        ringOk = ringOk && ring.enqueue(w, strlen(w));
+        if (round % 2 == 1) {
+            while (ring.pop(buf, sizeof(buf), len)) {}
+        }
+    }
+    ring.enqueue("last", 4);
+    while (ring.pop(buf, sizeof(buf), len)) {
+        std::cout << "레코드: " << std::string(buf, len) << std::endl;
+    }
+    ringOk = ringOk && ring.isEmpty() && ring.bytesUsed() == 0;
+
+    cms::ByteRing<32, cms::QueueFullPolicy::OverwriteOldest> small;
+    for (int i = 0; i < 10; ++i) small.enqueue(&i, sizeof(i));
+    int last = -1;
+    while (small.pop(&last, sizeof(last), len)) {}
+    ringOk = ringOk && (last == 9);
+    std::cout << "ByteRing 검증: " << (ringOk ? "OK" : "FAIL") << std::endl;
+
+    using Clock = std::chrono::steady_clock;
+    auto elapsedMs = [](Clock::time_point since) {
+        return (long)std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - since).count();
+    };
+
+    std::cout << "\n=== Test 8: popWait/peekWait 대기와 깨움 ===" << std::endl;
+    cms::ThreadSafeQueue<int, 4> waitQueue;
+    Clock::time_point t0 = Clock::now();
+    const bool timedOut = !waitQueue.popWait(v, 50);
+    const long waitedMs = elapsedMs(t0);
+    t0 = Clock::now();
+    const bool peekTimedOut = (waitQueue.peekWait(30) == nullptr);
+    const long peekWaitedMs = elapsedMs(t0);
+    std::cout << "빈 큐 popWait(50): " << waitedMs << "ms, peekWait(30): " << peekWaitedMs << "ms" << std::endl;
+
+    // 잠든 소비자를 생산자의 enqueue가 깨움 (제한 시간 2초보다 훨씬 빨리 반환)
+    std::thread waker([&waitQueue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        waitQueue.enqueue(42);
+    });
+    t0 = Clock::now();
+    int woken = 0;
+    const bool gotWoken = waitQueue.popWait(woken, 2000);
+    const long wokeMs = elapsedMs(t0);
+    waker.join();
+    std::cout << "생산자가 깨운 소비자: " << woken << " (" << wokeMs << "ms)" << std::endl;
+    const bool waitOk = timedOut && waitedMs >= 45 && waitedMs < 1000 && peekTimedOut && peekWaitedMs >= 25 &&
+                        gotWoken && woken == 42 && wokeMs >= 20 && wokeMs < 1500;
+    std::cout << "대기/깨움 검증: " << (waitOk ? "OK" : "FAIL") << std::endl;
+
+    std::cout << "\n=== Test 9: QueueFullPolicy (Block / DropNewest / OverwriteOldest) ===" << std::endl;
+    // Block: 가득 찬 큐의 생산자는 제한 시간만큼 기다린 뒤 새 데이터를 버림
+    cms::ThreadSafeQueue<int, 2, cms::QueueFullPolicy::Block> blockQueue;
+    blockQueue.setBlockTimeout(40);
+    blockQueue.enqueue(0);
+    blockQueue.enqueue(1);
+    t0 = Clock::now();
+    blockQueue.enqueue(2);
+    const long blockedMs = elapsedMs(t0);
+    const bool blockTimedOut = blockedMs >= 35 && blockQueue.stats().dropped == 1 && blockQueue.size() == 2;
+
+    // Block: 소비자가 자리를 비우면 대기 중인 생산자가 깨어나 저장
+    blockQueue.setBlockTimeout(2000);
+    std::thread drainer([&blockQueue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(30));
+        int x;
+        blockQueue.pop(x);
+    });
+    t0 = Clock::now();
+    blockQueue.enqueue(3);
+    const long unblockedMs = elapsedMs(t0);
+    drainer.join();
+    std::cout << "Block 시간 초과: " << blockedMs << "ms, 소비로 깨어남: " << unblockedMs << "ms, 남은 데이터:";
+    std::string blockOrder;
+    while (blockQueue.pop(v)) { std::cout << " " << v; blockOrder += std::to_string(v); }
+    std::cout << std::endl;
+    const bool blockWoken = unblockedMs < 1500 && blockOrder == "13" && blockQueue.stats().dropped == 1;
+
+    // DropNewest는 새 데이터, OverwriteOldest는 가장 오래된 데이터를 버림
+    cms::ThreadSafeQueue<int, 4, cms::QueueFullPolicy::DropNewest> keepOld;
+    cms::ThreadSafeQueue<int, 4> keepNew;
+    for (int i = 0; i < 6; ++i) {
+        keepOld.enqueue(i);
+        keepNew.enqueue(i);
+    }
+    std::string oldOrder, newOrder;
+    while (keepOld.pop(v)) oldOrder += std::to_string(v);
+    while (keepNew.pop(v)) newOrder += std::to_string(v);
+    std::cout << "DropNewest: " << oldOrder << ", OverwriteOldest: " << newOrder << std::endl;
+    const bool dropPolicies = oldOrder == "0123" && keepOld.stats().dropped == 2 && keepOld.stats().overwritten == 0 &&
+                              newOrder == "2345" && keepNew.stats().overwritten == 2 && keepNew.stats().dropped == 0;
+
+    // OverwriteOldest는 가장 오래된 슬롯이 완성(Ready)일 때만 밀어냄: 기록 중/조회 중이면 새 데이터를 버림
+    cms::ThreadSafeQueue<int, 2> guarded;
+    cms::ThreadSafeQueue<int, 2>::Slot writing = guarded.reserve();
+    *writing = 10;
+    guarded.enqueue(11);
+    guarded.enqueue(12);                                   // 머리가 Writing → 버림
+    const bool keptWriting = guarded.stats().dropped == 1 && guarded.stats().overwritten == 0;
+    guarded.commit(writing);
+    cms::ThreadSafeQueue<int, 2>::Slot reading = guarded.peek();
+    guarded.enqueue(13);                                   // 머리가 Reading → 버림
+    const bool keptReading = reading && *reading == 10 && guarded.stats().dropped == 2;
+    guarded.release(reading);
+    guarded.enqueue(14);                                   // 공간 있음
+    guarded.enqueue(15);                                   // 머리(11)가 Ready → 밀어냄
+    std::string guardedOrder;
+    while (guarded.pop(v)) guardedOrder += std::to_string(v);
+    std::cout << "사용 중 슬롯 보호 후 남은 데이터: " << guardedOrder << std::endl;
+    const bool evictReadyOnly = keptWriting && keptReading && guardedOrder == "1415" && guarded.stats().overwritten == 1;
+
+    const bool policyOk = blockTimedOut && blockWoken && dropPolicies && evictReadyOnly;
+    std::cout << "가득 참 정책 검증: " << (policyOk ? "OK" : "FAIL") << std::endl;
+
+    std::cout << "\n=== Test 10: tryReserve / cancel (예약 반환) ===" << std::endl;
+    // 가장 최근 예약은 자리를 되돌리고, 뒤에 다른 예약이 있으면 false (호출자가 commit)
+    cms::ThreadSafeQueue<int, 3> undo;
+    for (int i = 1; i <= 3; ++i) undo.enqueue(i);
+    const bool fullRefused = undo.tryReserve() == nullptr && undo.stats().dropped == 0 && undo.stats().overwritten == 0;
+    undo.pop(v);                                             // 1
+    cms::ThreadSafeQueue<int, 3>::Slot kept = undo.reserve();
+    const bool tsqUndo = undo.cancel(kept) && undo.size() == 2 && undo.stats().enqueued == 3;
+    cms::ThreadSafeQueue<int, 3>::Slot first = undo.reserve();
+    undo.pop(v);                                             // 2
+    cms::ThreadSafeQueue<int, 3>::Slot second = undo.tryReserve();
+    const bool tsqNested = second && !undo.cancel(first) && undo.cancel(second) && undo.cancel(first);
+    std::string undoOrder;
+    while (undo.pop(v)) undoOrder += std::to_string(v);
+    const bool tsqOk = fullRefused && tsqUndo && tsqNested && undoOrder == "3" && undo.isEmpty();
+
+    cms::Queue<int, 3> plain;
+    plain.enqueue(1);
+    cms::Queue<int, 3>::Slot plainSlot = plain.reserve();
+    const bool plainOk = plain.cancel(plainSlot) && plain.size() == 1 && !plain.cancel(plainSlot);
+
+    cms::SpscQueue<int, 4> spscUndo;
+    cms::SpscQueue<int, 4>::Slot outerUndo = spscUndo.reserve();
+    *outerUndo = 0;
+    spscUndo.enqueue(5);                                     // 중첩 예약 (바깥 commit 시점에 공개)
+    const bool spscNested = !spscUndo.cancel(outerUndo);     // 뒤에 예약이 있어 반환 불가 → commit
+    spscUndo.commit(outerUndo);
+    cms::SpscQueue<int, 4>::Slot lastUndo = spscUndo.reserve();
+    const bool spscUndoOk = spscNested && spscUndo.cancel(lastUndo) && spscUndo.size() == 2;
+
+    cms::MpmcQueue<int, 4> mpmcUndo;
+    cms::MpmcQueue<int, 4>::Slot m1 = mpmcUndo.reserve();
+    cms::MpmcQueue<int, 4>::Slot m2 = mpmcUndo.reserve();
+    const bool mpmcNested = !mpmcUndo.cancel(m1) && mpmcUndo.cancel(m2);
+    *m1 = 9;
+    mpmcUndo.commit(m1);
+    mpmcUndo.enqueue(10);                                    // 반환된 자리를 다시 사용
+    std::string mpmcUndoText;
+    while (mpmcUndo.pop(v)) mpmcUndoText += std::to_string(v) + " ";
+    const bool mpmcUndoOk = mpmcNested && mpmcUndoText == "9 10 ";
+
+    cms::ByteRing<64, cms::QueueFullPolicy::OverwriteOldest> undoRing;
+    undoRing.enqueue("old", 3);
+    uint8_t* r1 = undoRing.reserve(8);
+    uint8_t* r2 = undoRing.reserve(8);
+    const bool ringNested = !undoRing.cancel(r1) && undoRing.cancel(r2);
+    memcpy(r1, "mid", 3);
+    undoRing.commit(r1, 3);
+    const size_t usedBefore = undoRing.bytesUsed();
+    uint8_t* r3 = undoRing.reserve(8);
+    const bool ringUndo = undoRing.cancel(r3) && undoRing.bytesUsed() == usedBefore && undoRing.size() == 2;
+    while (uint8_t* fill = undoRing.tryReserve(8)) undoRing.commit(fill, 0); // 빈 공간만 채움 (오래된 레코드 유지)
+    char out[8];
+    size_t outLen = 0;
+    const bool ringKept = undoRing.pop(out, sizeof(out), outLen) && outLen == 3 && memcmp(out, "old", 3) == 0;
+    const bool ringUndoOk = ringNested && ringUndo && ringKept;
+
+    std::cout << "ThreadSafeQueue 남은 데이터: " << undoOrder << ", MpmcQueue: " << mpmcUndoText << std::endl;
+    const bool cancelOk = tsqOk && plainOk && spscUndoOk && mpmcUndoOk && ringUndoOk;
+    std::cout << "예약 반환 검증: " << (cancelOk ? "OK" : "FAIL") << std::endl;
+
+    std::cout << "\n=== Test 11: enqueueN / popN / peekContiguous / releaseN ===" << std::endl;
+    cms::Queue<int, 8> bulkPlain;
+    cms::ThreadSafeQueue<int, 8> bulkSafe;
+    const bool plainBulkOk = checkBulkApi(bulkPlain, "Queue");
+    const bool safeBulkOk = checkBulkApi(bulkSafe, "ThreadSafeQueue");
+    const cms::QueueStats bulkStats = bulkSafe.stats();  // 20개 중 앞 12개 건너뜀 + 7개 추가 시 2개 밀려남
+    std::cout << "ThreadSafeQueue 덮어쓰기: " << bulkStats.overwritten << "개" << std::endl;
+
+    // DropNewest: 들어가는 만큼만 저장하고 items의 뒤쪽을 버림
+    cms::ThreadSafeQueue<int, 4, cms::QueueFullPolicy::DropNewest> bulkDrop;
+    const int dropSeq[6] = {1, 2, 3, 4, 5, 6};
+    int dropOut[6] = {};
+    bulkDrop.enqueue(0);
+    const bool dropOk = bulkDrop.enqueueN(dropSeq, 6) == 3 && bulkDrop.stats().dropped == 3 &&
+                        bulkDrop.popN(dropOut, 6) == 4 && joinValues(dropOut, 4) == "0 1 2 3 ";
+
+    // 조회 중(Reading)인 구간은 덮어쓰지 않고 새 데이터를 버림
+    cms::ThreadSafeQueue<int, 4> bulkHeld;
+    bulkHeld.enqueueN(dropSeq, 4);
+    size_t held = 0;
+    cms::ThreadSafeQueue<int, 4>::Slot heldSlot = bulkHeld.peekContiguous(held);
+    int scratch[4] = {};
+    const bool heldOk = heldSlot && held == 4 && bulkHeld.enqueueN(dropSeq + 4, 2) == 0 && bulkHeld.popN(scratch, 4) == 0 &&
+                        heldSlot[0] == 1 && heldSlot[3] == 4;
+    bulkHeld.releaseN(held);
+
+    const bool bulkOk = plainBulkOk && safeBulkOk && bulkStats.overwritten == 14 && dropOk && heldOk && bulkHeld.isEmpty();
+    std::cout << "묶음 API 검증: " << (bulkOk ? "OK" : "FAIL") << std::endl;
+
+    return (ordered && complete && slotsOk && ringOk && waitOk && policyOk && cancelOk && bulkOk) ? 0 : 1;
+}
+
+#endif // CMS_QUEUE_TEST
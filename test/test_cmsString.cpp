@@ -0,0 +1,706 @@
+#define CMS_STRING_TEST     1
+
+#ifdef CMS_STRING_TEST
+
+#include <iostream>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#ifndef ARDUINO
+#include <regex.h>  // POSIX regexec (기준 구현 비교용)
+#endif
+#include "../src/cmsString.h"
+#include "../src/cmsStringBuilder.h"
+
+/// 비트 단위로 같은 값인지 비교합니다. (NaN/부호 있는 0까지 구분)
+template <typename T, typename Bits>
+static bool sameBits(T a, T b) {
+    Bits x, y;
+    memcpy(&x, &a, sizeof(x));
+    memcpy(&y, &b, sizeof(y));
+    return x == y;
+}
+
+/// 한 타입에 대해 parse 결과를 기준값과 비교합니다. (범위 초과는 기준값이 0 또는 무한대일 때만 허용)
+template <typename T, typename Bits>
+static bool matchesReference(const cms::string::Token& token, T reference) {
+    T value = 0;
+    const cms::string::ParseResult r = cms::string::parse(token, value);
+    if (r) return sameBits<T, Bits>(value, reference);
+    return r.ec == cms::string::ParseErrc::OutOfRange && (reference == 0 || std::isinf(reference));
+}
+
+/// parse<double>/parse<float> 결과가 strtod/strtof와 비트 단위로 같은지 확인합니다.
+static void checkReal(const char* text, int& failures) {
+    const cms::string::Token token{text, strlen(text)};
+    const bool ok = matchesReference<double, uint64_t>(token, strtod(text, nullptr)) &&
+                    matchesReference<float, uint32_t>(token, strtof(text, nullptr));
+    if (!ok) {
+        if (failures < 10) std::cout << "  불일치: " << text << std::endl;
+        failures++;
+    }
+}
+
+/// 정규표현식 검사 항목 (expected: 기대 결과, posix: POSIX ERE로도 같은 뜻인지)
+struct RegexCase {
+    const char* pattern;
+    const char* text;
+    bool ignoreCase;
+    bool expected;
+    bool posix;
+};
+
+/// cms::Regex 결과를 기대값과 비교하고, native에서는 POSIX regexec와도 비교합니다.
+static bool checkRegex(const RegexCase& c) {
+    const cms::Regex<> re(c.pattern, c.ignoreCase);
+    bool ok = re.isValid() && re.matches(c.text) == c.expected;
+#ifndef ARDUINO
+    if (c.posix) {
+        regex_t ref;
+        if (regcomp(&ref, c.pattern, REG_EXTENDED | REG_NOSUB | (c.ignoreCase ? REG_ICASE : 0)) != 0) {
+            ok = false;
+        } else {
+            ok = ok && (regexec(&ref, c.text, 0, nullptr, 0) == 0) == c.expected;
+            regfree(&ref);
+        }
+    }
+#endif
+    if (!ok) std::cout << "  불일치: /" << c.pattern << "/ \"" << c.text << "\"" << std::endl;
+    return ok;
+}
+
+/// 빌더의 조각을 순서대로 이어 붙인 결과를 반환합니다.
+static std::string joinSegments(const cms::StringBuilder& sb) {
+    std::string joined;
+    sb.forEachSegment([&](const char* p, size_t len) { joined.append(p, len); });
+    return joined;
+}
+
+/// 토큰을 '|'로 이어 붙여 순서와 빈 토큰까지 한 번에 비교할 수 있게 합니다.
+static std::string joinTokens(cms::string::Tokenizer tokens) {
+    std::string joined;
+    size_t count = 0;
+    for (const cms::string::Token& t : tokens) {
+        if (count++) joined += '|';
+        joined.append(t.ptr, t.len);
+    }
+    return joined;
+}
+
+/// ASCII 대소문자만 접은 사본을 반환합니다. (Needle의 ignoreCase 폴딩과 같은 규칙)
+static std::string foldAscii(std::string s) {
+    for (char& c : s) {
+        if (c >= 'A' && c <= 'Z') c = static_cast<char>(c - 'A' + 'a');
+    }
+    return s;
+}
+
+/// std::string 검색 결과를 라이브러리의 int 오프셋 규칙(-1: 없음)으로 바꿉니다.
+static int toOffset(size_t pos) { return (pos == std::string::npos) ? -1 : static_cast<int>(pos); }
+
+/// 왼쪽부터 겹치지 않는 일치를 최대 limit개 치환한 기준 결과를 만듭니다.
+static std::string replaceReference(const std::string& src, const std::string& from, const std::string& to,
+                                    bool ignoreCase, size_t limit, size_t* replaced = nullptr) {
+    const std::string hay = ignoreCase ? foldAscii(src) : src;
+    const std::string pat = ignoreCase ? foldAscii(from) : from;
+    std::string out;
+    size_t pos = 0;
+    size_t done = 0;
+    for (; done < limit; ++done) {
+        const size_t hit = hay.find(pat, pos);
+        if (hit == std::string::npos) break;
+        out.append(src, pos, hit - pos);
+        out += to;
+        pos = hit + from.size();
+    }
+    out.append(src, pos, std::string::npos);
+    if (replaced) *replaced = done;
+    return out;
+}
+
+// format<> 비교용 포맷 (템플릿 인자로 쓰려면 정적 저장 기간이 필요)
+static constexpr char kFmtInt[] = "%d|%5d|%05d|%ld|%2d";
+static constexpr char kFmtUnsigned[] = "%u|%lu|%08u|%3u";
+static constexpr char kFmtHex[] = "%x|%X|%08X|%4x|%lx|%02X";
+static constexpr char kFmtFloat[] = "%.6f|%.0f|%.3f|%08.3f|%8.2f|%.9f|%3.1f|%07.2f";
+static constexpr char kFmtSpecial[] = "%8.2f|%f|%06.1f";
+static constexpr char kFmtText[] = "%s=%s %c%c 100%%";
+static constexpr char kFmtJson[] = "{\"id\":%d,\"t\":%.1f,\"raw\":\"0x%04X\"}";
+
+// 컴파일 오류 확인: 아래 포맷은 format<>에 넘기면 static_assert("unsupported or malformed format specifier")로
+// 빌드가 실패합니다. 테스트 빌드를 깨지 않도록 같은 판정(CompiledFormat::VALID)만 정적으로 검사합니다.
+//   s.format<kRejectedMinus>(1);   // error: cms::string::format: unsupported or malformed format specifier.
+static constexpr char kRejectedMinus[] = "%-5d";      // 왼쪽 정렬 플래그 미지원
+static constexpr char kRejectedStrWidth[] = "%8s";    // 문자열 너비는 출력에 반영되지 않음
+static constexpr char kRejectedIntPrec[] = "%.3d";    // 정수 정밀도 미지원
+static constexpr char kRejectedFloatPrec[] = "%.12f"; // appendFloat 상한(9자리) 초과
+static constexpr char kRejectedLong[] = "%lf";        // 'l'은 정수 지정자에만
+static constexpr char kRejectedType[] = "%e";         // 지원하지 않는 변환 문자
+static_assert(!cms::string::detail::CompiledFormat<kRejectedMinus>::VALID &&
+              !cms::string::detail::CompiledFormat<kRejectedStrWidth>::VALID &&
+              !cms::string::detail::CompiledFormat<kRejectedIntPrec>::VALID &&
+              !cms::string::detail::CompiledFormat<kRejectedFloatPrec>::VALID &&
+              !cms::string::detail::CompiledFormat<kRejectedLong>::VALID &&
+              !cms::string::detail::CompiledFormat<kRejectedType>::VALID,
+              "format<> must reject specifiers whose output would differ from printf.");
+static_assert(cms::string::detail::CompiledFormat<kFmtFloat>::VALID && cms::string::detail::CompiledFormat<kFmtJson>::ARGS == 3,
+              "format<> must accept the supported specifiers.");
+
+/// format<>와 appendPrintf의 결과가 snprintf와 같은지 확인합니다.
+template <const char* FMT, typename... Args>
+static bool sameAsPrintf(Args... args) {
+    cms::String<160> compiled;
+    compiled.format<FMT>(args...);
+    cms::String<160> runtime;
+    runtime.appendPrintf(FMT, args...);
+    char reference[160];
+    snprintf(reference, sizeof(reference), FMT, args...);
+    const bool ok = compiled == reference && runtime == reference;
+    if (!ok) {
+        std::cout << "  불일치: \"" << FMT << "\" printf=\"" << reference << "\" format=\"" << compiled.c_str()
+                  << "\" appendPrintf=\"" << runtime.c_str() << "\"" << std::endl;
+    }
+    return ok;
+}
+
+/// operator<<(double) 결과가 기대 문자열이고, 다시 읽으면 같은 비트인지 확인합니다.
+static bool shortestRoundTrip(double value, const char* expected) {
+    cms::String<40> s;
+    s << value;
+    const bool ok = s == expected && sameBits<double, uint64_t>(strtod(s.c_str(), nullptr), value);
+    if (!ok) std::cout << "  최단 표기 불일치: " << s.c_str() << " (기대 " << expected << ")" << std::endl;
+    return ok;
+}
+
+int main() {
+    std::cout << "=== Test 1: parse<double> 극단 지수 (strtod 비트 비교) ===" << std::endl;
+    int failures = 0;
+    int checked = 0;
+    const char* fixed[] = {
+        "0.000000000000000000001234", "1e-30", "1e30", "1.7976931348623157e308", "2.2250738585072011e-308",
+        "2.2250738585072014e-308", "4.9406564584124654e-324", "5e-324", "2.4703282292062328e-324",
+        "123456789012345678901234567890e-50", "0.1", "9007199254740993", "1.00000000000000011102230246251565404236316680908203125",
+        "7.038531e-26", "1e-45", "3.4028235e38", "1.17549435e-38", "+12.5e-3",
+    };
+    for (const char* t : fixed) {
+        checkReal(t, failures);
+        checked++;
+    }
+
+    // 작은/큰 지수 전 구간에 걸친 임의 가수 (짧은 표기와 19자리 초과 긴 표기 모두)
+    uint64_t seed = 0x9E3779B97F4A7C15ull;
+    char buf[64];
+    for (int exp10 = -340; exp10 <= 320; ++exp10) {
+        for (int k = 0; k < 6; ++k) {
+            seed ^= seed << 13;
+            seed ^= seed >> 7;
+            seed ^= seed << 17;
+            if (k < 3) snprintf(buf, sizeof(buf), "%llue%d", (unsigned long long)(seed % 100000u), exp10);
+            else snprintf(buf, sizeof(buf), "%llu%llue%d", (unsigned long long)seed, (unsigned long long)(seed >> 3), exp10);
+            checkReal(buf, failures);
+            checked++;
+        }
+    }
+    std::cout << checked << "개 비교, 불일치 " << failures << "개" << std::endl;
+    const bool realOk = (failures == 0);
+    std::cout << "strtod 비트 비교 검증: " << (realOk ? "OK" : "FAIL") << std::endl;
+
+    std::cout << "\n=== Test 2: 복사 생성자는 자신의 버퍼를 사용 ===" << std::endl;
+    // 이전의 암시적 복사 생성자는 _buf 포인터까지 복사하여 사본이 원본의 버퍼를 가리켰음
+    cms::String<32> original("hello");
+    cms::String<32> copy(original);
+    copy << " world";
+    copy[0] = 'J';
+    cms::String<8> narrow(original);     // 다른 크기: 용량만큼 잘림
+    narrow << "-xyz";
+    cms::String<64> wide = original;     // 다른 크기: 전체 복사
+    wide.toUpperCase();
+
+    struct Holder { cms::String<16> name; };
+    Holder a{cms::String<16>("alpha")};
+    Holder b = a;                         // 멤버 사본도 독립
+    b.name = "beta";
+
+    std::cout << "원본: " << original.c_str() << ", 사본: " << copy.c_str()
+              << ", 좁은 사본: " << narrow.c_str() << ", 넓은 사본: " << wide.c_str() << std::endl;
+    const bool copyOk = original == "hello" && original.length() == 5 && copy == "Jello world" &&
+                        copy.c_str() != original.c_str() && narrow == "hello-x" && wide == "HELLO" &&
+                        a.name == "alpha" && b.name == "beta";
+    std::cout << "복사 독립성 검증: " << (copyOk ? "OK" : "FAIL") << std::endl;
+
+    std::cout << "\n=== Test 3: Regex 문법 (POSIX regexec 비교) ===" << std::endl;
+    const RegexCase regexCases[] = {
+        // 문자 클래스
+        {"^[abc]+$", "abcab", false, true, true},
+        {"^[abc]+$", "abcd", false, false, true},
+        {"^[^a-z]+$", "ABC123", false, true, true},
+        {"^[^a-z]+$", "ABc", false, false, true},
+        {"[[:digit:]][[:alpha:]]", "__7x__", false, true, true},
+        {"^[[:space:]]*$", " \t ", false, true, true},
+        {"^[a-f0-9-]+$", "de-ad", false, true, true},
+        {"^\\d+\\.\\d+$", "3.14", false, true, false},
+        {"^\\w+\\s\\S$", "key_1 x", false, true, false},
+        {"^\\D\\W$", "a-", false, true, false},
+        // 반복 횟수 {m,n}
+        {"^a{3}$", "aaa", false, true, true},
+        {"^a{3}$", "aaaa", false, false, true},
+        {"^a{2,}$", "aaaaa", false, true, true},
+        {"^a{2,}$", "a", false, false, true},
+        {"^(ab){1,2}c$", "ababc", false, true, true},
+        {"^(ab){1,2}c$", "abababc", false, false, true},
+        {"^[0-9]{1,3}(\\.[0-9]{1,3}){3}$", "192.168.0.1", false, true, true},
+        {"^[0-9]{1,3}(\\.[0-9]{1,3}){3}$", "192.168.0", false, false, true},
+        {"^x?y*z+$", "zzz", false, true, true},
+        // 선택 |
+        {"^(get|set|reset)$", "reset", false, true, true},
+        {"^(get|set|reset)$", "gets", false, false, true},
+        {"cat|dog", "hotdog", false, true, true},
+        {"^(?:on|off)$", "off", false, true, false},
+        // 앵커와 검색 의미
+        {"b", "abc", false, true, true},
+        {"^b", "abc", false, false, true},
+        {"c$", "abc", false, true, true},
+        {"b$", "abc", false, false, true},
+        {"^$", "", false, true, true},
+        {"a.c", "xxabcxx", false, true, true},
+        {"a.c", "ac", false, false, true},
+        // 대소문자 무시
+        {"^hello [a-z]+$", "HeLLo World", true, true, true},
+        {"^hello [a-z]+$", "HeLLo World", false, false, true},
+    };
+    int regexFailures = 0;
+    for (const RegexCase& c : regexCases) {
+        if (!checkRegex(c)) regexFailures++;
+    }
+
+    // 문법 오류/용량 초과는 isValid()가 false이고 어떤 입력과도 일치하지 않음
+    const char* invalidPatterns[] = {"(ab", "ab)", "[abc", "a{3,2}", "*a", "(?=a)", "(a)\\1", "a{255}"};
+    int invalidFailures = 0;
+    for (const char* pattern : invalidPatterns) {
+        const cms::Regex<> re(pattern);
+        if (re.isValid() || re.matches("ab")) {
+            std::cout << "  잘못된 패턴이 허용됨: /" << pattern << "/" << std::endl;
+            invalidFailures++;
+        }
+    }
+    const cms::Regex<4> tooLong("abcdefgh");
+    if (tooLong.isValid()) invalidFailures++;
+
+    // StringBase / Token 오버로드
+    static const cms::Regex<> topic("^sensor/[^/]+/temp$");
+    cms::String<32> path("sensor/kitchen/temp");
+    const cms::string::Token inside{"xx sensor/a/temp", 16};
+    const cms::string::Token prefix{"sensor/a/temp", 8};  // "sensor/a" 까지만
+    const bool overloadOk = path.matches(topic) && !cms::String<32>("sensor/a/b/temp").matches(topic) &&
+                            !inside.matches(topic) && cms::string::Token{inside.ptr + 3, 13}.matches(topic) &&
+                            !prefix.matches(topic);
+
+    std::cout << (sizeof(regexCases) / sizeof(regexCases[0])) << "개 비교, 불일치 " << regexFailures
+              << "개, 잘못된 패턴 허용 " << invalidFailures << "개" << std::endl;
+    const bool regexOk = regexFailures == 0 && invalidFailures == 0 && overloadOk;
+    std::cout << "Regex 검증: " << (regexOk ? "OK" : "FAIL") << std::endl;
+
+    std::cout << "\n=== Test 4: StringBuilder 조각 경계와 풀 반환 ===" << std::endl;
+    static cms::ChunkPool<16, 4> pool;  // 조각당 15바이트
+    bool builderOk = true;
+    {
+        cms::StringBuilder sb(pool);
+        std::string expected = "0123456789abcdefghijklmnopqrstuvwxyzABCD";  // 40바이트: 15 + 15 + 10
+        builderOk = builderOk && sb.append(expected.c_str()) && sb.segmentCount() == 3 && pool.available() == 1 &&
+                    sb.length() == expected.size() && joinSegments(sb) == expected;
+
+        // 1) 꼬리 조각의 남은 공간(5바이트)에 들어가면 옮겨 담고 예비 조각은 반환
+        sb.appendPrintf("<%d>", 42);
+        expected += "<42>";
+        builderOk = builderOk && sb.segmentCount() == 3 && pool.available() == 1 && !sb.overflowed();
+
+        // 2) 남은 공간(1바이트)을 넘으면 예비 조각을 새 꼬리로 연결 (결과가 두 조각으로 나뉘지 않음)
+        sb.appendPrintf("[%s]", "printf");
+        expected += "[printf]";
+        builderOk = builderOk && sb.segmentCount() == 4 && pool.available() == 0 && !sb.overflowed() &&
+                    joinSegments(sb) == expected;
+
+        // 3) 예비 조각을 빌리지 못하면 꼬리의 남은 공간에만 기록하고 overflowed 표시
+        sb.appendPrintf("x=%d", 7);
+        expected += "x=7";
+        builderOk = builderOk && sb.overflowed() && sb.segmentCount() == 4 && joinSegments(sb) == expected &&
+                    sb.length() == expected.size();
+        builderOk = builderOk && !sb.append("0123456789") && joinSegments(sb) == expected + "0123";  // 꼬리를 채운 만큼만
+
+        // exportSegments / copyTo(offset)
+        cms::string::Token segs[8];
+        const size_t segCount = sb.exportSegments(segs, 8);
+        std::string exported;
+        for (size_t i = 0; i < segCount; ++i) exported.append(segs[i].ptr, segs[i].len);
+        const std::string all = joinSegments(sb);
+        char window[24] = {};
+        const size_t copied = sb.copyTo(window, 20, 12);  // 첫 조각 끝에서 시작해 세 조각에 걸침
+        builderOk = builderOk && segCount == 4 && exported == all && sb.exportSegments(segs, 2) == 2 &&
+                    copied == 20 && std::string(window, copied) == all.substr(12, 20) &&
+                    sb.copyTo(window, 20, all.size() - 3) == 3 && sb.copyTo(window, 20, all.size()) == 0;
+        std::cout << "조각 " << sb.segmentCount() << "개, 길이 " << sb.length() << ", 내용: " << all << std::endl;
+
+        // clear()는 조각을 모두 돌려주고 overflowed를 초기화
+        sb.clear();
+        builderOk = builderOk && pool.available() == 4 && sb.isEmpty() && !sb.overflowed() && sb.segmentCount() == 0;
+        sb << "after clear " << 123;
+        builderOk = builderOk && joinSegments(sb) == "after clear 123" && pool.available() == 3;
+    }
+    builderOk = builderOk && pool.available() == 4;  // 소멸자도 조각을 반환
+    {
+        cms::StringBuilder a(pool), b(pool);
+        a << "aaaaaaaaaaaaaaaaaaaa";  // 2조각
+        b << "bbbbbbbbbbbbbbbbbbbb";  // 2조각
+        builderOk = builderOk && pool.available() == 0 && joinSegments(a) == std::string(20, 'a') &&
+                    joinSegments(b) == std::string(20, 'b');
+    }
+    builderOk = builderOk && pool.available() == 4;
+    std::cout << "StringBuilder 검증: " << (builderOk ? "OK" : "FAIL") << std::endl;
+
+    std::cout << "\n=== Test 5: Tokenizer 빈 필드/다중 구분자/따옴표 ===" << std::endl;
+    using cms::string::Tokenizer;
+    // 빈 필드: 연속 구분자와 끝의 구분자도 빈 토큰을 만들고, 빈 입력은 토큰이 없음
+    cms::string::Token field;
+    Tokenizer trailing("a,", ",");
+    const bool trailingOk = trailing.next(field) && field == "a" && trailing.delimiter() == ',' &&
+                            trailing.next(field) && field.len == 0 && trailing.delimiter() == '\0' &&
+                            !trailing.hasNext() && !trailing.next(field);
+    Tokenizer empty("", ",");
+    const bool emptyOk = joinTokens(Tokenizer("a,,b", ",")) == "a||b" && joinTokens(Tokenizer(",", ",")) == "|" &&
+                         trailingOk && !empty.hasNext() && !empty.next(field);
+
+    // 여러 구분자 집합과 delimiter(): 한 번의 패스로 키/값 구분
+    Tokenizer kv("mode=auto;rate=10;flag", ";=");
+    std::string pairs;
+    cms::string::Token key, value;
+    while (kv.next(key)) {
+        pairs.append(key.ptr, key.len);
+        if (kv.delimiter() == '=' && kv.next(value)) {
+            pairs += ':';
+            pairs.append(value.ptr, value.len);
+        }
+        pairs += (kv.delimiter() == ';') ? ',' : '.';
+    }
+    const bool multiOk = pairs == "mode:auto,rate:10,flag." && joinTokens(Tokenizer("a b\tc\n", " \t\n")) == "a|b|c|";
+
+    // 따옴표 안의 구분자는 무시, 바깥 따옴표는 벗기고 isQuoted() 표시, 내부 이스케이프는 원본 그대로
+    Tokenizer csv("id,\"Seoul, KR\",\"say \\\"hi\\\", ok\",\"\",x", ",", '"', '\\');
+    std::string quotedFlags;
+    std::string quotedJoined;
+    for (const cms::string::Token& t : csv) {
+        if (!quotedJoined.empty()) quotedJoined += '|';
+        quotedJoined.append(t.ptr, t.len);
+        quotedFlags += csv.isQuoted() ? 'Q' : '-';
+    }
+    const bool quoteOk = quotedJoined == "id|Seoul, KR|say \\\"hi\\\", ok||x" && quotedFlags == "-QQQ-" &&
+                         joinTokens(Tokenizer("a\\,b,c", ",", '\0', '\\')) == "a\\,b|c" &&
+                         joinTokens(Tokenizer("\"open,x", ",", '"')) == "\"open,x";  // 닫히지 않은 따옴표는 끝까지
+
+    // rest(): 명령어 뒤 인자 묶음, 다 소비한 뒤에는 빈 토큰
+    Tokenizer cmd("set led 1 0", " ");
+    cms::string::Token verb;
+    const bool restOk = cmd.next(verb) && verb == "set" && cmd.rest() == "led 1 0" &&
+                        cmd.next(verb) && cmd.next(verb) && cmd.next(verb) && cmd.rest().len == 0;
+
+    // 범위 기반 for와 Token/StringBase 재분할
+    cms::String<48> line("k1=v1&k2=v2&k3");
+    size_t fieldCount = 0;
+    size_t valueCount = 0;
+    for (const cms::string::Token& pair : line.tokenize("&")) {
+        Tokenizer inner(pair, "=");
+        cms::string::Token name;
+        if (inner.next(name) && name.len == 2 && name.ptr[0] == 'k') fieldCount++;
+        if (inner.hasNext()) valueCount++;
+    }
+    const bool rangeOk = fieldCount == 3 && valueCount == 2;
+
+    std::cout << "키/값: " << pairs << ", 따옴표: " << quotedJoined << " (" << quotedFlags << ")" << std::endl;
+    const bool tokenizerOk = emptyOk && multiOk && quoteOk && restOk && rangeOk;
+    std::cout << "Tokenizer 검증: " << (tokenizerOk ? "OK" : "FAIL") << std::endl;
+
+    std::cout << "\n=== Test 6: StringTable 인터닝과 해시 리터럴 ===" << std::endl;
+    using namespace cms::string::literals;
+    // "cmd"_hash, StringTable, 로거 태그 색상이 같은 DJB2를 공유 (switch 분기와 setTagColorHash의 전제)
+    static_assert("x"_hash == cms::string::djb2("x"), "_hash literal must equal djb2().");
+    static_assert("Reboot"_hash == cms::string::djb2("Reboot", 6), "_hash literal must equal djb2(str, len).");
+    static_assert("Network"_ihash == cms::string::djb2("NETWORK", 7, true), "_ihash literal must fold case.");
+    static constexpr cms::FixedString kTag{"[Network] up"};
+    static constexpr cms::FixedString kBareTag{"network"};
+    static_assert(kTag.tagHash() == "Network"_ihash && kBareTag.tagHash() == "NETWORK"_ihash,
+                  "Logger tag hash must match the _ihash literal.");
+
+    cms::StringTable<4, 24> table;
+    const int reboot = table.intern("reboot");
+    const int status = table.intern(cms::string::Token{"status=1", 6});
+    const bool internOk = reboot == 0 && status == 1 && table.intern("reboot") == reboot &&
+                          table.intern(cms::String<16>("status")) == status && table.size() == 2 &&
+                          table.find("status") == status && table.find("REBOOT") == cms::StringTable<>::NOT_FOUND &&
+                          table.find("stat") == cms::StringTable<>::NOT_FOUND &&
+                          strcmp(table.str(reboot), "reboot") == 0 && table.length(status) == 6 &&
+                          table.hashOf(reboot) == "reboot"_hash && table.bytesUsed() == 14 &&
+                          table.str(7) == nullptr && table.length(-1) == 0;
+
+    // 용량 초과: 아레나(24바이트 중 14 사용)와 항목 수(4개) 모두 NOT_FOUND, 기존 항목은 그대로
+    const int longName = table.intern("0123456789");  // NUL 포함 11바이트 > 남은 10바이트
+    const int fits = table.intern("012345678");      // 정확히 10바이트
+    const int noEntry = table.intern("a");           // 아레나는 남지 않음
+    cms::StringTable<2, 64> fewEntries;
+    const bool entryFull = fewEntries.intern("a") == 0 && fewEntries.intern("b") == 1 &&
+                           fewEntries.intern("c") == cms::StringTable<>::NOT_FOUND && fewEntries.intern("b") == 1;
+    const bool capacityOk = longName == cms::StringTable<>::NOT_FOUND && fits == 2 &&
+                            noEntry == cms::StringTable<>::NOT_FOUND && table.bytesUsed() == 24 &&
+                            table.find("reboot") == reboot && entryFull;
+
+    const size_t fullBytes = table.bytesUsed();
+
+    // clear(): 모든 ID 무효화 후 0부터 다시 부여
+    table.clear();
+    const bool clearOk = table.size() == 0 && table.bytesUsed() == 0 &&
+                         table.find("reboot") == cms::StringTable<>::NOT_FOUND && table.str(0) == nullptr &&
+                         table.intern("status") == 0 && strcmp(table.str(0), "status") == 0;
+
+    // ignoreCase 테이블: 처음 등록한 표기를 보관하고 해시는 대소문자를 접은 값
+    cms::StringTable<8, 64> commands(true);
+    const int led = commands.intern("Led");
+    const bool ignoreOk = commands.ignoresCase() && commands.intern("LED") == led && commands.find("led") == led &&
+                          strcmp(commands.str(led), "Led") == 0 && commands.hashOf(led) == "led"_ihash &&
+                          commands.size() == 1;
+
+    std::cout << "ID: reboot=" << reboot << ", status=" << status << ", 아레나 가득 참 후 " << fullBytes
+              << "바이트 사용" << std::endl;
+    const bool tableOk = internOk && capacityOk && clearOk && ignoreOk;
+    std::cout << "StringTable 검증: " << (tableOk ? "OK" : "FAIL") << std::endl;
+
+    std::cout << "\n=== Test 7: StringView 추출/분할과 자기 대입 ===" << std::endl;
+    // 한글은 글자당 3바이트: substring은 글자 단위, byteSubstring은 바이트 단위(경계 보정 없음)
+    const cms::StringView hangul("가나다라마");
+    const bool substringOk = hangul.count() == 5 && hangul.substring(1, 3) == "나다" && hangul.substring(4) == "마" &&
+                             hangul.substring(5).isEmpty() && hangul.substring(3, 2).isEmpty() &&
+                             hangul.substring(0, 9) == hangul && hangul.byteSubstring(3, 9) == "나다" &&
+                             hangul.byteSubstring(12) == "마" && hangul.byteSubstring(1, 4).length() == 3 &&
+                             hangul.byteSubstring(15).isEmpty() && hangul.substring(1, 3).data() == hangul.data() + 3;
+
+    // split: 조각 수 한도에 닿으면 마지막 조각이 나머지 전체를 포함
+    cms::StringView parts[3];
+    const size_t limited = cms::StringView("a,b,c,d").split(',', parts, 3);
+    const bool limitedOk = limited == 3 && parts[0] == "a" && parts[1] == "b" && parts[2] == "c,d";
+    const size_t trailingParts = cms::StringView("온도,").split(',', parts, 3);
+    const bool trailingPartsOk = trailingParts == 2 && parts[0] == "온도" && parts[1].isEmpty();
+    const size_t whole = cms::StringView("no-delimiter").split(',', parts, 3);
+    const bool splitOk = limitedOk && trailingPartsOk && whole == 1 && parts[0] == "no-delimiter";
+
+    const bool trimOk = cms::StringView("  \t 안녕 world \r\n").trimmed() == "안녕 world" &&
+                        cms::StringView(" \t\n").trimmed().isEmpty() && cms::StringView("x").trimmed() == "x";
+
+    // 자기 대입: 뷰가 자신의 버퍼를 가리키면 memmove로 앞으로 당김 (clear() 후 복사하면 원본이 지워짐)
+    cms::String<32> self("0123456789");
+    self = self.view(2);
+    cms::String<32> selfHangul("가나다라");
+    selfHangul = selfHangul.view(1, 3);
+    cms::String<32> selfPrefix("prefix-tail");
+    selfPrefix = selfPrefix.view(0, 6);
+    cms::String<32> selfEnd("abc");
+    selfEnd = selfEnd.view(3);
+    const bool aliasOk = self == "23456789" && self.length() == 8 && self.c_str()[8] == '\0' &&
+                         selfHangul == "나다" && selfHangul.count() == 2 && selfPrefix == "prefix" &&
+                         selfEnd.isEmpty();
+
+    // s.find(other): 파생→기반 변환인 find(const StringBase&)가 선택되어 길이 기반으로 검색
+    cms::String<32> haystack("alpha beta 베타 beta");
+    cms::String<16> needle("beta");
+    cms::String<16> hangulNeedle("베타");
+    cms::String<16> zeroNeedle;
+    zeroNeedle.append("a\0b", 3);  // 내장 NUL: const char* 오버로드였다면 "a"로 잘림
+    cms::String<16> zeroHay;
+    zeroHay.append("xa\0bz", 5);
+    const bool findOk = haystack.find(needle) == 6 && haystack.find(needle, 7) == 14 &&
+                        haystack.find(hangulNeedle) == 11 && haystack.indexOf(needle) == 6 &&
+                        haystack.lastIndexOf(needle) == 14 && haystack.contains(hangulNeedle) &&
+                        haystack.find(haystack) == 0 && zeroHay.find(zeroNeedle) == 1 &&
+                        cms::String<16>("xaz").find(zeroNeedle) == -1;
+
+    std::cout << "substring(1, 3): " << std::string(hangul.substring(1, 3).data(), hangul.substring(1, 3).length())
+              << ", 자기 대입: " << self.c_str() << " / " << selfHangul.c_str() << std::endl;
+    const bool viewOk = substringOk && splitOk && trimOk && aliasOk && findOk;
+    std::cout << "StringView 검증: " << (viewOk ? "OK" : "FAIL") << std::endl;
+
+    std::cout << "\n=== Test 8: Needle / lastIndexOf 차분 비교 (std::string::find/rfind) ===" << std::endl;
+    // 작은 알파벳은 부분 일치와 주기적 패턴(Two-Way 주기 분기)을, 넓은 알파벳은 Horspool 건너뛰기를 자극
+    const char* alphabets[] = {"ab", "aAbB", "abc", "xyzXYZ012", "\x01\x7f\x80\xEA\xB0\x80" "aA"};
+    uint64_t needleSeed = 0x2545F4914F6CDD1Dull;
+    auto nextRand = [&needleSeed]() {
+        needleSeed ^= needleSeed << 13;
+        needleSeed ^= needleSeed >> 7;
+        needleSeed ^= needleSeed << 17;
+        return needleSeed;
+    };
+    int needleChecks = 0;
+    int needleFailures = 0;
+    for (int round = 0; round < 4000; ++round) {
+        const char* alphabet = alphabets[round % 5];
+        const size_t alphabetLen = strlen(alphabet);
+        std::string hay(nextRand() % 600, ' ');
+        for (char& c : hay) c = alphabet[nextRand() % alphabetLen];
+
+        // 패턴: 절반은 본문에서 잘라내(일치 보장), 나머지는 임의 생성 / 주기 반복, 일부는 255바이트 초과
+        std::string pat;
+        const size_t patLen = 1 + nextRand() % ((round % 16 == 0) ? 300 : 12);
+        if (nextRand() % 2 && hay.size() >= patLen) {
+            pat = hay.substr(nextRand() % (hay.size() - patLen + 1), patLen);
+        } else if (nextRand() % 4 == 0) {
+            const std::string unit = std::string(1, alphabet[0]) + alphabet[nextRand() % alphabetLen];
+            while (pat.size() < patLen) pat += unit;
+            pat.resize(patLen);
+        } else {
+            pat.resize(patLen);
+            for (char& c : pat) c = alphabet[nextRand() % alphabetLen];
+        }
+        if (nextRand() % 3 == 0) {  // 대소문자를 섞어 ignoreCase 경로만 일치하게 함
+            for (char& c : pat) {
+                if (c >= 'a' && c <= 'z' && nextRand() % 2) c = static_cast<char>(c - 'a' + 'A');
+            }
+        }
+
+        for (int ic = 0; ic < 2; ++ic) {
+            const bool ignoreCase = (ic == 1);
+            const std::string h = ignoreCase ? foldAscii(hay) : hay;
+            const std::string n = ignoreCase ? foldAscii(pat) : pat;
+            const size_t start = hay.empty() ? 0 : nextRand() % (hay.size() + 1);
+            const cms::string::Needle forward(pat.data(), pat.size(), ignoreCase);
+            const cms::string::Needle reverse(pat.data(), pat.size(), ignoreCase, cms::string::Needle::Direction::Reverse);
+            const bool ok =
+                forward.search(hay.data(), hay.size()) == toOffset(h.find(n)) &&
+                reverse.search(hay.data(), hay.size()) == toOffset(h.rfind(n)) &&
+                cms::string::findBytes(hay.data(), hay.size(), pat.data(), pat.size(), start, ignoreCase) ==
+                    toOffset(h.find(n, start)) &&
+                cms::string::findLastBytes(hay.data(), hay.size(), pat.data(), pat.size(), ignoreCase) == toOffset(h.rfind(n));
+            needleChecks++;
+            if (!ok) {
+                if (needleFailures < 5) {
+                    std::cout << "  불일치: round=" << round << " hayLen=" << hay.size() << " patLen=" << pat.size()
+                              << " ignoreCase=" << ignoreCase << std::endl;
+                }
+                needleFailures++;
+            }
+        }
+
+        // strcasestr (NUL 종료, Needle 기반)
+        if (hay.find('\0') == std::string::npos) {
+            const char* hit = cms::string::strcasestr(hay.c_str(), pat.c_str());
+            if ((hit ? (int)(hit - hay.c_str()) : -1) != toOffset(foldAscii(hay).find(foldAscii(pat)))) needleFailures++;
+        }
+    }
+
+    // 글자 단위 lastIndexOf: 한글 본문에서 글자 인덱스로 변환되는지
+    const char* korean = "온도=21, 습도=40, 온도=22";
+    const bool charIndexOk = cms::string::lastIndexOf(korean, "온도") == 14 && cms::string::lastIndexOf(korean, "x") == -1 &&
+                             cms::string::lastIndexOf("abcABC", "abc", true) == 3 &&
+                             cms::string::Needle("", 0).search("abc", 3) == -1;
+    std::cout << needleChecks << "개 비교, 불일치 " << needleFailures << "개" << std::endl;
+    const bool needleOk = needleFailures == 0 && charIndexOk;
+    std::cout << "Needle 검증: " << (needleOk ? "OK" : "FAIL") << std::endl;
+
+    std::cout << "\n=== Test 9: replace / replaceInto (증가/감소/용량 초과) ===" << std::endl;
+    // 조각: ASCII/한글/대소문자 혼합, 치환: 늘어남/같음/줄어듦/삭제
+    const char* pieces[] = {"ab", "AB", "가", "나다", "-", "{id}", "{ID}", " "};
+    const char* froms[] = {"ab", "{id}", "가", "a", "나다"};
+    const char* tos[] = {"", "x", "가나", "{value}", "온도센서", "ab"};
+    int replaceChecks = 0;
+    int replaceFailures = 0;
+    for (int round = 0; round < 3000; ++round) {
+        std::string src;
+        const size_t pieceCount = nextRand() % 14;
+        for (size_t i = 0; i < pieceCount; ++i) src += pieces[nextRand() % 8];
+        const std::string from = froms[nextRand() % 5];
+        const std::string to = tos[nextRand() % 6];
+        const bool ignoreCase = nextRand() % 2;
+        const size_t maxLen = src.size() + 1 + nextRand() % 24;  // 원본은 항상 들어가고, 늘어난 결과는 넘칠 수 있음
+        size_t total = 0;
+        const std::string all = replaceReference(src, from, to, ignoreCase, SIZE_MAX, &total);
+
+        // replace: 버퍼에 들어가는 만큼 앞에서부터 치환하고 나머지는 원본 그대로
+        std::string expected = all;
+        for (size_t k = total; k > 0 && expected.size() + 1 > maxLen; --k) {
+            expected = replaceReference(src, from, to, ignoreCase, k - 1);
+        }
+        char inPlace[96];
+        memset(inPlace, 0x7E, sizeof(inPlace));
+        memcpy(inPlace, src.c_str(), src.size() + 1);
+        const size_t n = cms::string::replace(inPlace, maxLen, src.size(), from.c_str(), to.c_str(), ignoreCase);
+        bool ok = n == expected.size() && std::string(inPlace, n) == expected && inPlace[n] == '\0' &&
+                  n < maxLen && inPlace[maxLen] == 0x7E && cms::string::validateUtf8(inPlace, n);
+
+        // replaceInto: 전부 치환한 결과를 UTF-8 글자 경계에서 자른 것
+        char into[96];
+        memset(into, 0x7E, sizeof(into));
+        const size_t m = cms::string::replaceInto(src.data(), src.size(), into, maxLen, from.c_str(), to.c_str(), ignoreCase);
+        ok = ok && m < maxLen && into[m] == '\0' && into[maxLen] == 0x7E && cms::string::validateUtf8(into, m) &&
+             all.compare(0, m, into, m) == 0 &&
+             (m == all.size() || ((static_cast<unsigned char>(all[m]) & 0xC0) != 0x80 && m + 3 >= maxLen - 1));
+        if (all.size() + 1 <= maxLen) ok = ok && m == all.size() && std::string(into, m) == std::string(inPlace, n);
+
+        replaceChecks++;
+        if (!ok) {
+            if (replaceFailures < 5) {
+                std::cout << "  불일치: \"" << src << "\" " << from << "->" << to << " maxLen=" << maxLen
+                          << " ignoreCase=" << ignoreCase << std::endl;
+            }
+            replaceFailures++;
+        }
+    }
+
+    // StringBase 경로: 길이/글자 수 캐시 갱신과 자기 자신 대상 replaceInto
+    cms::String<24> grown("a-b-c");
+    grown.replace("-", "::");
+    cms::String<32> shrunk("온도-온도-온도");
+    shrunk.replace("온도", "T");
+    cms::String<16> overflow("xx-xx-xx-xx");
+    overflow.replace("-", "<--->");             // 15바이트 한도: 앞의 한 번만 치환
+    cms::String<32> templ("dev/{id}/state/{ID}");
+    cms::String<10> mqttTopic;  // 9바이트 한도: "dev/보일러..."는 글자 경계(7바이트)에서 잘림
+    templ.replaceInto(mqttTopic, "{id}", "보일러", true);
+    cms::String<32> same("a.b.c");
+    same.replaceInto(same, ".", "/");
+    const bool stringOk = grown == "a::b::c" && grown.length() == 7 && shrunk == "T-T-T" && shrunk.count() == 5 &&
+                          overflow == "xx<--->xx-xx-xx" && overflow.length() == 15 && templ == "dev/{id}/state/{ID}" &&
+                          mqttTopic == "dev/보" && mqttTopic.count() == 5 && same == "a/b/c";
+
+    std::cout << replaceChecks << "개 비교, 불일치 " << replaceFailures << "개, 자른 템플릿: " << mqttTopic.c_str()
+              << ", 제한 치환: " << overflow.c_str() << std::endl;
+    const bool replaceOk = replaceFailures == 0 && stringOk;
+    std::cout << "replace 검증: " << (replaceOk ? "OK" : "FAIL") << std::endl;
+
+    std::cout << "\n=== Test 10: format<> / appendPrintf (snprintf 비교) ===" << std::endl;
+    const bool printfOk =
+        sameAsPrintf<kFmtInt>(-42, 7, -42, -1234567890L, 12345) &&
+        sameAsPrintf<kFmtUnsigned>(4000000000u, 123456789ul, 42u, 7u) &&
+        sameAsPrintf<kFmtHex>(0xbeefu, 0xbeefu, 0xbeefu, 0xau, 0xdeadbeeful, 0x5u) &&
+        sameAsPrintf<kFmtFloat>(3.14159, 2.7, -0.0626, -3.14159, -1.25, 0.123456789, 123.46, 1.5) &&
+        sameAsPrintf<kFmtFloat>(0.0, 99.6, 1000.0004, 42.0, 3.0, 1e-10, 0.04, -12.345) &&
+        sameAsPrintf<kFmtSpecial>(HUGE_VAL, -HUGE_VAL, 1.0 / 3.0) &&
+        sameAsPrintf<kFmtText>("key", "value", 'o', 'k') &&
+        sameAsPrintf<kFmtJson>(17, 23.46, 0x3Fu);
+
+    // 최단 왕복 표기: 0.1은 "0.1", 비정규 최솟값과 큰 값은 지수 표기
+    const bool shortestOk = shortestRoundTrip(0.1, "0.1") && shortestRoundTrip(5e-324, "5e-324") &&
+                            shortestRoundTrip(1e21, "1e+21") && shortestRoundTrip(-2.5, "-2.5") &&
+                            shortestRoundTrip(1.7976931348623157e308, "1.7976931348623157e+308") &&
+                            shortestRoundTrip(123456789012345.0, "123456789012345");
+
+    // printf와 다른 규칙: 정밀도를 생략한 %f는 소수점 2자리, 중간값(0.0625, 23.45 등)은 0에서 먼 쪽으로 반올림
+    cms::String<16> padded;
+    CMS_FORMAT(padded, "%08.3f", -3.14159);
+    cms::String<32> defaults;
+    CMS_FORMAT(defaults, "%f %.3f", 3.14159, 0.0625);
+    std::cout << "%08.3f: " << padded.c_str() << ", 기본 정밀도/중간값: " << defaults.c_str() << std::endl;
+    const bool formatOk = printfOk && shortestOk && padded == "-003.142" && defaults == "3.14 0.063";
+    std::cout << "format 검증: " << (formatOk ? "OK" : "FAIL") << std::endl;
+
+    return (realOk && copyOk && regexOk && builderOk && tokenizerOk && tableOk && viewOk && needleOk && replaceOk &&
+            formatOk) ? 0 : 1;
+}
+
+#endif // CMS_STRING_TEST